@@ -131,6 +131,8 @@ SRCS += \
   $(TOP)/watch-library/hardware/watch/watch_spi.c \
   $(TOP)/watch-library/hardware/watch/watch_uart.c \
   $(TOP)/watch-library/hardware/watch/watch_storage.c \
+  $(TOP)/watch-library/hardware/watch/watch_timebase.c \
+  $(TOP)/watch-library/hardware/watch/watch_performance.c \
   $(TOP)/watch-library/hardware/watch/watch_deepsleep.c \
   $(TOP)/watch-library/hardware/watch/watch_private.c \
   $(TOP)/watch-library/hardware/watch/watch_private_cdc.c \
@@ -168,11 +170,18 @@ SRCS += \
   $(TOP)/watch-library/shared/driver/spiflash.c \
   $(TOP)/watch-library/shared/watch/watch_private_display.c \
   $(TOP)/watch-library/shared/watch/watch_utility.c \
+  $(TOP)/watch-library/shared/watch/watch_random.c \
 
 DEFINES += \
   -D__SAML22J18A__ \
   -DDONT_USE_CMSIS_INIT
 
+# USB mass storage: the watch also shows up as a small read-only drive with the files on it.
+ifdef USB_MSC
+DEFINES += -DWATCH_USB_MSC -DLFS_THREADSAFE
+SRCS += $(TOP)/tinyusb/src/class/msc/msc_device.c
+endif
+
 else
 
 CFLAGS += -W -Wall -Wextra -Wmissing-prototypes -Wmissing-declarations
@@ -205,13 +214,17 @@ SRCS += \
   $(TOP)/watch-library/simulator/watch/watch_spi.c \
   $(TOP)/watch-library/simulator/watch/watch_uart.c \
   $(TOP)/watch-library/simulator/watch/watch_storage.c \
+  $(TOP)/watch-library/simulator/watch/watch_timebase.c \
+  $(TOP)/watch-library/simulator/watch/watch_performance.c \
   $(TOP)/watch-library/simulator/watch/watch_deepsleep.c \
   $(TOP)/watch-library/simulator/watch/watch_private.c \
   $(TOP)/watch-library/simulator/watch/watch.c \
   $(TOP)/watch-library/shared/driver/thermistor_driver.c \
   $(TOP)/watch-library/shared/driver/opt3001.c \
+  $(TOP)/watch-library/shared/driver/spiflash.c \
   $(TOP)/watch-library/shared/watch/watch_private_display.c \
   $(TOP)/watch-library/shared/watch/watch_utility.c \
+  $(TOP)/watch-library/shared/watch/watch_random.c \
 
 endif
 
@@ -6,30 +6,89 @@
 #include "watch.h"
 #include "lfs.h"
 #include "hpl_flash.h"
+#include "spiflash.h"
+#ifdef WATCH_USB_MSC
+#include "filesystem_fat.h"
+#endif
 
 int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size);
 int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size);
 int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block);
 int lfs_storage_sync(const struct lfs_config *cfg);
 
+#ifdef LFS_THREADSAFE
+// littlefs takes this lock around every operation. There are no threads here, but with USB mass storage enabled,
+// the host reads the filesystem from the USB interrupt, which must not step in while the main loop is using it.
+static volatile uint8_t _filesystem_lock_depth;
+
+static int lfs_storage_lock(const struct lfs_config *cfg) {
+    (void) cfg;
+    _filesystem_lock_depth++;
+    return 0;
+}
+
+static int lfs_storage_unlock(const struct lfs_config *cfg) {
+    (void) cfg;
+    _filesystem_lock_depth--;
+    return 0;
+}
+#endif
+
+// Free space accounting. Walking every block with lfs_fs_traverse is too slow to do each time a face wants to know
+// how much room is left, so we keep a map of the blocks in use and update it as littlefs works: littlefs always
+// erases a block right before it starts using it, so lfs_storage_erase marks it used. Blocks that littlefs lets go
+// of (a file removed or truncated, or a block replaced by a copy on write) never pass through us, so between walks
+// the count can only overstate what's in use. We walk again lazily: after a remove, truncate or format, or when
+// space is running low and enough blocks have been taken since the last walk that some of them may have replaced
+// blocks littlefs has since let go of. Near full, that's one walk per FILESYSTEM_REWALK_BLOCKS new blocks rather
+// than one per write, and in between the count is off by at most that many blocks, always on the safe side.
+#define FILESYSTEM_BLOCK_COUNT (NVMCTRL_RWWEE_PAGES / 4)
+#define FILESYSTEM_LOW_SPACE_BLOCKS (FILESYSTEM_BLOCK_COUNT / 4)
+#define FILESYSTEM_REWALK_BLOCKS 4
+
+static uint32_t _used_map[(FILESYSTEM_BLOCK_COUNT + 31) / 32];
+static uint16_t _used_blocks;
+static bool _usage_known;       // false until the first walk, and after anything that is known to free blocks
+static uint8_t _blocks_taken;   // blocks newly taken since the last walk
+
+static inline bool _mark_block_used(lfs_block_t block) {
+    uint32_t mask = 1ul << (block % 32);
+    if (block >= FILESYSTEM_BLOCK_COUNT || (_used_map[block / 32] & mask)) return false;
+    _used_map[block / 32] |= mask;
+    _used_blocks++;
+    return true;
+}
+
+static inline void _invalidate_usage(void) {
+    _usage_known = false;
+}
+
 int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size) {
     (void) cfg;
-    return !watch_storage_read(block, off, (void *)buffer, size);
+    return watch_storage_read(block, off, (void *)buffer, size) ? 0 : LFS_ERR_IO;
 }
 
 int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
     (void) cfg;
-    return !watch_storage_write(block, off, (void *)buffer, size);
+#ifdef WATCH_USB_MSC
+    filesystem_fat_invalidate();
+#endif
+    return watch_storage_write(block, off, (void *)buffer, size) ? 0 : LFS_ERR_IO;
 }
 
 int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block) {
     (void) cfg;
-    return !watch_storage_erase(block);
+    // an erased block is one that littlefs is about to use.
+    if (_usage_known && _mark_block_used(block) && _blocks_taken < UINT8_MAX) _blocks_taken++;
+#ifdef WATCH_USB_MSC
+    filesystem_fat_invalidate();
+#endif
+    return watch_storage_erase(block) ? 0 : LFS_ERR_IO;
 }
 
 int lfs_storage_sync(const struct lfs_config *cfg) {
     (void) cfg;
-    return !watch_storage_sync();
+    return watch_storage_sync() ? 0 : LFS_ERR_IO;
 }
 
 const struct lfs_config cfg = {
@@ -38,12 +97,16 @@ const struct lfs_config cfg = {
     .prog  = lfs_storage_prog,
     .erase = lfs_storage_erase,
     .sync  = lfs_storage_sync,
+#ifdef LFS_THREADSAFE
+    .lock = lfs_storage_lock,
+    .unlock = lfs_storage_unlock,
+#endif
 
     // block device configuration
     .read_size = 16,
     .prog_size = NVMCTRL_PAGE_SIZE,
     .block_size = NVMCTRL_ROW_SIZE,
-    .block_count = NVMCTRL_RWWEE_PAGES / 4,
+    .block_count = FILESYSTEM_BLOCK_COUNT,
     .cache_size = NVMCTRL_PAGE_SIZE,
     .lookahead_size = 16,
     .block_cycles = 100,
@@ -53,25 +116,141 @@ static lfs_t lfs;
 static lfs_file_t file;
 static struct lfs_info info;
 
-static int _traverse_df_cb(void *p, lfs_block_t block) {
-    (void) block;
-	uint32_t *nb = p;
-	*nb += 1;
-	return 0;
+// Second volume on the external SPI flash chip found on some sensor boards, which shows up under /ext. It's set up
+// the first time something asks for a path there, since probing means driving the chip select on A3, and boards
+// without the chip may be using that pin for something else. It is never formatted automatically: the chip may hold
+// raw data from accelerometer_data_acquisition_face, which uses it without a filesystem (and will clobber this one).
+#define FILESYSTEM_EXT_PREFIX "/ext"
+#define FILESYSTEM_EXT_PREFIX_LEN (sizeof(FILESYSTEM_EXT_PREFIX) - 1)
+
+typedef enum {
+    FILESYSTEM_EXT_UNKNOWN = 0,
+    FILESYSTEM_EXT_ABSENT,
+    FILESYSTEM_EXT_UNFORMATTED,
+    FILESYSTEM_EXT_MOUNTED,
+} filesystem_ext_state_t;
+
+static int lfs_ext_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size) {
+    return spi_flash_read_data(block * cfg->block_size + off, buffer, size) ? 0 : LFS_ERR_IO;
 }
 
-int32_t filesystem_get_free_space(void) {
-	int err;
+static int lfs_ext_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
+    return spi_flash_program(block * cfg->block_size + off, buffer, size) ? 0 : LFS_ERR_IO;
+}
+
+static int lfs_ext_erase(const struct lfs_config *cfg, lfs_block_t block) {
+    return spi_flash_erase_sector(block * cfg->block_size) ? 0 : LFS_ERR_IO;
+}
+
+static int lfs_ext_sync(const struct lfs_config *cfg) {
+    (void) cfg;
+    // spi_flash_program and spi_flash_erase_sector don't return until the chip is done.
+    return 0;
+}
+
+static struct lfs_config ext_cfg = {
+    // block device operations
+    .read  = lfs_ext_read,
+    .prog  = lfs_ext_prog,
+    .erase = lfs_ext_erase,
+    .sync  = lfs_ext_sync,
+#ifdef LFS_THREADSAFE
+    .lock = lfs_storage_lock,
+    .unlock = lfs_storage_unlock,
+#endif
+
+    // block device configuration; block_count is filled in from the chip's JEDEC ID.
+    .read_size = 16,
+    .prog_size = 16,
+    .block_size = SPI_FLASH_SECTOR_SIZE,
+    .cache_size = 64,
+    .lookahead_size = 16,
+    .block_cycles = 500,
+};
+
+static lfs_t lfs_ext;
+static filesystem_ext_state_t _ext_state;
+
+static bool _filesystem_is_ext_path(const char *path) {
+    return strncmp(path, FILESYSTEM_EXT_PREFIX, FILESYSTEM_EXT_PREFIX_LEN) == 0 &&
+           (path[FILESYSTEM_EXT_PREFIX_LEN] == '\0' || path[FILESYSTEM_EXT_PREFIX_LEN] == '/');
+}
+
+static filesystem_ext_state_t _filesystem_ext_probe(void) {
+    if (_ext_state == FILESYSTEM_EXT_UNKNOWN) {
+        spi_flash_init();
+        uint32_t capacity = spi_flash_get_capacity();
+        if (capacity == 0) {
+            watch_disable_spi();
+            _ext_state = FILESYSTEM_EXT_ABSENT;
+        } else {
+            ext_cfg.block_count = capacity / SPI_FLASH_SECTOR_SIZE;
+            if (lfs_mount(&lfs_ext, &ext_cfg) == LFS_ERR_OK) {
+                _ext_state = FILESYSTEM_EXT_MOUNTED;
+            } else {
+                printf("%s: no filesystem; use 'format %s YES' to create one\r\n", FILESYSTEM_EXT_PREFIX, FILESYSTEM_EXT_PREFIX);
+                _ext_state = FILESYSTEM_EXT_UNFORMATTED;
+            }
+        }
+    }
+
+    return _ext_state;
+}
 
-	uint32_t free_blocks = 0;
-	err = lfs_fs_traverse(&lfs, _traverse_df_cb, &free_blocks);
-	if(err < 0){
-		return err;
-	}
+// finds the volume a path lives on, and the path within that volume. returns NULL if it's on one we don't have.
+static lfs_t *_filesystem_volume(const char *path, const char **subpath) {
+    *subpath = path;
+    if (!_filesystem_is_ext_path(path)) return &lfs;
+
+    *subpath = path[FILESYSTEM_EXT_PREFIX_LEN] ? path + FILESYSTEM_EXT_PREFIX_LEN : "/";
+    return _filesystem_ext_probe() == FILESYSTEM_EXT_MOUNTED ? &lfs_ext : NULL;
+}
 
-	uint32_t available = cfg.block_count * cfg.block_size - free_blocks * cfg.block_size;
+// subdirectories aren't supported, but /ext/<name> is a file at the top of the external volume.
+static bool _filesystem_path_is_flat(const char *path) {
+    if (_filesystem_is_ext_path(path)) {
+        path += FILESYSTEM_EXT_PREFIX_LEN;
+        if (*path == '/') path++;
+    }
+    return strchr(path, '/') == NULL;
+}
+
+static int32_t _filesystem_ext_get_free_space(void) {
+    lfs_ssize_t used = lfs_fs_size(&lfs_ext);
+    if (used < 0) return used;
+    return (int32_t)(ext_cfg.block_count - used) * ext_cfg.block_size;
+}
 
-	return (int32_t)available;
+static int32_t _filesystem_volume_free_space(lfs_t *volume) {
+    return volume == &lfs_ext ? _filesystem_ext_get_free_space() : filesystem_get_free_space();
+}
+
+static int _traverse_df_cb(void *p, lfs_block_t block) {
+    (void) p;
+    // littlefs may report the same block more than once; the map makes sure it's only counted once.
+    _mark_block_used(block);
+    return 0;
+}
+
+static int _count_used_blocks(void) {
+    memset(_used_map, 0, sizeof(_used_map));
+    _used_blocks = 0;
+    int err = lfs_fs_traverse(&lfs, _traverse_df_cb, NULL);
+    _usage_known = err >= 0;
+    _blocks_taken = 0;
+    return err;
+}
+
+int32_t filesystem_get_free_space(void) {
+    uint16_t free_blocks = FILESYSTEM_BLOCK_COUNT - _used_blocks;
+    // when space is low, walk again once enough blocks have been taken, or if we're about to say there's none left.
+    bool stale = _blocks_taken >= FILESYSTEM_REWALK_BLOCKS || (_blocks_taken && free_blocks == 0);
+    if (!_usage_known || (stale && free_blocks < FILESYSTEM_LOW_SPACE_BLOCKS)) {
+        int err = _count_used_blocks();
+        if (err < 0) return err;
+    }
+
+    return (int32_t)(FILESYSTEM_BLOCK_COUNT - _used_blocks) * cfg.block_size;
 }
 
 static int filesystem_ls(lfs_t *lfs, const char *path) {
@@ -124,36 +303,75 @@ bool filesystem_init(void) {
         printf("Filesystem mounted with %ld bytes free.\r\n", filesystem_get_free_space());
     }
 
+#ifdef WATCH_USB_MSC
+    if (err == LFS_ERR_OK) filesystem_fat_init(&lfs);
+#endif
+
     return err == LFS_ERR_OK;
 }
 
+bool filesystem_is_busy(void) {
+#ifdef LFS_THREADSAFE
+    return _filesystem_lock_depth > 0;
+#else
+    return false;
+#endif
+}
+
 int _filesystem_format(void);
 int _filesystem_format(void) {
+#ifdef LFS_THREADSAFE
+    // the volume is unusable between unmounting and remounting, not just during each call.
+    _filesystem_lock_depth++;
+#endif
     int err = lfs_unmount(&lfs);
     if (err < 0) {
         printf("Couldn't unmount - continuing to format, but you should reboot afterwards!\r\n");
     }
 
     err = lfs_format(&lfs, &cfg);
+    if (err >= 0) err = lfs_mount(&lfs, &cfg);
+    _invalidate_usage();
+#ifdef LFS_THREADSAFE
+    _filesystem_lock_depth--;
+#endif
     if (err < 0) return err;
+    printf("Filesystem re-mounted with %ld bytes free.\r\n", filesystem_get_free_space());
+    return 0;
+}
+
+int _filesystem_format_ext(void);
+int _filesystem_format_ext(void) {
+    if (_filesystem_ext_probe() == FILESYSTEM_EXT_ABSENT) {
+        printf("%s: no flash chip found\r\n", FILESYSTEM_EXT_PREFIX);
+        return -1;
+    }
+    if (_ext_state == FILESYSTEM_EXT_MOUNTED) lfs_unmount(&lfs_ext);
+    _ext_state = FILESYSTEM_EXT_UNFORMATTED;
 
-    err = lfs_mount(&lfs, &cfg);
+    printf("Formatting %s, this may take a while...\r\n", FILESYSTEM_EXT_PREFIX);
+    int err = lfs_format(&lfs_ext, &ext_cfg);
+    if (err >= 0) err = lfs_mount(&lfs_ext, &ext_cfg);
     if (err < 0) return err;
-    printf("Filesystem re-mounted with %ld bytes free.\r\n", filesystem_get_free_space());
+    _ext_state = FILESYSTEM_EXT_MOUNTED;
+    printf("%s mounted with %ld bytes free.\r\n", FILESYSTEM_EXT_PREFIX, _filesystem_ext_get_free_space());
     return 0;
 }
 
 bool filesystem_file_exists(char *filename) {
+    const char *path;
+    lfs_t *volume = _filesystem_volume(filename, &path);
     info.type = 0;
-    lfs_stat(&lfs, filename, &info);
+    if (volume) lfs_stat(volume, path, &info);
     return info.type == LFS_TYPE_REG;
 }
 
 bool filesystem_rm(char *filename) {
-    info.type = 0;
-    lfs_stat(&lfs, filename, &info);
+    const char *path;
+    lfs_t *volume = _filesystem_volume(filename, &path);
     if (filesystem_file_exists(filename)) {
-        return lfs_remove(&lfs, filename) == LFS_ERR_OK;
+        if (volume == &lfs) _invalidate_usage();
+        return lfs_remove(volume, path) == LFS_ERR_OK;
     } else {
         printf("rm: %s: No such file\r\n", filename);
         return false;
@@ -170,13 +388,15 @@ int32_t filesystem_get_file_size(char *filename) {
 
 bool filesystem_read_file(char *filename, char *buf, int32_t length) {
     memset(buf, 0, length);
+    const char *path;
+    lfs_t *volume = _filesystem_volume(filename, &path);
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDONLY);
+        int err = lfs_file_open(volume, &file, path, LFS_O_RDONLY);
         if (err < 0) return false;
-        err = lfs_file_read(&lfs, &file, buf, min(length, file_size));
+        err = lfs_file_read(volume, &file, buf, min(length, file_size));
         if (err < 0) return false;
-        return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+        return lfs_file_close(volume, &file) == LFS_ERR_OK;
     }
 
     return false;
@@ -184,13 +404,15 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length) {
 
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length) {
     memset(buf, 0, length + 1);
+    const char *path;
+    lfs_t *volume = _filesystem_volume(filename, &path);
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDONLY);
+        int err = lfs_file_open(volume, &file, path, LFS_O_RDONLY);
         if (err < 0) return false;
-        err = lfs_file_seek(&lfs, &file, *offset, LFS_SEEK_SET);
+        err = lfs_file_seek(volume, &file, *offset, LFS_SEEK_SET);
         if (err < 0) return false;
-        err = lfs_file_read(&lfs, &file, buf, min(length - 1, file_size - *offset));
+        err = lfs_file_read(volume, &file, buf, min(length - 1, file_size - *offset));
         if (err < 0) return false;
         for(int i = 0; i < length; i++) {
             (*offset)++;
@@ -199,49 +421,63 @@ bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t le
                 break;
             }
         }
-        return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+        return lfs_file_close(volume, &file) == LFS_ERR_OK;
     }
 
     return false;
 }
 
 static void filesystem_cat(char *filename) {
-    info.type = 0;
-    lfs_stat(&lfs, filename, &info);
     if (filesystem_file_exists(filename)) {
-        if (info.size > 0) {
-            char *buf = malloc(info.size + 1);
-            filesystem_read_file(filename, buf, info.size);
-            buf[info.size] = '\0';
-            printf("%s\r\n", buf);
-            free(buf);
-        } else {
-            printf("\r\n");
+        const char *path;
+        lfs_t *volume = _filesystem_volume(filename, &path);
+        // stream the file in small chunks rather than reading it all into RAM.
+        char buf[64];
+        int err = lfs_file_open(volume, &file, path, LFS_O_RDONLY);
+        if (err < 0) return;
+        while ((err = lfs_file_read(volume, &file, buf, sizeof(buf))) > 0) {
+            fwrite(buf, 1, err, stdout);
         }
+        lfs_file_close(volume, &file);
+        printf("\r\n");
     } else {
         printf("cat: %s: No such file\r\n", filename);
     }
 }
 
 bool filesystem_write_file(char *filename, char *text, int32_t length) {
-    int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
+    const char *path;
+    lfs_t *volume = _filesystem_volume(filename, &path);
+    if (volume == NULL) return false;
+    int err = lfs_file_open(volume, &file, path, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
     if (err < 0) return false;
-    err = lfs_file_write(&lfs, &file, text, length);
+    // the old contents, if any, were just let go of.
+    if (volume == &lfs) _invalidate_usage();
+    err = lfs_file_write(volume, &file, text, length);
     if (err < 0) return false;
-    return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+    return lfs_file_close(volume, &file) == LFS_ERR_OK;
 }
 
 bool filesystem_append_file(char *filename, char *text, int32_t length) {
-    int err = lfs_file_open(&lfs, &file, filename, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
+    const char *path;
+    lfs_t *volume = _filesystem_volume(filename, &path);
+    if (volume == NULL) return false;
+    int err = lfs_file_open(volume, &file, path, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
     if (err < 0) return false;
-    err = lfs_file_write(&lfs, &file, text, length);
+    err = lfs_file_write(volume, &file, text, length);
     if (err < 0) return false;
-    return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+    return lfs_file_close(volume, &file) == LFS_ERR_OK;
 }
 
 int filesystem_cmd_ls(int argc, char *argv[]) {
     if (argc >= 2) {
-        filesystem_ls(&lfs, argv[1]);
+        const char *path;
+        lfs_t *volume = _filesystem_volume(argv[1], &path);
+        if (volume == NULL) {
+            printf("ls: %s: No such volume\r\n", argv[1]);
+            return 1;
+        }
+        filesystem_ls(volume, path);
     } else {
         filesystem_ls(&lfs, "/");
     }
@@ -258,6 +494,11 @@ int filesystem_cmd_df(int argc, char *argv[]) {
     (void) argc;
     (void) argv;
     printf("free space: %ld bytes\r\n", filesystem_get_free_space());
+    // don't probe for the flash chip here; probing starts up SPI and may complain about an unformatted chip. if an /ext
+    // command has already mounted it, report it; otherwise leave it alone.
+    if (_ext_state == FILESYSTEM_EXT_MOUNTED) {
+        printf("%s free space: %ld bytes\r\n", FILESYSTEM_EXT_PREFIX, _filesystem_ext_get_free_space());
+    }
     return 0;
 }
 
@@ -268,11 +509,13 @@ int filesystem_cmd_rm(int argc, char *argv[]) {
 }
 
 int filesystem_cmd_format(int argc, char *argv[]) {
-    (void) argc;
-    if(strcmp(argv[1], "YES") == 0) {
+    if (argc == 2 && strcmp(argv[1], "YES") == 0) {
         return _filesystem_format();
     }
-    printf("usage: format YES\r\n");
+    if (argc == 3 && strcmp(argv[1], FILESYSTEM_EXT_PREFIX) == 0 && strcmp(argv[2], "YES") == 0) {
+        return _filesystem_format_ext();
+    }
+    printf("usage: format [%s] YES\r\n", FILESYSTEM_EXT_PREFIX);
     return 1;
 }
 
@@ -288,7 +531,7 @@ int filesystem_cmd_echo(int argc, char *argv[]) {
         line[line_len] = '\0';
     }
 
-    if (strchr(argv[3], '/')) {
+    if (!_filesystem_path_is_flat(argv[3])) {
         printf("subdirectories are not supported\r\n");
         return -2;
     }
@@ -305,3 +548,270 @@ int filesystem_cmd_echo(int argc, char *argv[]) {
 
     return 0;
 }
+
+// File transfer protocol for the get and put commands; see utils/watch_file_transfer for the host side.
+// Data moves in numbered frames of up to FILESYSTEM_XFER_CHUNK_SIZE bytes, one frame per line:
+//     D <seq> <crc32> <base64 data>
+// where seq and crc32 (of the decoded data, as in zlib) are hex. The receiver acknowledges each frame in order
+// with "A <seq>", or asks for everything from a given frame again with "N <seq>". The sender keeps up to
+// FILESYSTEM_XFER_WINDOW frames in flight, and goes back to the oldest unacknowledged frame if it hears nothing
+// for a while. Either side can give up by sending "X". Both commands start with "READY <size> <chunk> <window>"
+// and end with "OK <size> <crc32>" for the whole file, or "ERR <reason>".
+
+#define FILESYSTEM_XFER_CHUNK_SIZE 128
+#define FILESYSTEM_XFER_WINDOW 4
+#define FILESYSTEM_XFER_TIMEOUT_MS 2000
+#define FILESYSTEM_XFER_MAX_RETRIES 5
+// "D ", two 8-digit hex numbers with spaces, base64 of a chunk and a line ending, with room to spare.
+#define FILESYSTEM_XFER_LINE_SIZE (32 + (FILESYSTEM_XFER_CHUNK_SIZE + 2) / 3 * 4)
+
+static const char _base64_chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static void _base64_encode(const uint8_t *data, size_t len, char *out) {
+    for (size_t i = 0; i < len; i += 3) {
+        uint32_t n = data[i] << 16;
+        if (i + 1 < len) n |= data[i + 1] << 8;
+        if (i + 2 < len) n |= data[i + 2];
+        *out++ = _base64_chars[(n >> 18) & 0x3F];
+        *out++ = _base64_chars[(n >> 12) & 0x3F];
+        *out++ = (i + 1 < len) ? _base64_chars[(n >> 6) & 0x3F] : '=';
+        *out++ = (i + 2 < len) ? _base64_chars[n & 0x3F] : '=';
+    }
+    *out = '\0';
+}
+
+// returns the number of bytes decoded, or -1 if the input isn't valid base64 or doesn't fit.
+static int _base64_decode(const char *in, uint8_t *out, size_t size) {
+    size_t len = 0;
+    uint32_t n = 0;
+    uint8_t bits = 0;
+
+    for (; *in && *in != '='; in++) {
+        const char *c = strchr(_base64_chars, *in);
+        if (c == NULL) return -1;
+        n = (n << 6) | (c - _base64_chars);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            if (len >= size) return -1;
+            out[len++] = n >> bits;
+        }
+    }
+
+    return len;
+}
+
+static inline uint32_t _xfer_crc(uint32_t crc, const void *data, size_t len) {
+    // lfs_crc is the standard CRC-32 without the final inversion.
+    return lfs_crc(crc ^ 0xFFFFFFFF, data, len) ^ 0xFFFFFFFF;
+}
+
+// reads a line from the host, waiting up to timeout_ms for each character. returns its length, or -1 on timeout.
+static int _xfer_read_line(char *buf, size_t size, uint16_t timeout_ms) {
+    size_t len = 0;
+    uint16_t idle_ms = 0;
+
+    while (true) {
+        int c = getchar();
+        if (c < 0) {
+            if (idle_ms++ >= timeout_ms) return -1;
+            delay_ms(1);
+            continue;
+        }
+        idle_ms = 0;
+        if (c == '\r' || c == '\n') {
+            if (len == 0) continue;
+            buf[len] = '\0';
+            return len;
+        }
+        // overlong lines are truncated, and will fail their CRC check.
+        if (len < size - 1) buf[len++] = c;
+    }
+}
+
+// parses "<c> <seq>", returning the sequence number, or -1 if the line isn't of that form.
+static int32_t _xfer_parse_reply(const char *line, char c) {
+    if (line[0] != c || line[1] != ' ') return -1;
+    char *end;
+    uint32_t seq = strtoul(line + 2, &end, 16);
+    if (end == line + 2 || *end != '\0') return -1;
+    return seq;
+}
+
+static void _xfer_reply(const char *format, uint32_t value) {
+    printf(format, value);
+    fflush(stdout);
+}
+
+int filesystem_cmd_get(int argc, char *argv[]) {
+    (void) argc;
+
+    const char *path;
+    lfs_t *volume = _filesystem_volume(argv[1], &path);
+    if (!filesystem_file_exists(argv[1])) {
+        printf("ERR no such file\r\n");
+        return -1;
+    }
+    if (lfs_file_open(volume, &file, path, LFS_O_RDONLY) < 0) {
+        printf("ERR open\r\n");
+        return -1;
+    }
+
+    int32_t size = lfs_file_size(volume, &file);
+    uint32_t num_frames = (size + FILESYSTEM_XFER_CHUNK_SIZE - 1) / FILESYSTEM_XFER_CHUNK_SIZE;
+    uint32_t base = 0;          // oldest unacknowledged frame
+    uint32_t next = 0;          // next frame to send
+    uint32_t high = 0;          // frames below this have been sent at least once
+    uint32_t position = 0;      // current position in the file
+    uint32_t crc = 0;
+    uint8_t retries = 0;
+    uint8_t data[FILESYSTEM_XFER_CHUNK_SIZE];
+    char line[FILESYSTEM_XFER_LINE_SIZE];
+    const char *error = NULL;
+
+    printf("READY %ld %d %d\r\n", size, FILESYSTEM_XFER_CHUNK_SIZE, FILESYSTEM_XFER_WINDOW);
+    fflush(stdout);
+
+    while (base < num_frames && error == NULL) {
+        while (next < num_frames && next < base + FILESYSTEM_XFER_WINDOW) {
+            uint32_t offset = next * FILESYSTEM_XFER_CHUNK_SIZE;
+            if (position != offset && lfs_file_seek(volume, &file, offset, LFS_SEEK_SET) < 0) {
+                error = "seek";
+                break;
+            }
+            int len = lfs_file_read(volume, &file, data, sizeof(data));
+            if (len <= 0) {
+                error = "read";
+                break;
+            }
+            position = offset + len;
+            // the whole-file CRC is computed the first time each frame goes out, which is always in order.
+            if (next == high) {
+                crc = _xfer_crc(crc, data, len);
+                high++;
+            }
+            _base64_encode(data, len, line);
+            printf("D %lx %08lx %s\r\n", next, _xfer_crc(0, data, len), line);
+            next++;
+        }
+        fflush(stdout);
+        if (error) break;
+
+        int32_t seq;
+        if (_xfer_read_line(line, sizeof(line), FILESYSTEM_XFER_TIMEOUT_MS) < 0) {
+            // nothing heard; go back and resend everything in flight.
+            if (++retries > FILESYSTEM_XFER_MAX_RETRIES) error = "timeout";
+            next = base;
+        } else if ((seq = _xfer_parse_reply(line, 'A')) >= 0) {
+            if ((uint32_t)seq >= base && (uint32_t)seq < next) {
+                base = seq + 1;
+                retries = 0;
+            }
+        } else if ((seq = _xfer_parse_reply(line, 'N')) >= 0) {
+            if ((uint32_t)seq >= base && (uint32_t)seq < next) {
+                if (++retries > FILESYSTEM_XFER_MAX_RETRIES) error = "retries";
+                base = next = seq;
+            }
+        } else if (line[0] == 'X') {
+            error = "aborted";
+        }
+    }
+
+    lfs_file_close(volume, &file);
+
+    if (error) {
+        printf("ERR %s\r\n", error);
+        return -1;
+    }
+    printf("OK %ld %08lx\r\n", size, crc);
+    return 0;
+}
+
+int filesystem_cmd_put(int argc, char *argv[]) {
+    (void) argc;
+
+    if (!_filesystem_path_is_flat(argv[1])) {
+        printf("ERR subdirectories are not supported\r\n");
+        return -1;
+    }
+    const char *path;
+    lfs_t *volume = _filesystem_volume(argv[1], &path);
+    if (volume == NULL) {
+        printf("ERR no such volume\r\n");
+        return -1;
+    }
+    int32_t size = atol(argv[2]);
+    // the free space estimate errs on the low side; make sure before turning the file away.
+    if (volume == &lfs && size > filesystem_get_free_space()) _invalidate_usage();
+    if (size < 0 || size > _filesystem_volume_free_space(volume)) {
+        printf("ERR no space\r\n");
+        return -1;
+    }
+    if (lfs_file_open(volume, &file, path, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) < 0) {
+        printf("ERR open\r\n");
+        return -1;
+    }
+    if (volume == &lfs) _invalidate_usage();
+
+    int32_t received = 0;
+    uint32_t expected = 0;      // next frame we can accept
+    uint32_t crc = 0;
+    int32_t nak_sent = -1;      // only ask for each frame once; timeouts take care of lost requests
+    uint8_t retries = 0;
+    uint8_t data[FILESYSTEM_XFER_CHUNK_SIZE];
+    char line[FILESYSTEM_XFER_LINE_SIZE];
+    const char *error = NULL;
+
+    printf("READY %ld %d %d\r\n", size, FILESYSTEM_XFER_CHUNK_SIZE, FILESYSTEM_XFER_WINDOW);
+    fflush(stdout);
+
+    while (received < size && error == NULL) {
+        if (_xfer_read_line(line, sizeof(line), FILESYSTEM_XFER_TIMEOUT_MS) < 0) {
+            if (++retries > FILESYSTEM_XFER_MAX_RETRIES) error = "timeout";
+            else _xfer_reply("N %lx\r\n", expected);
+            continue;
+        }
+        if (line[0] == 'X') {
+            error = "aborted";
+            break;
+        }
+
+        // D <seq> <crc> <data>
+        char *field = line + 2;
+        char *end;
+        uint32_t seq = strtoul(field, &end, 16);
+        bool valid = line[0] == 'D' && line[1] == ' ' && end != field && *end == ' ';
+        uint32_t frame_crc = valid ? strtoul(field = end + 1, &end, 16) : 0;
+        valid = valid && end != field && *end == ' ';
+        int len = valid ? _base64_decode(end + 1, data, sizeof(data)) : -1;
+        int32_t expected_len = min(size - received, FILESYSTEM_XFER_CHUNK_SIZE);
+
+        if (valid && seq < expected) {
+            // a retransmission of something we already have; the ack must have been lost.
+            _xfer_reply("A %lx\r\n", expected - 1);
+        } else if (valid && seq == expected && len == expected_len && _xfer_crc(0, data, len) == frame_crc) {
+            if (lfs_file_write(volume, &file, data, len) != len) {
+                error = "write";
+                break;
+            }
+            crc = _xfer_crc(crc, data, len);
+            received += len;
+            retries = 0;
+            _xfer_reply("A %lx\r\n", expected++);
+        } else if (nak_sent != (int32_t)expected) {
+            // corrupted or out of order; everything after it will be discarded until the host goes back.
+            nak_sent = expected;
+            _xfer_reply("N %lx\r\n", expected);
+        }
+    }
+
+    if (lfs_file_close(volume, &file) < 0 && error == NULL) error = "write";
+
+    if (error) {
+        lfs_remove(volume, path);
+        printf("ERR %s\r\n", error);
+        return -1;
+    }
+    printf("OK %ld %08lx\r\n", received, crc);
+    return 0;
+}
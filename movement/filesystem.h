@@ -30,11 +30,24 @@
 
 /** @brief Initializes and mounts the tiny 8kb filesystem, formatting it if need be.
   * @return true if the filesystem was mounted successfully.
+  * @note On sensor boards with an SPI flash chip, paths starting with /ext refer to a second, much larger volume
+  *       on that chip. It is mounted the first time such a path is used, and must be created once from the shell
+  *       with "format /ext YES". Calls on /ext paths fail if there is no chip or no filesystem on it.
   */
 bool filesystem_init(void);
 
+/** @brief Checks whether a filesystem operation is in progress.
+  * @return true if the main loop is in the middle of a filesystem call. Code that runs in an interrupt, like USB
+  *         mass storage, must not touch the filesystem while this is true. Always false unless the firmware is
+  *         built with USB_MSC=1.
+  */
+bool filesystem_is_busy(void);
+
 /** @brief Gets the space available on the filesystem.
-  * @return the free space in bytes
+  * @return the free space in bytes, or a negative error code.
+  * @details This is cheap enough to call on every write, i.e. to decide when to rotate a log. The value comes from
+  *          a running count of blocks in use, which may briefly understate the free space after a write; it's
+  *          brought up to date whenever it gets low, or after a file is removed or overwritten.
   */
 int32_t filesystem_get_free_space(void);
 
@@ -102,5 +115,7 @@ int filesystem_cmd_df(int argc, char *argv[]);
 int filesystem_cmd_rm(int argc, char *argv[]);
 int filesystem_cmd_format(int argc, char *argv[]);
 int filesystem_cmd_echo(int argc, char *argv[]);
+int filesystem_cmd_get(int argc, char *argv[]);
+int filesystem_cmd_put(int argc, char *argv[]);
 
 #endif // FILESYSTEM_H_
@@ -0,0 +1,454 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "filesystem_fat.h"
+#ifdef WATCH_USB_MSC
+#include "filesystem.h"
+#include "tusb.h"
+#endif
+
+#if (FILESYSTEM_FAT_NUM_CLUSTERS + 2) * 3 / 2 > FILESYSTEM_FAT_SECTOR_SIZE
+#error "The FAT must fit in a single sector."
+#endif
+
+#define FAT_ATTR_READ_ONLY 0x01
+#define FAT_ATTR_VOLUME_ID 0x08
+#define FAT_ATTR_ARCHIVE 0x20
+#define FAT_ATTR_LONG_NAME 0x0F
+// Windows NT and Linux use these bits of the reserved byte to show an all-lowercase 8.3 name in lowercase.
+#define FAT_CASE_LOWER_BASE 0x08
+#define FAT_CASE_LOWER_EXT 0x10
+#define FAT_LFN_CHARS 13
+#define FAT_LFN_LAST 0x40
+// littlefs doesn't keep timestamps, so every file is dated 2024-01-01 00:00.
+#define FAT_DATE (((2024 - 1980) << 9) | (1 << 5) | 1)
+#define FAT_VOLUME_LABEL "SENSORWATCH"
+
+typedef struct {
+    uint32_t size;
+    uint16_t cluster;       // first cluster, or 0 for an empty file
+    uint8_t entries;        // directory entries, including any long name entries
+    uint8_t short_name[11];
+    uint8_t case_flags;
+} filesystem_fat_file_t;
+
+static lfs_t *_lfs;
+static volatile bool _stale = true;
+static filesystem_fat_file_t _files[FILESYSTEM_FAT_MAX_FILES];
+static uint8_t _num_files;
+
+// data reads happen from the USB interrupt, so they get their own handles and don't touch the heap.
+static lfs_dir_t _dir;
+static lfs_file_t _file;
+static struct lfs_info _info;
+static uint8_t _file_buffer[64];
+
+static inline void _put16(uint8_t *p, uint16_t value) {
+    p[0] = value;
+    p[1] = value >> 8;
+}
+
+static inline void _put32(uint8_t *p, uint32_t value) {
+    _put16(p, value);
+    _put16(p + 2, value >> 16);
+}
+
+static inline uint16_t _clusters(uint32_t size) {
+    return (size + FILESYSTEM_FAT_SECTOR_SIZE - 1) / FILESYSTEM_FAT_SECTOR_SIZE;
+}
+
+static bool _is_valid_char(char c) {
+    // '~' is allowed in 8.3 names, but we reserve it for the names we generate so they can't collide.
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || (c && strchr("!#$%&'()-@^_`{}", c));
+}
+
+static inline char _upper(char c) {
+    return (c >= 'a' && c <= 'z') ? c - 'a' + 'A' : c;
+}
+
+// checks that a name part has valid characters only, in a single case, and returns the case flag to use for it.
+static bool _check_part(const char *part, size_t len, size_t max_len, uint8_t lower_flag, uint8_t *case_flags) {
+    bool upper = false, lower = false;
+
+    if (len > max_len) return false;
+    for(size_t i = 0; i < len; i++) {
+        if (!_is_valid_char(part[i])) return false;
+        if (part[i] >= 'a' && part[i] <= 'z') lower = true;
+        if (part[i] >= 'A' && part[i] <= 'Z') upper = true;
+    }
+    if (lower && upper) return false;
+    if (lower) *case_flags |= lower_flag;
+
+    return true;
+}
+
+// fills in the file's 8.3 name, and returns true if it also needs long name entries to show the real name.
+static bool _make_short_name(const char *name, uint8_t index, filesystem_fat_file_t *file) {
+    const char *dot = strrchr(name, '.');
+    if (dot == name) dot = NULL;
+    size_t base_len = dot ? (size_t)(dot - name) : strlen(name);
+    const char *ext = dot ? dot + 1 : name + base_len;
+    size_t ext_len = strlen(ext);
+
+    memset(file->short_name, ' ', sizeof(file->short_name));
+    file->case_flags = 0;
+
+    if (base_len > 0 && _check_part(name, base_len, 8, FAT_CASE_LOWER_BASE, &file->case_flags) &&
+                        _check_part(ext, ext_len, 3, FAT_CASE_LOWER_EXT, &file->case_flags)) {
+        for(size_t i = 0; i < base_len; i++) file->short_name[i] = _upper(name[i]);
+        for(size_t i = 0; i < ext_len; i++) file->short_name[8 + i] = _upper(ext[i]);
+        return false;
+    }
+
+    // otherwise, make up a name like LONGNA~7.TXT, numbered by the file's position so it's always unique.
+    char tail[5];
+    uint8_t tail_len = 0;
+    uint8_t len = 0;
+    uint8_t n = index + 1;
+    tail[tail_len++] = '~';
+    if (n >= 100) tail[tail_len++] = '0' + n / 100;
+    if (n >= 10) tail[tail_len++] = '0' + (n / 10) % 10;
+    tail[tail_len++] = '0' + n % 10;
+    for(size_t i = 0; i < base_len && len < 8 - tail_len; i++) {
+        if (_is_valid_char(name[i])) file->short_name[len++] = _upper(name[i]);
+    }
+    memcpy(file->short_name + len, tail, tail_len);
+    len = 0;
+    for(size_t i = 0; i < ext_len && len < 3; i++) {
+        if (_is_valid_char(ext[i])) file->short_name[8 + len++] = _upper(ext[i]);
+    }
+    file->case_flags = 0;
+
+    return true;
+}
+
+// advances to the next regular file in the directory. returns 1 if there is one, 0 at the end, or an error.
+static int _next_file(void) {
+    int err;
+    while ((err = lfs_dir_read(_lfs, &_dir, &_info)) > 0) {
+        if (_info.type == LFS_TYPE_REG) return 1;
+    }
+    return err;
+}
+
+void filesystem_fat_init(lfs_t *lfs) {
+    _lfs = lfs;
+    _stale = true;
+    _num_files = 0;
+}
+
+void filesystem_fat_invalidate(void) {
+    _stale = true;
+}
+
+bool filesystem_fat_is_stale(void) {
+    return _stale;
+}
+
+bool filesystem_fat_refresh(void) {
+    uint16_t cluster = 2;
+    uint16_t entries = 1;   // the volume label
+    int err = 0;
+
+    _num_files = 0;
+    _stale = false;
+    if (lfs_dir_open(_lfs, &_dir, "/") < 0) return false;
+
+    while (_num_files < FILESYSTEM_FAT_MAX_FILES && (err = _next_file()) > 0) {
+        filesystem_fat_file_t *file = &_files[_num_files];
+        uint16_t clusters = _clusters(_info.size);
+
+        file->entries = 1;
+        if (_make_short_name(_info.name, _num_files, file)) {
+            file->entries += (strlen(_info.name) + FAT_LFN_CHARS - 1) / FAT_LFN_CHARS;
+        }
+        // stop at the first file that doesn't fit, so the directory can be rebuilt by reading the same number of files.
+        if (entries + file->entries > FILESYSTEM_FAT_ROOT_ENTRIES) break;
+        if (cluster + clusters > FILESYSTEM_FAT_NUM_CLUSTERS + 2) break;
+
+        file->size = _info.size;
+        file->cluster = clusters ? cluster : 0;
+        cluster += clusters;
+        entries += file->entries;
+        _num_files++;
+    }
+    lfs_dir_close(_lfs, &_dir);
+
+    return err >= 0;
+}
+
+static void _read_boot_sector(uint8_t *buffer) {
+    static const uint8_t jump[] = { 0xEB, 0x3C, 0x90 };
+    memcpy(buffer, jump, sizeof(jump));
+    memcpy(buffer + 3, "MSWIN4.1", 8);
+    _put16(buffer + 11, FILESYSTEM_FAT_SECTOR_SIZE);
+    buffer[13] = 1;                                     // sectors per cluster
+    _put16(buffer + 14, FILESYSTEM_FAT_FAT_START);      // reserved sectors
+    buffer[16] = 2;                                     // number of FATs
+    _put16(buffer + 17, FILESYSTEM_FAT_ROOT_ENTRIES);
+    _put16(buffer + 19, FILESYSTEM_FAT_NUM_SECTORS);
+    buffer[21] = 0xF8;                                  // media descriptor: fixed disk
+    _put16(buffer + 22, 1);                             // sectors per FAT
+    _put16(buffer + 24, 1);                             // sectors per track
+    _put16(buffer + 26, 1);                             // heads
+    buffer[36] = 0x80;                                  // drive number
+    buffer[38] = 0x29;                                  // extended boot signature
+    _put32(buffer + 39, 0x5357A7C4);                    // volume serial number
+    memcpy(buffer + 43, FAT_VOLUME_LABEL, 11);
+    memcpy(buffer + 54, "FAT12   ", 8);
+    buffer[510] = 0x55;
+    buffer[511] = 0xAA;
+}
+
+static void _read_fat(uint8_t *buffer) {
+    uint16_t entry = 0;
+
+    for(uint16_t cluster = 0; cluster < FILESYSTEM_FAT_NUM_CLUSTERS + 2; cluster++) {
+        uint16_t value = 0;
+        if (cluster == 0) value = 0xFF8;
+        else if (cluster == 1) value = 0xFFF;
+        while (entry < _num_files && (_files[entry].cluster == 0 || _files[entry].cluster + _clusters(_files[entry].size) <= cluster)) entry++;
+        if (cluster >= 2 && entry < _num_files && cluster >= _files[entry].cluster) {
+            // files are contiguous, so each cluster points to the next one until the end of the file.
+            value = (cluster + 1 == _files[entry].cluster + _clusters(_files[entry].size)) ? 0xFFF : cluster + 1;
+        }
+
+        uint16_t offset = cluster * 3 / 2;
+        if (cluster & 1) {
+            buffer[offset] |= (value << 4) & 0xF0;
+            buffer[offset + 1] = value >> 4;
+        } else {
+            buffer[offset] = value;
+            buffer[offset + 1] = (value >> 8) & 0x0F;
+        }
+    }
+}
+
+static void _write_entry(uint8_t *out, const filesystem_fat_file_t *file, const char *name, uint8_t k) {
+    if (k == file->entries - 1) {
+        memcpy(out, file->short_name, 11);
+        out[11] = FAT_ATTR_READ_ONLY | FAT_ATTR_ARCHIVE;
+        out[12] = file->case_flags;
+        _put16(out + 16, FAT_DATE);     // created
+        _put16(out + 18, FAT_DATE);     // accessed
+        _put16(out + 24, FAT_DATE);     // modified
+        _put16(out + 26, file->cluster);
+        _put32(out + 28, file->size);
+        return;
+    }
+
+    // long name entries come first, in reverse order, and each holds 13 UCS-2 characters in three pieces.
+    static const uint8_t char_offsets[FAT_LFN_CHARS] = { 1, 3, 5, 7, 9, 14, 16, 18, 20, 22, 24, 28, 30 };
+    uint8_t ordinal = file->entries - 1 - k;
+    size_t len = strlen(name);
+    uint8_t checksum = 0;
+
+    for(uint8_t i = 0; i < 11; i++) checksum = ((checksum & 1) << 7) + (checksum >> 1) + file->short_name[i];
+    out[0] = ordinal | (k == 0 ? FAT_LFN_LAST : 0);
+    out[11] = FAT_ATTR_LONG_NAME;
+    out[13] = checksum;
+    for(uint8_t i = 0; i < FAT_LFN_CHARS; i++) {
+        size_t pos = (ordinal - 1) * FAT_LFN_CHARS + i;
+        uint16_t c;
+        if (pos < len) c = (name[pos] & 0x80) ? '_' : name[pos];  // only ASCII names are shown faithfully
+        else if (pos == len) c = 0;
+        else c = 0xFFFF;
+        _put16(out + char_offsets[i], c);
+    }
+}
+
+static bool _read_root(uint32_t sector, uint8_t *buffer) {
+    const uint16_t first = sector * FILESYSTEM_FAT_SECTOR_SIZE / 32;
+    const uint16_t last = first + FILESYSTEM_FAT_SECTOR_SIZE / 32;
+    uint16_t position = 1;
+    bool ok = true;
+
+    if (first == 0) {
+        memcpy(buffer, FAT_VOLUME_LABEL, 11);
+        buffer[11] = FAT_ATTR_VOLUME_ID;
+    }
+
+    if (lfs_dir_open(_lfs, &_dir, "/") < 0) return false;
+    for(uint8_t i = 0; i < _num_files && position < last; i++) {
+        if (_next_file() <= 0) {
+            ok = false;
+            break;
+        }
+        for(uint8_t k = 0; k < _files[i].entries; k++, position++) {
+            if (position >= first && position < last) _write_entry(buffer + (position - first) * 32, &_files[i], _info.name, k);
+        }
+    }
+    lfs_dir_close(_lfs, &_dir);
+
+    return ok;
+}
+
+static bool _read_data(uint16_t cluster, uint8_t *buffer) {
+    uint8_t i;
+    for(i = 0; i < _num_files; i++) {
+        if (_files[i].cluster && cluster >= _files[i].cluster && cluster < _files[i].cluster + _clusters(_files[i].size)) break;
+    }
+    // clusters that don't belong to any file read as zeroes.
+    if (i == _num_files) return true;
+
+    // find the file's name; it's the i'th file in the directory.
+    if (lfs_dir_open(_lfs, &_dir, "/") < 0) return false;
+    for(uint8_t j = 0; j <= i; j++) {
+        if (_next_file() <= 0) {
+            lfs_dir_close(_lfs, &_dir);
+            return false;
+        }
+    }
+    lfs_dir_close(_lfs, &_dir);
+
+    struct lfs_file_config config = {0};
+    if (_lfs->cfg->cache_size <= sizeof(_file_buffer)) config.buffer = _file_buffer;
+    if (lfs_file_opencfg(_lfs, &_file, _info.name, LFS_O_RDONLY, &config) < 0) return false;
+
+    uint32_t offset = (uint32_t)(cluster - _files[i].cluster) * FILESYSTEM_FAT_SECTOR_SIZE;
+    uint32_t size = _files[i].size - offset;
+    if (size > FILESYSTEM_FAT_SECTOR_SIZE) size = FILESYSTEM_FAT_SECTOR_SIZE;
+    bool ok = lfs_file_seek(_lfs, &_file, offset, LFS_SEEK_SET) >= 0 &&
+              lfs_file_read(_lfs, &_file, buffer, size) >= 0;
+    lfs_file_close(_lfs, &_file);
+
+    return ok;
+}
+
+bool filesystem_fat_read_sector(uint32_t lba, uint8_t *buffer) {
+    memset(buffer, 0, FILESYSTEM_FAT_SECTOR_SIZE);
+
+    if (lba == 0) {
+        _read_boot_sector(buffer);
+        return true;
+    } else if (lba < FILESYSTEM_FAT_ROOT_START) {
+        _read_fat(buffer);
+        return true;
+    } else if (lba < FILESYSTEM_FAT_DATA_START) {
+        return _read_root(lba - FILESYSTEM_FAT_ROOT_START, buffer);
+    } else if (lba < FILESYSTEM_FAT_NUM_SECTORS) {
+        return _read_data(lba - FILESYSTEM_FAT_DATA_START + 2, buffer);
+    }
+
+    return false;
+}
+
+#ifdef WATCH_USB_MSC
+
+// TinyUSB mass storage callbacks. These run in the USB interrupt, which may have interrupted the main loop in the
+// middle of a littlefs operation; in that case we tell the host to come back later rather than touch the volume.
+
+static bool _check_medium(uint8_t lun) {
+    if (_lfs == NULL || filesystem_is_busy()) {
+        tud_msc_set_sense(lun, SCSI_SENSE_NOT_READY, 0x04, 0x01);   // becoming ready
+        return false;
+    }
+    if (filesystem_fat_is_stale()) {
+        filesystem_fat_refresh();
+        tud_msc_set_sense(lun, SCSI_SENSE_UNIT_ATTENTION, 0x28, 0x00);  // medium may have changed
+        return false;
+    }
+
+    return true;
+}
+
+void tud_msc_inquiry_cb(uint8_t lun, uint8_t vendor_id[8], uint8_t product_id[16], uint8_t product_rev[4]) {
+    (void) lun;
+    memcpy(vendor_id, "TinyUSB ", 8);
+    memcpy(product_id, "Sensor Watch    ", 16);
+    memcpy(product_rev, "1.0 ", 4);
+}
+
+bool tud_msc_test_unit_ready_cb(uint8_t lun) {
+    return _check_medium(lun);
+}
+
+void tud_msc_capacity_cb(uint8_t lun, uint32_t *block_count, uint16_t *block_size) {
+    (void) lun;
+    *block_count = FILESYSTEM_FAT_NUM_SECTORS;
+    *block_size = FILESYSTEM_FAT_SECTOR_SIZE;
+}
+
+bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, bool load_eject) {
+    (void) lun;
+    (void) power_condition;
+    (void) start;
+    (void) load_eject;
+    return true;
+}
+
+bool tud_msc_is_writable_cb(uint8_t lun) {
+    (void) lun;
+    return false;
+}
+
+int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void *buffer, uint32_t bufsize) {
+    static uint8_t sector[FILESYSTEM_FAT_SECTOR_SIZE];
+
+    // returning 0 makes TinyUSB retry the read later.
+    if (_lfs == NULL || filesystem_is_busy()) return 0;
+    if (!_check_medium(lun)) return -1;
+
+    uint32_t done = 0;
+    while (done < bufsize) {
+        uint32_t len = FILESYSTEM_FAT_SECTOR_SIZE - offset;
+        if (len > bufsize - done) len = bufsize - done;
+        if (!filesystem_fat_read_sector(lba, sector)) {
+            tud_msc_set_sense(lun, SCSI_SENSE_MEDIUM_ERROR, 0x11, 0x00);   // unrecovered read error
+            return -1;
+        }
+        memcpy((uint8_t *)buffer + done, sector + offset, len);
+        done += len;
+        offset = 0;
+        lba++;
+    }
+
+    return done;
+}
+
+int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *buffer, uint32_t bufsize) {
+    (void) lba;
+    (void) offset;
+    (void) buffer;
+    (void) bufsize;
+    // the drive is read only; use the put shell command to copy files to the watch.
+    tud_msc_set_sense(lun, SCSI_SENSE_DATA_PROTECT, 0x27, 0x00);
+    return -1;
+}
+
+int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const scsi_cmd[16], void *buffer, uint16_t bufsize) {
+    (void) buffer;
+    (void) bufsize;
+
+    switch (scsi_cmd[0]) {
+        case SCSI_CMD_PREVENT_ALLOW_MEDIUM_REMOVAL:
+            return 0;
+        default:
+            tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x20, 0x00);
+            return -1;
+    }
+}
+
+#endif // WATCH_USB_MSC
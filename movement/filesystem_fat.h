@@ -0,0 +1,79 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef FILESYSTEM_FAT_H_
+#define FILESYSTEM_FAT_H_
+#include <stdbool.h>
+#include <stdint.h>
+#include "lfs.h"
+
+// A read-only FAT12 view of the littlefs volume, for USB mass storage.
+// Nothing is stored in FAT format. Instead, filesystem_fat_refresh takes a snapshot of the files in the
+// root directory (their sizes and where their data will appear on the disk), and the boot sector, FATs and
+// directory are synthesized from that snapshot whenever the host reads them. Data sectors are read straight
+// out of the corresponding littlefs file. Every file gets a contiguous run of clusters in directory order,
+// so the FAT is just a set of linear chains.
+//
+// Files whose names don't fit 8.3 get long file name entries, so the host shows the name they have on the
+// watch. Subdirectories are not shown, and files that don't fit in the root directory or the data area are
+// left out. The host sees a snapshot: any write to the littlefs volume marks it stale, and the USB glue
+// rebuilds it and tells the host the medium has changed.
+
+#define FILESYSTEM_FAT_SECTOR_SIZE 512
+#define FILESYSTEM_FAT_ROOT_ENTRIES 64
+#define FILESYSTEM_FAT_NUM_CLUSTERS 128
+#define FILESYSTEM_FAT_MAX_FILES 32
+
+// boot sector, two copies of a one-sector FAT, the root directory, then one sector per cluster.
+#define FILESYSTEM_FAT_FAT_START 1
+#define FILESYSTEM_FAT_ROOT_START 3
+#define FILESYSTEM_FAT_ROOT_SECTORS (FILESYSTEM_FAT_ROOT_ENTRIES * 32 / FILESYSTEM_FAT_SECTOR_SIZE)
+#define FILESYSTEM_FAT_DATA_START (FILESYSTEM_FAT_ROOT_START + FILESYSTEM_FAT_ROOT_SECTORS)
+#define FILESYSTEM_FAT_NUM_SECTORS (FILESYSTEM_FAT_DATA_START + FILESYSTEM_FAT_NUM_CLUSTERS)
+
+/** @brief Sets the littlefs volume to expose. It must already be mounted. The view starts out stale.
+  */
+void filesystem_fat_init(lfs_t *lfs);
+
+/** @brief Marks the snapshot as out of date. Called whenever the littlefs volume is written.
+  */
+void filesystem_fat_invalidate(void);
+
+/** @brief Returns true if the volume has changed since the last call to filesystem_fat_refresh.
+  */
+bool filesystem_fat_is_stale(void);
+
+/** @brief Takes a new snapshot of the files in the root directory of the littlefs volume.
+  * @return true if the directory could be read; false otherwise.
+  */
+bool filesystem_fat_refresh(void);
+
+/** @brief Synthesizes one sector of the FAT volume.
+  * @param lba The sector to read, from 0 to FILESYSTEM_FAT_NUM_SECTORS - 1.
+  * @param buffer A buffer of FILESYSTEM_FAT_SECTOR_SIZE bytes.
+  * @return true if the sector was read successfully; false if the sector doesn't exist or littlefs failed.
+  */
+bool filesystem_fat_read_sector(uint32_t lba, uint8_t *buffer);
+
+#endif // FILESYSTEM_FAT_H_
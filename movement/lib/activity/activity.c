@@ -0,0 +1,140 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "activity.h"
+
+// half-swing of the filtered magnitude that counts as a step, about 0.08 g.
+#define STEP_THRESHOLD (ACTIVITY_ONE_G * 8 / 100)
+// mean filtered magnitude over a window, below which there's no movement to speak of (0.02 g), and above
+// which a fast cadence is running rather than brisk walking (0.25 g).
+#define STILL_ENERGY (ACTIVITY_ONE_G * 2 / 100)
+#define RUNNING_ENERGY (ACTIVITY_ONE_G * 25 / 100)
+// steps per four second window: three or more is walking; ten or more (150 per minute) may be running.
+#define WINDOW_SECONDS 4
+#define WALKING_STEPS 3
+#define RUNNING_STEPS 10
+
+const char activity_type_codes[ACTIVITY_NUM_TYPES][3] = {
+    "ID",   // Idle
+    "WA",   // Walking
+    "RU",   // Running
+};
+
+static uint16_t _isqrt(uint32_t value) {
+    uint32_t result = 0;
+    uint32_t bit = 1UL << 30;
+
+    for(uint8_t i = 0; i < 16; i++) {
+        if (value >= result + bit) {
+            value -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return result;
+}
+
+static void _activity_step(activity_state_t *state) {
+    if (state->since_last_step > state->max_step_interval) state->step_run = 0;
+    state->since_last_step = 0;
+
+    // hold back the first few steps of a run until it's clear it is one, then count them all at once.
+    if (state->step_run < ACTIVITY_MIN_STEP_RUN) {
+        state->step_run++;
+        if (state->step_run == ACTIVITY_MIN_STEP_RUN) {
+            state->steps += ACTIVITY_MIN_STEP_RUN;
+            state->window_steps += ACTIVITY_MIN_STEP_RUN;
+        }
+    } else {
+        state->steps++;
+        state->window_steps++;
+    }
+}
+
+static void _activity_classify(activity_state_t *state) {
+    activity_type_t activity;
+    // compare the window's total instead of dividing it by the window length.
+    uint32_t energy = state->window_energy;
+    uint32_t length = state->window_length;
+
+    if (state->window_steps >= RUNNING_STEPS && energy >= RUNNING_ENERGY * length) activity = ACTIVITY_RUNNING;
+    else if (state->window_steps >= WALKING_STEPS && energy >= STILL_ENERGY * length) activity = ACTIVITY_WALKING;
+    else activity = ACTIVITY_STILL;
+
+    state->current = activity;
+    state->samples[activity] += length;
+    state->window_position = 0;
+    state->window_steps = 0;
+    state->window_energy = 0;
+}
+
+void activity_init(activity_state_t *state, uint8_t sample_rate) {
+    memset(state, 0, sizeof(activity_state_t));
+    state->sample_rate = sample_rate;
+    if (sample_rate > 12) {
+        // gravity's low-pass has a time constant of 16 samples (0.64 s); smoothing is over 2 samples.
+        state->gravity_shift = 4;
+        state->smoothing_shift = 1;
+    } else {
+        // same time constants, roughly, with half as many samples.
+        state->gravity_shift = 3;
+        state->smoothing_shift = 0;
+    }
+    state->min_step_interval = sample_rate / 4;
+    state->max_step_interval = sample_rate * 2;
+    state->window_length = sample_rate * WINDOW_SECONDS;
+    state->gravity = (int32_t)ACTIVITY_ONE_G << 8;
+    state->since_last_step = UINT8_MAX;
+    state->current = ACTIVITY_STILL;
+}
+
+void activity_process(activity_state_t *state, const lis2dw_reading_t *readings, uint8_t count) {
+    for(uint8_t i = 0; i < count; i++) {
+        // from 16-bit raw values (8192 per g) to 512 per g, so the squares fit easily in 32 bits.
+        int32_t x = readings[i].x >> 4;
+        int32_t y = readings[i].y >> 4;
+        int32_t z = readings[i].z >> 4;
+        int32_t magnitude = _isqrt(x * x + y * y + z * z);
+        int32_t filtered;
+
+        state->gravity += ((magnitude << 8) - state->gravity) >> state->gravity_shift;
+        state->smoothed += (((magnitude << 8) - state->gravity) - state->smoothed) >> state->smoothing_shift;
+        filtered = state->smoothed >> 8;
+
+        if (state->since_last_step < UINT8_MAX) state->since_last_step++;
+        if (filtered < -STEP_THRESHOLD) {
+            state->armed = true;
+        } else if (state->armed && filtered > STEP_THRESHOLD && state->since_last_step >= state->min_step_interval) {
+            state->armed = false;
+            _activity_step(state);
+        }
+
+        state->window_energy += filtered < 0 ? -filtered : filtered;
+        if (++state->window_position >= state->window_length) _activity_classify(state);
+    }
+}
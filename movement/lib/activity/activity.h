@@ -0,0 +1,99 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ACTIVITY_H_
+#define ACTIVITY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "lis2dw.h"
+
+// Streaming step counter and activity classifier for batches of LIS2DW samples.
+// Each sample's magnitude goes through a band-pass filter: a slow low-pass tracks gravity and is subtracted
+// out, and a fast one smooths away jitter. A step is a swing of the filtered signal from below -threshold to
+// above +threshold, no sooner than a quarter second after the last. Steps only count once four of them
+// come in a row, each within two seconds of the last, so waving a hand around doesn't add up to a walk.
+// Every four seconds, the window's step count and mean filtered magnitude decide between still, walking
+// and running, and those four seconds go to that activity.
+//
+// Everything is integer arithmetic with shifts for the filter coefficients, and the work per sample is
+// fixed (the square root is 16 iterations), so a full FIFO of 32 samples takes a bounded few thousand
+// cycles. That's small enough to do right in the interrupt that drains the FIFO, all day long.
+//
+// The thresholds are starting points. accelerometer_data_acquisition_face records labeled data with the
+// same activity codes, for tuning them.
+
+/// Samples are expected at ±4 g, in any of the LIS2DW's modes; after scaling, this is 1 g.
+#define ACTIVITY_ONE_G 512
+/// The number of consecutive steps it takes to start counting them.
+#define ACTIVITY_MIN_STEP_RUN 4
+
+typedef enum {
+    ACTIVITY_STILL = 0,
+    ACTIVITY_WALKING,
+    ACTIVITY_RUNNING,
+    ACTIVITY_NUM_TYPES
+} activity_type_t;
+
+/// Two-letter codes for each activity, the same ones accelerometer_data_acquisition_face labels its data with.
+extern const char activity_type_codes[ACTIVITY_NUM_TYPES][3];
+
+typedef struct {
+    // totals since activity_init. they only ever go up, so you can read them at any time (even while an
+    // interrupt is adding to them) and subtract an earlier reading to get the count for a period.
+    volatile uint32_t steps;
+    volatile uint32_t samples[ACTIVITY_NUM_TYPES];  // samples spent in each activity; divide by the rate for seconds
+    volatile activity_type_t current;
+    // configuration, from the sample rate
+    uint8_t sample_rate;
+    uint8_t gravity_shift;
+    uint8_t smoothing_shift;
+    uint8_t min_step_interval;
+    uint8_t max_step_interval;
+    uint8_t window_length;
+    // filter and detector state
+    int32_t gravity;            // Q8
+    int32_t smoothed;           // Q8
+    bool armed;                 // seen the low side of a step
+    uint8_t since_last_step;
+    uint8_t step_run;
+    uint8_t window_position;
+    uint8_t window_steps;
+    uint32_t window_energy;
+} activity_state_t;
+
+/** @brief Resets the state and sets it up for a sample rate.
+  * @param state The state to set up.
+  * @param sample_rate The LIS2DW's output data rate, in Hz; 12 (for 12.5) and 25 are supported.
+  */
+void activity_init(activity_state_t *state, uint8_t sample_rate);
+
+/** @brief Runs a batch of samples through the pipeline, updating the step count and activity totals.
+  * @param state The state from activity_init.
+  * @param readings Raw readings, oldest first, i.e. from lis2dw_read_fifo.
+  * @param count The number of readings.
+  */
+void activity_process(activity_state_t *state, const lis2dw_reading_t *readings, uint8_t count);
+
+#endif // ACTIVITY_H_
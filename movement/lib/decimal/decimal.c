@@ -0,0 +1,842 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stddef.h>
+#include "decimal.h"
+
+#define MANTISSA_MIN 100000000
+#define MANTISSA_MAX 999999999
+
+// the exponent of a normalized number whose mantissa is 1.00000000 * 10^0.
+#define UNIT_EXPONENT (1 - DECIMAL_DIGITS)
+
+// 2.30 binary fixed point, used for the CORDIC routines.
+#define FIX_BITS 30
+#define FIX_ONE (1L << FIX_BITS)
+
+static const uint64_t _pow10[20] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+    10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+    1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL,
+    10000000000000000000ULL
+};
+
+// atan(2^-i), in 2.30 fixed point.
+static const int32_t _cordic_atan[FIX_BITS] = {
+    843314857, 497837829, 263043837, 133525159, 67021687, 33543516, 16775851, 8388437, 4194283, 2097149,
+    1048576, 524288, 262144, 131072, 65536, 32768, 16384, 8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16, 8,
+    4, 2
+};
+
+#define DECIMAL_HALF_PI DECIMAL(157079633, -8)
+// pi / 2 to 36 decimal places, in base 10^9 limbs, for range reduction. it has to be this long because a large
+// argument multiplies the error in pi / 2 by the number of quadrants it spans.
+#define LIMB_BASE 1000000000
+#define HALF_PI_LIMBS 5
+static const int64_t _half_pi_limbs[HALF_PI_LIMBS] = { 1, 570796326, 794896619, 231321691, 639751442 };
+#define DECIMAL_LN10 DECIMAL(230258509, -8)
+// ln(2) and ln(10) with 14 decimal places, for the fixed point parts of decimal_ln, decimal_exp and decimal_pow.
+#define LN2_FIXED 69314718055995LL
+#define LN10_FIXED 230258509299405LL
+
+static inline bool _is_special(decimal_t d) {
+    return d.exponent == DECIMAL_EXPONENT_SPECIAL;
+}
+
+static inline decimal_t _infinity(bool negative) {
+    return DECIMAL(negative ? -1 : 1, DECIMAL_EXPONENT_SPECIAL);
+}
+
+static uint8_t _count_digits(uint64_t u) {
+    uint8_t digits = 1;
+    while (digits < 20 && u >= _pow10[digits]) digits++;
+    return digits;
+}
+
+// divides by 10^shift, rounding halves away from zero.
+static uint64_t _round_shift(uint64_t u, uint8_t shift) {
+    if (shift == 0) return u;
+    if (shift > 19) return 0;
+    uint64_t q = u / _pow10[shift];
+    uint64_t r = u - q * _pow10[shift];
+    if (r >= (_pow10[shift] + 1) / 2) q++;
+    return q;
+}
+
+// the one place where numbers get normalized: takes any 64-bit mantissa and an exponent, rounds the mantissa
+// to DECIMAL_DIGITS digits, and checks for overflow and underflow.
+static decimal_t _make(bool negative, uint64_t u, int32_t exponent) {
+    if (u == 0) return DECIMAL_ZERO;
+
+    uint8_t digits = _count_digits(u);
+    if (digits > DECIMAL_DIGITS) {
+        uint8_t shift = digits - DECIMAL_DIGITS;
+        u = _round_shift(u, shift);
+        exponent += shift;
+        if (u > MANTISSA_MAX) {
+            // rounded up to 1000000000
+            u /= 10;
+            exponent++;
+        }
+    } else {
+        u *= _pow10[DECIMAL_DIGITS - digits];
+        exponent -= DECIMAL_DIGITS - digits;
+    }
+
+    if (exponent - UNIT_EXPONENT >= DECIMAL_EXPONENT_LIMIT) return _infinity(negative);
+    if (exponent - UNIT_EXPONENT <= -DECIMAL_EXPONENT_LIMIT) return DECIMAL_ZERO;
+
+    return DECIMAL(negative ? -(int32_t)u : (int32_t)u, exponent);
+}
+
+static inline decimal_t _make_signed(int64_t m, int32_t exponent) {
+    return m < 0 ? _make(true, -(uint64_t)m, exponent) : _make(false, m, exponent);
+}
+
+static inline uint32_t _abs_mantissa(decimal_t d) {
+    return d.mantissa < 0 ? -(uint32_t)d.mantissa : (uint32_t)d.mantissa;
+}
+
+// makes sure the mantissa has exactly DECIMAL_DIGITS digits, so inputs built with DECIMAL() can be compared.
+static inline decimal_t _normalize(decimal_t d) {
+    if (_is_special(d) || d.mantissa == 0) return d;
+    if (_abs_mantissa(d) >= MANTISSA_MIN) return d;
+    return _make_signed(d.mantissa, d.exponent);
+}
+
+decimal_t decimal_from_int(int32_t i) {
+    return _make_signed(i, 0);
+}
+
+bool decimal_is_nan(decimal_t d) {
+    return _is_special(d) && d.mantissa == 0;
+}
+
+bool decimal_is_inf(decimal_t d) {
+    return _is_special(d) && d.mantissa != 0;
+}
+
+bool decimal_is_zero(decimal_t d) {
+    return !_is_special(d) && d.mantissa == 0;
+}
+
+bool decimal_is_negative(decimal_t d) {
+    return d.mantissa < 0;
+}
+
+decimal_t decimal_neg(decimal_t d) {
+    d.mantissa = -d.mantissa;
+    return d;
+}
+
+decimal_t decimal_abs(decimal_t d) {
+    if (d.mantissa < 0) d.mantissa = -d.mantissa;
+    return d;
+}
+
+int16_t decimal_get_magnitude(decimal_t d) {
+    if (_is_special(d) || d.mantissa == 0) return 0;
+    d = _normalize(d);
+    return d.exponent - UNIT_EXPONENT;
+}
+
+decimal_t decimal_add(decimal_t a, decimal_t b) {
+    if (_is_special(a) || _is_special(b)) {
+        if (decimal_is_nan(a) || decimal_is_nan(b)) return DECIMAL_NAN;
+        if (_is_special(a) && _is_special(b) && a.mantissa != b.mantissa) return DECIMAL_NAN; // inf - inf
+        return _is_special(a) ? a : b;
+    }
+    if (a.mantissa == 0) return _normalize(b);
+    if (b.mantissa == 0) return _normalize(a);
+
+    a = _normalize(a);
+    b = _normalize(b);
+    if (a.exponent < b.exponent) {
+        decimal_t temp = a;
+        a = b;
+        b = temp;
+    }
+
+    // scale the larger number up as far as we can (9 more digits still fits in 63 bits), then round the smaller
+    // one to match. if they're more than 18 digits apart, b can't change the result.
+    uint32_t diff = a.exponent - b.exponent;
+    if (diff > 2 * DECIMAL_DIGITS) return a;
+    uint8_t up = diff > DECIMAL_DIGITS ? DECIMAL_DIGITS : diff;
+    int64_t ma = (int64_t)a.mantissa * (int64_t)_pow10[up];
+    int64_t mb = (int64_t)_round_shift(_abs_mantissa(b), diff - up);
+    if (b.mantissa < 0) mb = -mb;
+
+    return _make_signed(ma + mb, a.exponent - up);
+}
+
+decimal_t decimal_sub(decimal_t a, decimal_t b) {
+    return decimal_add(a, decimal_neg(b));
+}
+
+decimal_t decimal_mul(decimal_t a, decimal_t b) {
+    bool negative = (a.mantissa < 0) != (b.mantissa < 0);
+
+    if (decimal_is_nan(a) || decimal_is_nan(b)) return DECIMAL_NAN;
+    if (_is_special(a) || _is_special(b)) {
+        if (decimal_is_zero(a) || decimal_is_zero(b)) return DECIMAL_NAN; // inf * 0
+        return _infinity(negative);
+    }
+
+    return _make(negative, (uint64_t)_abs_mantissa(a) * _abs_mantissa(b), (int32_t)a.exponent + b.exponent);
+}
+
+decimal_t decimal_div(decimal_t a, decimal_t b) {
+    bool negative = (a.mantissa < 0) != (b.mantissa < 0);
+
+    if (decimal_is_nan(a) || decimal_is_nan(b)) return DECIMAL_NAN;
+    if (_is_special(a)) return _is_special(b) ? DECIMAL_NAN : _infinity(negative);
+    if (_is_special(b)) return DECIMAL_ZERO;
+    if (b.mantissa == 0) return a.mantissa == 0 ? DECIMAL_NAN : _infinity(negative);
+    if (a.mantissa == 0) return DECIMAL_ZERO;
+
+    a = _normalize(a);
+    b = _normalize(b);
+    // a 9-digit mantissa times 10^10 still fits in 64 bits unsigned, and leaves at least 10 digits of quotient.
+    uint64_t dividend = (uint64_t)_abs_mantissa(a) * _pow10[DECIMAL_DIGITS + 1];
+    uint64_t divisor = _abs_mantissa(b);
+    uint64_t q = dividend / divisor;
+    // fold the remainder into the last digit, so that an exact half isn't mistaken for one.
+    if (q % 10 == 5 && dividend % divisor) q++;
+
+    return _make(negative, q, (int32_t)a.exponent - b.exponent - DECIMAL_DIGITS - 1);
+}
+
+int8_t decimal_cmp(decimal_t a, decimal_t b) {
+    if (decimal_is_nan(a) || decimal_is_nan(b)) return 0;
+    if (_is_special(a) || _is_special(b)) {
+        int32_t sa = _is_special(a) ? a.mantissa : 0;
+        int32_t sb = _is_special(b) ? b.mantissa : 0;
+        if (sa == sb) return 0;
+        return sa > sb ? 1 : -1;
+    }
+
+    decimal_t diff = decimal_sub(a, b);
+    if (diff.mantissa == 0) return 0;
+    return diff.mantissa < 0 ? -1 : 1;
+}
+
+// splits a finite number into its integer part (truncated toward zero) and whether there was a fraction.
+static decimal_t _trunc(decimal_t d, bool *has_fraction) {
+    *has_fraction = false;
+    if (_is_special(d) || d.exponent >= 0) return d;
+    uint32_t shift = -d.exponent;
+    if (shift > DECIMAL_DIGITS) {
+        *has_fraction = d.mantissa != 0;
+        return DECIMAL_ZERO;
+    }
+    uint32_t m = _abs_mantissa(d);
+    uint32_t q = m / (uint32_t)_pow10[shift];
+    *has_fraction = q * (uint32_t)_pow10[shift] != m;
+
+    return _make(d.mantissa < 0, q, 0);
+}
+
+decimal_t decimal_floor(decimal_t d) {
+    bool has_fraction;
+    decimal_t t = _trunc(d, &has_fraction);
+    if (has_fraction && d.mantissa < 0) t = decimal_sub(t, DECIMAL_ONE);
+    return t;
+}
+
+decimal_t decimal_round(decimal_t d) {
+    bool has_fraction;
+    decimal_t half = DECIMAL(d.mantissa < 0 ? -5 : 5, -1);
+    if (_is_special(d) || d.exponent >= 0) return d;
+    return _trunc(decimal_add(d, half), &has_fraction);
+}
+
+bool decimal_to_fixed(decimal_t d, uint8_t decimals, int64_t *out) {
+    if (_is_special(d)) return false;
+
+    int32_t shift = (int32_t)d.exponent + decimals;
+    uint64_t u = _abs_mantissa(d);
+    if (u == 0) {
+        *out = 0;
+        return true;
+    }
+    if (shift >= 0) {
+        if (shift > 18 - _count_digits(u)) return false;
+        u *= _pow10[shift];
+    } else {
+        u = _round_shift(u, shift < -19 ? 20 : -shift);
+    }
+
+    *out = d.mantissa < 0 ? -(int64_t)u : (int64_t)u;
+    return true;
+}
+
+void decimal_to_digits(decimal_t d, uint8_t num_digits, int32_t *digits, int16_t *exponent) {
+    d = _normalize(d);
+    uint32_t u = _round_shift(_abs_mantissa(d), DECIMAL_DIGITS - num_digits);
+    int16_t magnitude = d.exponent - UNIT_EXPONENT;
+    if (u >= _pow10[num_digits]) {
+        // i.e. 9999.6 rounded to 4 digits
+        u /= 10;
+        magnitude++;
+    }
+
+    *digits = d.mantissa < 0 ? -(int32_t)u : (int32_t)u;
+    *exponent = magnitude;
+}
+
+decimal_t decimal_parse(const char *str, char **endptr) {
+    const char *p = str;
+    bool negative = false;
+    uint64_t u = 0;
+    int32_t exponent = 0;
+    uint8_t num_digits = 0;
+    uint8_t significant = 0;
+
+    while (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r') p++;
+    if (*p == '-' || *p == '+') negative = (*p++ == '-');
+
+    // keep up to 19 significant digits; _make rounds them down to 9.
+    for(bool fraction = false; ; p++) {
+        if (*p == '.' && !fraction) {
+            fraction = true;
+            continue;
+        }
+        if (*p < '0' || *p > '9') break;
+        num_digits++;
+        if (significant < 19) {
+            u = u * 10 + (*p - '0');
+            if (u) significant++;
+            if (fraction) exponent--;
+        } else if (!fraction) {
+            exponent++;
+        }
+    }
+
+    if (num_digits == 0) {
+        if (endptr) *endptr = (char *)str;
+        return DECIMAL_ZERO;
+    }
+
+    if (*p == 'e' || *p == 'E') {
+        const char *e = p + 1;
+        bool exponent_negative = false;
+        int32_t n = 0;
+        if (*e == '-' || *e == '+') exponent_negative = (*e++ == '-');
+        if (*e >= '0' && *e <= '9') {
+            while (*e >= '0' && *e <= '9') {
+                if (n < 100000) n = n * 10 + (*e - '0');
+                e++;
+            }
+            exponent += exponent_negative ? -n : n;
+            p = e;
+        }
+    }
+
+    if (endptr) *endptr = (char *)p;
+
+    return _make(negative, u, exponent);
+}
+
+void decimal_to_string(decimal_t d, char *buf) {
+    if (decimal_is_nan(d)) {
+        buf[0] = 'n'; buf[1] = 'a'; buf[2] = 'n'; buf[3] = '\0';
+        return;
+    }
+    if (d.mantissa < 0) *buf++ = '-';
+    if (_is_special(d)) {
+        buf[0] = 'i'; buf[1] = 'n'; buf[2] = 'f'; buf[3] = '\0';
+        return;
+    }
+    if (d.mantissa == 0) {
+        buf[0] = '0'; buf[1] = '\0';
+        return;
+    }
+
+    d = _normalize(d);
+    char digits[DECIMAL_DIGITS];
+    uint32_t u = _abs_mantissa(d);
+    uint8_t num_digits = DECIMAL_DIGITS;
+    for(int8_t i = DECIMAL_DIGITS - 1; i >= 0; i--) {
+        digits[i] = '0' + u % 10;
+        u /= 10;
+    }
+    while (num_digits > 1 && digits[num_digits - 1] == '0') num_digits--;
+
+    int16_t magnitude = d.exponent - UNIT_EXPONENT;
+    if (magnitude >= -4 && magnitude < DECIMAL_DIGITS) {
+        // positional notation
+        if (magnitude < 0) {
+            *buf++ = '0';
+            *buf++ = '.';
+            for(int16_t i = -1; i > magnitude; i--) *buf++ = '0';
+            for(uint8_t i = 0; i < num_digits; i++) *buf++ = digits[i];
+        } else {
+            for(uint8_t i = 0; i < num_digits || i <= magnitude; i++) {
+                if (i == magnitude + 1) *buf++ = '.';
+                *buf++ = i < num_digits ? digits[i] : '0';
+            }
+        }
+        *buf = '\0';
+        return;
+    }
+
+    // scientific notation
+    *buf++ = digits[0];
+    if (num_digits > 1) {
+        *buf++ = '.';
+        for(uint8_t i = 1; i < num_digits; i++) *buf++ = digits[i];
+    }
+    *buf++ = 'e';
+    *buf++ = magnitude < 0 ? '-' : '+';
+    if (magnitude < 0) magnitude = -magnitude;
+    if (magnitude >= 100) *buf++ = '0' + magnitude / 100;
+    if (magnitude >= 10) *buf++ = '0' + (magnitude / 10) % 10;
+    *buf++ = '0' + magnitude % 10;
+    *buf = '\0';
+}
+
+decimal_t decimal_sqrt(decimal_t d) {
+    if (decimal_is_nan(d) || d.mantissa < 0) return DECIMAL_NAN;
+    if (_is_special(d) || d.mantissa == 0) return d;
+
+    // scale the mantissa up to 18 or 19 digits, keeping the exponent even, then take the integer square root.
+    d = _normalize(d);
+    uint8_t up = (d.exponent % 2 == 0) ? 10 : 9;
+    uint64_t u = (uint64_t)d.mantissa * _pow10[up];
+    int32_t exponent = ((int32_t)d.exponent - up) / 2;
+
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > u) bit >>= 2;
+    while (bit) {
+        if (u >= root + bit) {
+            u -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    // round to nearest: u is now the remainder.
+    if (u > root) root++;
+
+    return _make(false, root, exponent);
+}
+
+// converts a number with a magnitude less than 2 to 2.30 fixed point.
+static int32_t _to_fix(decimal_t d) {
+    if (d.mantissa == 0) return 0;
+    d = _normalize(d);
+    uint64_t u = (uint64_t)_abs_mantissa(d) << FIX_BITS;
+    u = _round_shift(u, -d.exponent);
+    return d.mantissa < 0 ? -(int32_t)u : (int32_t)u;
+}
+
+static decimal_t _from_fix(int32_t x) {
+    int64_t scaled = (int64_t)x * (int64_t)_pow10[DECIMAL_DIGITS];
+    // arithmetic shift with rounding
+    scaled = (scaled + (1L << (FIX_BITS - 1))) >> FIX_BITS;
+    return _make_signed(scaled, -DECIMAL_DIGITS);
+}
+
+// vectoring mode: given x >= 0 and y with magnitudes no larger than 1, computes atan(y / x).
+static int32_t _cordic_vector(int32_t x, int32_t y) {
+    int32_t z = 0;
+
+    for(uint8_t i = 0; i < FIX_BITS; i++) {
+        int32_t dx = x >> i;
+        int32_t dy = y >> i;
+        if (y < 0) {
+            x -= dy;
+            y += dx;
+            z -= _cordic_atan[i];
+        } else {
+            x += dy;
+            y -= dx;
+            z += _cordic_atan[i];
+        }
+    }
+
+    return z;
+}
+
+// reduces an angle to the range -pi/4 to pi/4, and returns which quadrant it came from.
+static bool _reduce_angle(decimal_t d, decimal_t *reduced, uint8_t *quadrant) {
+    decimal_t n = decimal_round(decimal_div(d, DECIMAL_HALF_PI));
+    int64_t k;
+    // past this point, successive quadrants are less than one digit apart and the result is meaningless.
+    if (!decimal_to_fixed(n, 0, &k) || k > 100000000 || k < -100000000) return false;
+    *quadrant = k & 3;
+    if (k == 0) {
+        *reduced = d;
+        return true;
+    }
+
+    // |d| is at least pi / 4 here, so it has at most nine decimal places, and d * 10^9 is an exact integer.
+    // subtract k * pi / 2 from it limb by limb. with pi / 2 to 36 places, the result keeps nine significant
+    // digits however close d was to a multiple of pi / 2.
+    int64_t fixed;
+    decimal_to_fixed(d, 9, &fixed);
+    bool negative = fixed < 0;
+    uint64_t u = negative ? -(uint64_t)fixed : (uint64_t)fixed;
+    uint64_t quadrants = k < 0 ? -(uint64_t)k : (uint64_t)k;
+    int64_t limbs[HALF_PI_LIMBS] = { u / LIMB_BASE, u % LIMB_BASE, 0, 0, 0 };
+    for(uint8_t i = 0; i < HALF_PI_LIMBS; i++) limbs[i] -= (int64_t)quadrants * _half_pi_limbs[i];
+    for(uint8_t i = HALF_PI_LIMBS - 1; i > 0; i--) {
+        int64_t borrow = limbs[i] < 0 ? (-limbs[i] + LIMB_BASE - 1) / LIMB_BASE : 0;
+        limbs[i] += borrow * LIMB_BASE;
+        limbs[i - 1] -= borrow;
+    }
+    // the whole part is now 0 or -1; if it's -1, flip the sign so every limb is a positive fraction.
+    if (limbs[0] < 0) {
+        negative = !negative;
+        for(uint8_t i = 0; i < HALF_PI_LIMBS; i++) limbs[i] = -limbs[i];
+        for(uint8_t i = HALF_PI_LIMBS - 1; i > 0; i--) {
+            if (limbs[i] < 0) {
+                limbs[i] += LIMB_BASE;
+                limbs[i - 1]--;
+            }
+        }
+    }
+
+    // the first two limbs with anything in them hold at least ten significant digits.
+    uint8_t i = 1;
+    while (i < HALF_PI_LIMBS - 1 && limbs[i] == 0) i++;
+    uint64_t digits = (uint64_t)limbs[i] * LIMB_BASE + (i < HALF_PI_LIMBS - 1 ? (uint64_t)limbs[i + 1] : 0);
+    *reduced = _make(negative, digits, -9 * (int32_t)(i + 1));
+
+    return true;
+}
+
+// evaluates 1 - x2 / divisors[0] * (1 - x2 / divisors[1] * (1 - ...)), which is the shape of the Taylor series
+// for both sine and cosine.
+static decimal_t _alternating_series(decimal_t x2, const uint8_t *divisors, uint8_t count) {
+    decimal_t sum = DECIMAL_ONE;
+    while (count--) sum = decimal_sub(DECIMAL_ONE, decimal_mul(decimal_div(x2, DECIMAL(divisors[count], 0)), sum));
+    return sum;
+}
+
+// sin(x) = x(1 - x^2/(2*3)(1 - x^2/(4*5)(...))), and cos(x) = 1 - x^2/(1*2)(1 - x^2/(3*4)(...)). for |x| up to
+// pi / 4, these many terms leave the error below 10^-11, and unlike CORDIC, whose error is a fixed 10^-8 or
+// so, they keep all the relative precision of a small x.
+static const uint8_t _sin_divisors[] = { 6, 20, 42, 72, 110 };
+static const uint8_t _cos_divisors[] = { 2, 12, 30, 56, 90, 132 };
+
+// atan(x) = x(1 - x^2(1/3 - x^2(1/5 - x^2(1/7 - x^2/9)))), which is good to nine digits for |x| < 0.1.
+static decimal_t _atan_series(decimal_t x) {
+    decimal_t x2 = decimal_mul(x, x);
+    decimal_t sum = decimal_sub(DECIMAL(142857143, -9), decimal_div(x2, DECIMAL(9, 0)));
+    sum = decimal_sub(DECIMAL(2, -1), decimal_mul(x2, sum));
+    sum = decimal_sub(DECIMAL(333333333, -9), decimal_mul(x2, sum));
+    sum = decimal_sub(DECIMAL_ONE, decimal_mul(x2, sum));
+    return decimal_mul(x, sum);
+}
+
+static void _sin_cos(decimal_t d, decimal_t *sin_out, decimal_t *cos_out) {
+    decimal_t r;
+    uint8_t quadrant;
+
+    if (_is_special(d) || !_reduce_angle(d, &r, &quadrant)) {
+        *sin_out = *cos_out = DECIMAL_NAN;
+        return;
+    }
+
+    decimal_t r2 = decimal_mul(r, r);
+    decimal_t sin_r = decimal_mul(r, _alternating_series(r2, _sin_divisors, sizeof(_sin_divisors)));
+    decimal_t cos_r = _alternating_series(r2, _cos_divisors, sizeof(_cos_divisors));
+
+    switch (quadrant) {
+        case 0:
+            *sin_out = sin_r;
+            *cos_out = cos_r;
+            break;
+        case 1:
+            *sin_out = cos_r;
+            *cos_out = decimal_neg(sin_r);
+            break;
+        case 2:
+            *sin_out = decimal_neg(sin_r);
+            *cos_out = decimal_neg(cos_r);
+            break;
+        default:
+            *sin_out = decimal_neg(cos_r);
+            *cos_out = sin_r;
+            break;
+    }
+}
+
+decimal_t decimal_sin(decimal_t d) {
+    decimal_t s, c;
+    _sin_cos(d, &s, &c);
+    return s;
+}
+
+decimal_t decimal_cos(decimal_t d) {
+    decimal_t s, c;
+    _sin_cos(d, &s, &c);
+    return c;
+}
+
+decimal_t decimal_tan(decimal_t d) {
+    decimal_t s, c;
+    _sin_cos(d, &s, &c);
+    return decimal_div(s, c);
+}
+
+decimal_t decimal_atan2(decimal_t y, decimal_t x) {
+    if (decimal_is_nan(y) || decimal_is_nan(x)) return DECIMAL_NAN;
+    if (decimal_is_zero(x) && decimal_is_zero(y)) return DECIMAL_ZERO;
+
+    decimal_t angle;
+    if (_is_special(y) || _is_special(x)) {
+        if (_is_special(y) && _is_special(x)) return DECIMAL_NAN;
+        if (_is_special(x)) {
+            angle = DECIMAL_ZERO;
+        } else {
+            angle = DECIMAL_HALF_PI;
+            if (y.mantissa < 0) angle = decimal_neg(angle);
+            return angle;
+        }
+    } else {
+        // scale both to a magnitude of at most one...
+        decimal_t ax = decimal_abs(x);
+        decimal_t ay = decimal_abs(y);
+        decimal_t scale = decimal_cmp(ax, ay) >= 0 ? ax : ay;
+        // and halve them: the CORDIC gain is about 1.65, and the vector's length can be up to sqrt(2).
+        int32_t fx = _to_fix(decimal_div(ax, scale)) / 2;
+        int32_t fy = _to_fix(decimal_div(y, scale)) / 2;
+        // CORDIC's error is around 10^-8 no matter the size of the result, so near zero, use the series.
+        decimal_t ratio = decimal_div(y, ax);
+        if (decimal_is_zero(ratio) || decimal_get_magnitude(ratio) < -1) angle = _atan_series(ratio);
+        else angle = _from_fix(_cordic_vector(fx, fy));
+    }
+
+    if (x.mantissa < 0) {
+        // reflect into the left half plane.
+        angle = decimal_sub(y.mantissa < 0 ? decimal_neg(DECIMAL_PI) : DECIMAL_PI, angle);
+    }
+
+    return angle;
+}
+
+decimal_t decimal_atan(decimal_t d) {
+    return decimal_atan2(d, DECIMAL_ONE);
+}
+
+decimal_t decimal_asin(decimal_t d) {
+    if (decimal_cmp(decimal_abs(d), DECIMAL_ONE) > 0) return DECIMAL_NAN;
+    // 1 - x^2, as (1 - x)(1 + x) to keep precision near 1.
+    decimal_t c = decimal_sqrt(decimal_mul(decimal_sub(DECIMAL_ONE, d), decimal_add(DECIMAL_ONE, d)));
+    return decimal_atan2(d, c);
+}
+
+decimal_t decimal_acos(decimal_t d) {
+    if (decimal_cmp(decimal_abs(d), DECIMAL_ONE) > 0) return DECIMAL_NAN;
+    decimal_t s = decimal_sqrt(decimal_mul(decimal_sub(DECIMAL_ONE, d), decimal_add(DECIMAL_ONE, d)));
+    return decimal_atan2(s, d);
+}
+
+// computes ln(d) for a positive, finite d, split into ln(m / 2^halvings) + halvings * ln(2) + magnitude * ln(10),
+// where m / 2^halvings is in [0.75, 1.5). only the first part is returned, in fixed point with 18 decimal places,
+// so the caller can pick how precisely to add on the rest; that's still nine significant digits for the smallest
+// nonzero result, 1e-9.
+static int64_t _ln_series(decimal_t d, int8_t *halvings, int16_t *magnitude) {
+    d = _normalize(d);
+    *magnitude = d.exponent - UNIT_EXPONENT;
+
+    // m is in [1, 10); move it to [0.316, 3.16), so numbers close to 1 (i.e. 0.99999) don't lose their precision
+    // to cancellation, then find the power of two p that puts m / p in [0.75, 1.5), so the series below converges
+    // quickly. m itself isn't halved or doubled, since that could take it to ten digits and round off the last one.
+    decimal_t m = DECIMAL(d.mantissa, UNIT_EXPONENT);
+    decimal_t p = DECIMAL_ONE;
+    *halvings = 0;
+    if (d.mantissa >= 316227766) {
+        m.exponent--;
+        (*magnitude)++;
+    }
+    while (decimal_cmp(m, decimal_mul(p, DECIMAL(15, -1))) >= 0) {
+        p = decimal_add(p, p);
+        (*halvings)++;
+    }
+    while (decimal_cmp(m, decimal_mul(p, DECIMAL(75, -2))) < 0) {
+        p = decimal_mul(p, DECIMAL(5, -1));
+        (*halvings)--;
+    }
+
+    // ln(m / p) = 2 * atanh(t) = 2 * (t + t^3/3 + t^5/5 + ...), where t = (m - p) / (m + p) is at most 0.2. the
+    // terms are summed in fixed point, so rounding the running total doesn't cost a digit every few terms.
+    // t itself is most of the sum, so it's divided out to all 18 places, nine digits at a time. m and p both fit
+    // in fixed point with nine decimal places, where m - p and m + p (less than 10) can't round.
+    int64_t mf, pf;
+    decimal_to_fixed(m, 9, &mf);
+    decimal_to_fixed(p, 9, &pf);
+    int64_t num = mf - pf;
+    int64_t den = mf + pf;
+    uint64_t u = num < 0 ? -(uint64_t)num : (uint64_t)num;
+    uint64_t q = u * LIMB_BASE / (uint64_t)den;
+    uint64_t r = u * LIMB_BASE - q * (uint64_t)den;
+    q = q * LIMB_BASE + (r * LIMB_BASE + (uint64_t)den / 2) / (uint64_t)den;
+    int64_t sum = num < 0 ? -(int64_t)q : (int64_t)q;
+
+    // the rest of the terms are small enough that nine digits of t do for them.
+    decimal_t t = _make_signed(sum, -18);
+    decimal_t t2 = decimal_mul(t, t);
+    decimal_t term = decimal_mul(t, t2);
+    for(int32_t k = 3; term.mantissa != 0; k += 2) {
+        int64_t x;
+        decimal_to_fixed(decimal_div(term, decimal_from_int(k)), 18, &x);
+        if (x == 0) break;
+        sum += x;
+        term = decimal_mul(term, t2);
+    }
+
+    return sum + sum;
+}
+
+// adds the rest of ln(d) onto _ln_series' result, in fixed point with 14 decimal places. ln(10) rounded to nine
+// digits would be off by 3e-9 per power of ten, which e^(b * ln(a)) would then multiply by b.
+static int64_t _ln_fixed(int64_t ln_m, int8_t halvings, int16_t magnitude) {
+    int64_t x = (ln_m + (ln_m < 0 ? -5000 : 5000)) / 10000;
+    return x + halvings * LN2_FIXED + magnitude * LN10_FIXED;
+}
+
+decimal_t decimal_ln(decimal_t d) {
+    if (decimal_is_nan(d) || d.mantissa < 0) return DECIMAL_NAN;
+    if (d.mantissa == 0) return _infinity(true);
+    if (_is_special(d)) return d;
+
+    int8_t halvings;
+    int16_t magnitude;
+    int64_t ln_m = _ln_series(d, &halvings, &magnitude);
+    // close to 1, the series on its own has more significant digits than ln(2) and ln(10) would keep.
+    if (halvings == 0 && magnitude == 0) return _make_signed(ln_m, -18);
+    return _make_signed(_ln_fixed(ln_m, halvings, magnitude), -14);
+}
+
+decimal_t decimal_log10(decimal_t d) {
+    if (decimal_is_nan(d) || d.mantissa < 0) return DECIMAL_NAN;
+    if (d.mantissa == 0) return _infinity(true);
+    if (_is_special(d)) return d;
+
+    // adding the integer part last means exact powers of ten come out exact.
+    int8_t halvings;
+    int16_t magnitude;
+    int64_t ln_m = _ln_series(d, &halvings, &magnitude);
+    decimal_t ln = halvings ? _make_signed(_ln_fixed(ln_m, halvings, 0), -14) : _make_signed(ln_m, -18);
+    return decimal_add(decimal_div(ln, DECIMAL_LN10), decimal_from_int(magnitude));
+}
+
+// e^(x / 10^14), for decimal_exp and decimal_pow.
+static decimal_t _exp_fixed(int64_t x) {
+    // e^x = 10^n * e^r, where n = floor(x / ln(10)) and r is in [0, ln(10)). the reduction is done in fixed point
+    // too, so large arguments don't lose digits of r.
+    int64_t n = x / LN10_FIXED;
+    if (x < n * LN10_FIXED) n--;
+    int64_t r = x - n * LN10_FIXED;
+
+    // e^r = (e^(r / 4))^4. r / 4 is less than 0.576, so the Taylor series converges in about a dozen terms, and
+    // the result is less than 1.78, which fits in 2.30 fixed point.
+    int32_t z = (((r / 100000) << (FIX_BITS - 2)) + 500000000) / 1000000000;
+    int32_t sum = FIX_ONE;
+    int32_t term = FIX_ONE;
+    for(int32_t i = 1; term != 0; i++) {
+        term = (int32_t)(((int64_t)term * z) >> FIX_BITS) / i;
+        sum += term;
+    }
+    // square twice: the result is less than 10, so it needs 64 bits.
+    uint64_t e = ((uint64_t)sum * (uint64_t)sum + (1UL << (FIX_BITS - 1))) >> FIX_BITS;
+    e = (e * e + (1UL << (FIX_BITS - 1))) >> FIX_BITS;
+    // scale it to a 9-digit mantissa.
+    uint64_t mantissa = (e * _pow10[DECIMAL_DIGITS - 1] + (1UL << (FIX_BITS - 1))) >> FIX_BITS;
+
+    return _make(false, mantissa, (int32_t)n - DECIMAL_DIGITS + 1);
+}
+
+decimal_t decimal_exp(decimal_t d) {
+    if (decimal_is_nan(d)) return DECIMAL_NAN;
+    if (_is_special(d)) return d.mantissa > 0 ? d : DECIMAL_ZERO;
+    // e^10000 is well past 10^999.
+    if (decimal_get_magnitude(d) >= 4) return d.mantissa > 0 ? _infinity(false) : DECIMAL_ZERO;
+
+    int64_t x;
+    decimal_to_fixed(d, 14, &x);
+    return _exp_fixed(x);
+}
+
+// the rest of decimal_pow: b * x, where x and the result have 14 decimal places. the caller has checked that
+// the product is less than 10000, so it fits in 64 bits; b's mantissa times x, on the other hand, may not, so x
+// is split in two nine-digit halves and each partial product is scaled separately.
+static int64_t _mul_fixed(decimal_t b, int64_t x) {
+    if (x == 0) return 0;
+    b = _normalize(b);
+    bool negative = (b.mantissa < 0) != (x < 0);
+    uint64_t u = x < 0 ? -(uint64_t)x : (uint64_t)x;
+    uint64_t hi = _abs_mantissa(b) * (u / LIMB_BASE);
+    uint64_t lo = _abs_mantissa(b) * (u % LIMB_BASE);
+    // b is at least 10^(exponent + 8) and x at least 10^-14, so a larger exponent would put b * x over 10000.
+    int32_t e = b.exponent;
+    if (e > 10) return 0;
+    if (e >= 0) u = hi * _pow10[DECIMAL_DIGITS + e] + lo * _pow10[e];
+    else if (e >= -DECIMAL_DIGITS) u = hi * _pow10[DECIMAL_DIGITS + e] + _round_shift(lo, -e);
+    else if (e >= -19) u = _round_shift(hi, -DECIMAL_DIGITS - e) + _round_shift(lo, -e);
+    else u = _round_shift(hi, e < -DECIMAL_DIGITS - 19 ? 20 : -DECIMAL_DIGITS - e);
+    return negative ? -(int64_t)u : (int64_t)u;
+}
+
+decimal_t decimal_pow(decimal_t a, decimal_t b) {
+    if (decimal_is_nan(a) || decimal_is_nan(b)) return DECIMAL_NAN;
+    if (decimal_is_zero(b)) return DECIMAL_ONE;
+
+    bool has_fraction;
+    _trunc(b, &has_fraction);
+    int64_t n;
+    if (!has_fraction && decimal_to_fixed(b, 0, &n) && n <= INT32_MAX && n >= -INT32_MAX) {
+        // integer power: square and multiply.
+        bool invert = n < 0;
+        uint32_t e = invert ? -n : n;
+        decimal_t result = DECIMAL_ONE;
+        decimal_t base = a;
+        while (e) {
+            if (e & 1) result = decimal_mul(result, base);
+            e >>= 1;
+            if (e) base = decimal_mul(base, base);
+        }
+        return invert ? decimal_div(DECIMAL_ONE, result) : result;
+    }
+
+    if (a.mantissa < 0) return DECIMAL_NAN;
+    if (a.mantissa == 0) return b.mantissa > 0 ? DECIMAL_ZERO : _infinity(false);
+
+    // a^b = e^(b * ln(a)). the exponent can be in the thousands, and e^y has only as many correct digits as
+    // y has after its decimal point, so b * ln(a) is worked out in fixed point rather than rounded to nine digits.
+    if (_is_special(a) || _is_special(b)) return decimal_exp(decimal_mul(b, decimal_ln(a)));
+    int8_t halvings;
+    int16_t magnitude;
+    int64_t ln_m = _ln_series(a, &halvings, &magnitude);
+    int64_t ln_a = _ln_fixed(ln_m, halvings, magnitude);
+    decimal_t y = decimal_mul(b, _make_signed(ln_a, -14));
+    if (decimal_get_magnitude(y) >= 4) return decimal_exp(y);
+
+    return _exp_fixed(_mul_fixed(b, ln_a));
+}
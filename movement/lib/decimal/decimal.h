@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DECIMAL_H_
+#define DECIMAL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Decimal floating point for the calculator faces.
+// The SAM L22 has no FPU, so every float or double operation is a call into the soft-float library, and
+// functions like sin, pow or log10 pull in libm's double precision routines (several kilobytes each). The
+// display only has room for six digits anyway, so this library represents numbers as a 9-digit decimal
+// mantissa and a power of ten, using nothing but integer arithmetic. Numbers parse and format without any
+// rounding error (0.1 really is 0.1), and a calculator face can pull digits straight out of the mantissa.
+//
+// Basic arithmetic and square roots are correctly rounded to 9 significant digits. Logarithms are computed
+// with a series summed in fixed point, and exp with a series in 2.30 binary fixed point; both are good to
+// about 8 significant digits. Non-integer powers pass b * ln(a) to exp in fixed point with 14 decimal
+// places rather than rounding it, so they are as good as exp even for results near 10^999. Sine, cosine
+// and tangent reduce their argument exactly, then use Taylor series in decimal, so they are also good to
+// about 8 significant digits, even for tiny angles, angles in the millions, or results near zero.
+// Arguments past 10^8 quadrants have no meaningful digits left, and return NaN. The inverse functions use
+// a series near zero and CORDIC in 2.30 fixed point elsewhere, which leaves an absolute error of around
+// 10^-8, or about 7 significant digits. All of this is still well beyond what the display can show.
+//
+// Results that are too large become infinity; results with no meaning (0 / 0, sqrt(-1)) become NaN. Both
+// propagate through later operations, so a calculator only needs to check the final result.
+
+/// The number of significant digits in a decimal_t.
+#define DECIMAL_DIGITS 9
+/// Numbers with a magnitude of 10^DECIMAL_EXPONENT_LIMIT or more overflow to infinity; smaller than
+/// 10^-DECIMAL_EXPONENT_LIMIT underflow to zero.
+#define DECIMAL_EXPONENT_LIMIT 999
+/// Special values (NaN and infinity) use this exponent.
+#define DECIMAL_EXPONENT_SPECIAL INT16_MAX
+
+typedef struct {
+    int32_t mantissa;   // the value is mantissa * 10^exponent. results are normalized so that the mantissa has
+    int16_t exponent;   // exactly DECIMAL_DIGITS digits, but any mantissa up to 999999999 is valid as an input.
+} decimal_t;
+
+/// Builds a decimal constant, i.e. DECIMAL(2834952, -5) for 28.34952.
+#define DECIMAL(mantissa, exponent) ((decimal_t){(mantissa), (exponent)})
+#define DECIMAL_ZERO DECIMAL(0, 0)
+#define DECIMAL_ONE DECIMAL(1, 0)
+#define DECIMAL_NAN DECIMAL(0, DECIMAL_EXPONENT_SPECIAL)
+#define DECIMAL_INFINITY DECIMAL(1, DECIMAL_EXPONENT_SPECIAL)
+#define DECIMAL_PI DECIMAL(314159265, -8)
+#define DECIMAL_E DECIMAL(271828183, -8)
+
+/** @brief Converts an integer to a decimal. Integers with more than 9 digits are rounded.
+  */
+decimal_t decimal_from_int(int32_t i);
+
+/** @brief Parses a number like "-12.5", "3" or "6.02e23".
+  * @param str The string to parse. Leading whitespace is skipped.
+  * @param endptr If not NULL, set to the first character after the number. If no digits were found, it is set
+  *               to str, and the return value is zero.
+  * @return The parsed number. Digits beyond the ninth are rounded.
+  */
+decimal_t decimal_parse(const char *str, char **endptr);
+
+/** @brief Formats a number for a serial console or debug output, i.e. "-0.125", "1500" or "6.02e+23".
+  * @param d The number to format.
+  * @param buf A buffer of at least 18 bytes.
+  */
+void decimal_to_string(decimal_t d, char *buf);
+
+/** @brief Rounds a number to a fixed number of decimal places, and returns it as an integer scaled by
+  *        10^decimals, i.e. 3.14159 with 2 decimals returns 314. This is the fast path for displaying a number
+  *        with an implied decimal point on the LCD.
+  * @param d The number to convert.
+  * @param decimals The number of decimal places to keep.
+  * @param out Set to the scaled value.
+  * @return false if the number is NaN, infinite or doesn't fit in an int64_t.
+  */
+bool decimal_to_fixed(decimal_t d, uint8_t decimals, int64_t *out);
+
+/** @brief Rounds a number to a number of significant digits, for display in scientific notation.
+  * @param d The number to convert. Must not be zero, NaN or infinite.
+  * @param num_digits The number of significant digits, from 1 to 9.
+  * @param digits Set to the significant digits as an integer from 10^(num_digits-1) up to 10^num_digits - 1,
+  *               negative if d is negative.
+  * @param exponent Set to the power of ten of the first digit, i.e. 2 for 123.
+  */
+void decimal_to_digits(decimal_t d, uint8_t num_digits, int32_t *digits, int16_t *exponent);
+
+/** @brief Returns the power of ten of the most significant digit: floor(log10(fabs(d))). Zero returns zero.
+  */
+int16_t decimal_get_magnitude(decimal_t d);
+
+bool decimal_is_nan(decimal_t d);
+bool decimal_is_inf(decimal_t d);
+bool decimal_is_zero(decimal_t d);
+bool decimal_is_negative(decimal_t d);
+
+/** @brief Compares two numbers.
+  * @return -1 if a < b, 0 if they are equal, 1 if a > b. NaN compares equal to everything.
+  */
+int8_t decimal_cmp(decimal_t a, decimal_t b);
+
+decimal_t decimal_neg(decimal_t d);
+decimal_t decimal_abs(decimal_t d);
+decimal_t decimal_add(decimal_t a, decimal_t b);
+decimal_t decimal_sub(decimal_t a, decimal_t b);
+decimal_t decimal_mul(decimal_t a, decimal_t b);
+decimal_t decimal_div(decimal_t a, decimal_t b);
+
+/// Rounds toward negative infinity.
+decimal_t decimal_floor(decimal_t d);
+/// Rounds to the nearest integer, with halves rounded away from zero.
+decimal_t decimal_round(decimal_t d);
+
+decimal_t decimal_sqrt(decimal_t d);
+/// The natural logarithm.
+decimal_t decimal_ln(decimal_t d);
+decimal_t decimal_log10(decimal_t d);
+decimal_t decimal_exp(decimal_t d);
+/// Raises a to the power of b. Integer powers are computed exactly (to 9 digits) by repeated squaring; other
+/// powers are computed as e^(b * ln(a)), and are good to about 8 significant digits, like decimal_exp.
+decimal_t decimal_pow(decimal_t a, decimal_t b);
+
+// Trigonometric functions, in radians.
+decimal_t decimal_sin(decimal_t d);
+decimal_t decimal_cos(decimal_t d);
+decimal_t decimal_tan(decimal_t d);
+decimal_t decimal_asin(decimal_t d);
+decimal_t decimal_acos(decimal_t d);
+decimal_t decimal_atan(decimal_t d);
+decimal_t decimal_atan2(decimal_t y, decimal_t x);
+
+#endif // DECIMAL_H_
@@ -29,15 +29,13 @@
 #include "calc.h"
 #include "calc_fns.h"
 
-#define CALC_NAN (0.0/0.0)
-
 /* calc_init 
  * Initialize calculator
  */
 int calc_init(calc_state_t *cs) {    
-    memset(cs->stack, CALC_NAN, N_STACK*sizeof(cs->stack[0]));
+    for(uint8_t idx=0; idx<N_STACK; idx++) cs->stack[idx] = DECIMAL_NAN;
     cs->s = 0; 
-    cs->mem = 0.0;
+    cs->mem = DECIMAL_ZERO;
     return 0;
 }
 
@@ -88,7 +86,7 @@ int calc_input_float(calc_state_t *cs, char *token) {
     REPCHAR('p', 'E');
     
     char *endptr;
-    double d = calc_strtof(token, &endptr);
+    decimal_t d = decimal_parse(token, &endptr);
     if(!endptr || (uint8_t)(endptr-token)<strlen(token)) return -1; // Bad format
     if(cs->s >= N_STACK) return -2; // Stack full
     cs->stack[cs->s++] = d;
@@ -23,7 +23,6 @@
  */
 
 #include <string.h>
-#include <math.h>
 
 #include "calc_fns.h" 
 
@@ -33,8 +32,8 @@
 #define STACK_CHECK_2_IN_1_OUT if(cs->s < 2) return -2
 #define STACK_CHECK_2_IN_2_OUT if(cs->s < 2) return -2
 
-static const double to_rad = M_PI/180;
-static const double to_deg = 180/M_PI;
+static const decimal_t to_rad = DECIMAL(174532925, -10); // pi/180
+static const decimal_t to_deg = DECIMAL(572957795, -7); // 180/pi
 
 // Stack and memory control
 int calc_delete(calc_state_t *cs) {
@@ -43,19 +42,19 @@ int calc_delete(calc_state_t *cs) {
     return 0;
 }
 int calc_clear_stack(calc_state_t *cs) {
-    memset(cs->stack, (0.0/0.0), N_STACK*sizeof(cs->stack[0]));
+    for(uint8_t idx=0; idx<N_STACK; idx++) cs->stack[idx] = DECIMAL_NAN;
     cs->s = 0; 
     return 0;
 }
 int calc_flip(calc_state_t *cs) {
     STACK_CHECK_2_IN_2_OUT;
-    double buff = cs->stack[cs->s-2];
+    decimal_t buff = cs->stack[cs->s-2];
     cs->stack[cs->s-2] = cs->stack[cs->s-1];
     cs->stack[cs->s-1] = buff;
     return 0;
 }
 int calc_mem_clear(calc_state_t *cs) {
-    cs->mem = 0.0;
+    cs->mem = DECIMAL_ZERO;
     return 0;
 }
 int calc_mem_recall(calc_state_t *cs) { 
@@ -65,13 +64,13 @@ int calc_mem_recall(calc_state_t *cs) {
 }
 int calc_mem_add(calc_state_t *cs) {
     STACK_CHECK_1_IN_0_OUT;
-    cs->mem += cs->stack[cs->s-1];
+    cs->mem = decimal_add(cs->mem, cs->stack[cs->s-1]);
     cs->s--;
     return 0;
 }
 int calc_mem_subtract(calc_state_t *cs) {
     STACK_CHECK_1_IN_0_OUT;
-    cs->mem -= cs->stack[cs->s-1];
+    cs->mem = decimal_sub(cs->mem, cs->stack[cs->s-1]);
     cs->s--;
     return 0;
 }
@@ -79,162 +78,162 @@ int calc_mem_subtract(calc_state_t *cs) {
 // Basic operations
 int calc_add(calc_state_t *cs) {
     STACK_CHECK_2_IN_1_OUT; 
-    cs->stack[cs->s-2] += cs->stack[cs->s-1];
+    cs->stack[cs->s-2] = decimal_add(cs->stack[cs->s-2], cs->stack[cs->s-1]);
     cs->s--;
     return 0;
 }
 int calc_subtract(calc_state_t *cs) {
     STACK_CHECK_2_IN_1_OUT; 
-    cs->stack[cs->s-2] -= cs->stack[cs->s-1];
+    cs->stack[cs->s-2] = decimal_sub(cs->stack[cs->s-2], cs->stack[cs->s-1]);
     cs->s--;
     return 0;
 }
 int calc_negate(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = -cs->stack[cs->s-1];
+    cs->stack[cs->s-1] = decimal_neg(cs->stack[cs->s-1]);
     return 0;
 }
 int calc_multiply(calc_state_t *cs) {
     STACK_CHECK_2_IN_1_OUT; 
-    cs->stack[cs->s-2] *= cs->stack[cs->s-1];
+    cs->stack[cs->s-2] = decimal_mul(cs->stack[cs->s-2], cs->stack[cs->s-1]);
     cs->s--;
     return 0;
 }
 int calc_divide(calc_state_t *cs) {
     STACK_CHECK_2_IN_1_OUT;
-    cs->stack[cs->s-2] /= cs->stack[cs->s-1];
+    cs->stack[cs->s-2] = decimal_div(cs->stack[cs->s-2], cs->stack[cs->s-1]);
     cs->s--;
     return 0;
 }
 
 int calc_invert(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = 1.0/cs->stack[cs->s-1];
+    cs->stack[cs->s-1] = decimal_div(DECIMAL_ONE, cs->stack[cs->s-1]);
     return 0;
 }
 
 // Constants
 int calc_e(calc_state_t *cs) {
     STACK_CHECK_0_IN_1_OUT;
-    cs->stack[cs->s++] = M_E;
+    cs->stack[cs->s++] = DECIMAL_E;
     return 0;
 }
 int calc_pi(calc_state_t *cs) {
     STACK_CHECK_0_IN_1_OUT;
-    cs->stack[cs->s++] = M_PI;
+    cs->stack[cs->s++] = DECIMAL_PI;
     return 0;
 }
 
 // Exponential/logarithmic
 int calc_exp(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = exp(cs->stack[cs->s-1]);
+    cs->stack[cs->s-1] = decimal_exp(cs->stack[cs->s-1]);
     return 0;
 }
 int calc_pow(calc_state_t *cs) {
     STACK_CHECK_2_IN_1_OUT;
-    cs->stack[cs->s-2] = pow(cs->stack[cs->s-2], cs->stack[cs->s-1]);
+    cs->stack[cs->s-2] = decimal_pow(cs->stack[cs->s-2], cs->stack[cs->s-1]);
     cs->s--;
     return 0;
 }
 int calc_ln(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = log(cs->stack[cs->s-1]);
+    cs->stack[cs->s-1] = decimal_ln(cs->stack[cs->s-1]);
     return 0;
 }
 int calc_log(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = log10(cs->stack[cs->s-1]);
+    cs->stack[cs->s-1] = decimal_log10(cs->stack[cs->s-1]);
     return 0;
 }
 int calc_sqrt(calc_state_t *cs)  {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = sqrt(cs->stack[cs->s-1]);
+    cs->stack[cs->s-1] = decimal_sqrt(cs->stack[cs->s-1]);
     return 0;
 }
 
 // Trigonometric
 int calc_sin(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = sin(cs->stack[cs->s-1]);
+    cs->stack[cs->s-1] = decimal_sin(cs->stack[cs->s-1]);
     return 0;
 }
 int calc_cos(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = cos(cs->stack[cs->s-1]);
+    cs->stack[cs->s-1] = decimal_cos(cs->stack[cs->s-1]);
     return 0;
 }
 int calc_tan(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = tan(cs->stack[cs->s-1]);
+    cs->stack[cs->s-1] = decimal_tan(cs->stack[cs->s-1]);
     return 0;
 } 
 int calc_asin(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = asin(cs->stack[cs->s-1]);
+    cs->stack[cs->s-1] = decimal_asin(cs->stack[cs->s-1]);
     return 0;
 }
 int calc_acos(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = acos(cs->stack[cs->s-1]);
+    cs->stack[cs->s-1] = decimal_acos(cs->stack[cs->s-1]);
     return 0;
 }
 int calc_atan(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = atan(cs->stack[cs->s-1]);
+    cs->stack[cs->s-1] = decimal_atan(cs->stack[cs->s-1]);
     return 0;
 }
 int calc_atan2(calc_state_t *cs) {
     STACK_CHECK_2_IN_1_OUT;
-    cs->stack[cs->s-2] = atan2(cs->stack[cs->s-2], cs->stack[cs->s-1]);
+    cs->stack[cs->s-2] = decimal_atan2(cs->stack[cs->s-2], cs->stack[cs->s-1]);
     cs->s--;
     return 0;
 }
 
 int calc_sind(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = sin(cs->stack[cs->s-1]*to_rad);
+    cs->stack[cs->s-1] = decimal_sin(decimal_mul(cs->stack[cs->s-1], to_rad));
     return 0;
 }
 int calc_cosd(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = cos(cs->stack[cs->s-1]*to_rad);
+    cs->stack[cs->s-1] = decimal_cos(decimal_mul(cs->stack[cs->s-1], to_rad));
     return 0;
 }
 int calc_tand(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = tan(cs->stack[cs->s-1]*to_rad);
+    cs->stack[cs->s-1] = decimal_tan(decimal_mul(cs->stack[cs->s-1], to_rad));
     return 0;
 }
 int calc_asind(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = asin(cs->stack[cs->s-1])*to_deg;
+    cs->stack[cs->s-1] = decimal_mul(decimal_asin(cs->stack[cs->s-1]), to_deg);
     return 0;
 }
 int calc_acosd(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = acos(cs->stack[cs->s-1])*to_deg;
+    cs->stack[cs->s-1] = decimal_mul(decimal_acos(cs->stack[cs->s-1]), to_deg);
     return 0;
 }
 int calc_atand(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT; 
-    cs->stack[cs->s-1] = atan(cs->stack[cs->s-1])*to_deg;
+    cs->stack[cs->s-1] = decimal_mul(decimal_atan(cs->stack[cs->s-1]), to_deg);
     return 0;
 }
 int calc_atan2d(calc_state_t *cs) {
     STACK_CHECK_2_IN_1_OUT;
-    cs->stack[cs->s-2] = atan2(cs->stack[cs->s-2], cs->stack[cs->s-1])*to_deg;
+    cs->stack[cs->s-2] = decimal_mul(decimal_atan2(cs->stack[cs->s-2], cs->stack[cs->s-1]), to_deg);
     cs->s--;
     return 0;
 }
 int calc_torad(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT;
-    cs->stack[cs->s-1] = cs->stack[cs->s-1]*to_rad;
+    cs->stack[cs->s-1] = decimal_mul(cs->stack[cs->s-1], to_rad);
     return 0;
 }
 int calc_todeg(calc_state_t *cs) {
     STACK_CHECK_1_IN_1_OUT;
-    cs->stack[cs->s-1] = cs->stack[cs->s-1]*to_deg;
+    cs->stack[cs->s-1] = decimal_mul(cs->stack[cs->s-1], to_deg);
     return 0;
 }
 
@@ -23,49 +23,39 @@
  */
 
 #include <string.h>
-#include <math.h>
 
 #include "watch_private_display.h"
 #include "morsecalc_display.h"
 
 // Display float on screen
-void morsecalc_display_float(double d) { 
+void morsecalc_display_float(decimal_t d) { 
     // Special cases 
-    if(d == 0) {
+    if(decimal_is_zero(d)) {
         watch_display_string("     0", 4); 
         return;
     }
-    else if(isnan(d)) {
+    else if(decimal_is_nan(d)) {
         watch_display_string("   nan", 4);
         return;
     }
-    else if(d == (1.0)/(0.0)) {
-        watch_display_string("   inf", 4);
-        return;
-    }
-    else if(d == (-1.0)/(0.0)) {
-        watch_display_character('X', 1);
+    else if(decimal_is_inf(d)) {
+        if(decimal_is_negative(d)) watch_display_character('X', 1);
         watch_display_string("   inf", 4);
         return;
     }
 
     // Record number properties
     // Sign
-    int is_negative = d<0;
-    if(is_negative) d = -d; 
-
-    // Order of magnitude
-    int om = (int) floor(log(d)/log(10));
+    int is_negative = decimal_is_negative(d);
+    if(is_negative) d = decimal_abs(d); 
+
+    // Get the first 4 significant figures, and the order of magnitude
+    int32_t digits;
+    int16_t exponent;
+    decimal_to_digits(d, 4, &digits, &exponent);
+    int om = exponent;
     int om_is_negative = (om<0);
 
-    // Get the first 4 significant figures
-    int digits;
-    digits = round(d*pow(10.0, 3-om));
-    if(digits>9999) {
-        digits = 1000;
-        om++;
-    }
-
     // Print signs
     if(is_negative) {
 		// Xi; see https://joeycastillo.github.io/Sensor-Watch-Documentation/segmap
@@ -92,7 +82,7 @@ void morsecalc_display_float(double d) {
         if(om_is_negative) watch_display_string("    uf", 4);
         else watch_display_string("    of", 4);
         if(om<9999) { // Use main display to show order of magnitude
-            // (Should always succeed; max double is <2e308)
+            // (Should always succeed; max decimal is <1e999)
             watch_display_character('0'+(om/1000)%10, 4);
             watch_display_character('0'+(om/100 )%10, 5);
             watch_display_character('0'+(om/10  )%10, 6);
@@ -25,7 +25,7 @@
 #include "morsecalc_face.h"
 
 // Display float on screen
-void morsecalc_display_float(double d);
+void morsecalc_display_float(decimal_t d);
 
 // Print current input token
 void morsecalc_display_token(morsecalc_state_t *mcs);
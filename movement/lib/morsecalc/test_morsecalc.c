@@ -23,7 +23,7 @@
  */
 
 // Computer console interface to calc and morsecode for testing without involving watch stuff.
-// cc calc_strtof.c calc.c calc_fns.c test_morsecalc.c -lm
+// cc -I../decimal ../decimal/decimal.c calc.c calc_fns.c test_morsecalc.c
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -56,7 +56,11 @@ int main(void) {
                 case -2: printf("Stack over/underflow.\n"); break;
                 case -3: printf("Error.\n"); break;
             }
-            if(cs.s > 0) printf("[%i]: %.4f\n", cs.s, cs.stack[cs.s-1]);
+            if(cs.s > 0) {
+                char buf[18];
+                decimal_to_string(cs.stack[cs.s-1], buf);
+                printf("[%i]: %s\n", cs.s, buf);
+            }
             else printf("[%i]\n", cs.s);
         }
     }
@@ -666,6 +666,95 @@ int16_t SCL_getAIMove(
   uint8_t *resultTo,
   char *resultProm);
 
+#ifndef SCL_SEARCH_MAX_PLY
+  /**
+    Size of the explicit stack used by SCL_Search, i.e. the maximum number of
+    plys the time-sliced search can go deep, including extensions.
+  */
+  #define SCL_SEARCH_MAX_PLY 12
+#endif
+
+#ifndef SCL_SEARCH_TT_SIZE
+  /**
+    Number of entries in the transposition table used by SCL_Search (must be a
+    power of two). The table is a static array of 12 bytes per entry.
+  */
+  #define SCL_SEARCH_TT_SIZE 128
+#endif
+
+/**
+  One level of the explicit stack used by SCL_Search. Holds what would
+  otherwise be the local variables of a recursive alpha-beta call.
+*/
+typedef struct
+{
+  int16_t alpha;
+  int16_t beta;
+  int16_t alphaOrig;      ///< alpha at node entry, to classify the result
+  int16_t best;           ///< best value found so far, from mover's view
+  int8_t depth;           ///< remaining depth, negative in extensions
+  int8_t takenSquare;     ///< square of the capture that led here, or -1
+  uint8_t stage;          ///< what to do at the next step
+  uint8_t capturesOnly;   ///< only captures are searched (extension node)
+  uint8_t square;         ///< square whose moves are being iterated
+  SCL_SquareSet moves;    ///< moves of square that are yet to be searched
+  uint8_t hashMoveFrom;   ///< move suggested by the transposition table
+  uint8_t hashMoveTo;
+  uint8_t bestFrom;       ///< best move found so far
+  uint8_t bestTo;
+  SCL_MoveUndo undo;      ///< undo info of the move currently searched
+} SCL_SearchFrame;
+
+/**
+  State of a resumable, iterative deepening alpha-beta search. Unlike
+  SCL_getAIMove, which computes the whole move at once, the search is advanced
+  in small slices by SCL_searchStep, so that the caller can keep its UI
+  responsive. After each completed iteration, the result* members hold the
+  best move found at resultDepth, which may be used at any time. Moves found
+  in earlier iterations are kept in a transposition table and searched first,
+  so the deeper iterations are cut off much sooner than a plain search.
+*/
+typedef struct
+{
+  SCL_Board board;        ///< working copy of the board, do not modify
+  SCL_SearchFrame stack[SCL_SEARCH_MAX_PLY];
+  SCL_StaticEvaluationFunction evalFunc;
+  uint32_t nodes;         ///< number of positions visited so far
+  uint8_t ply;            ///< current depth in the stack
+  uint8_t depth;          ///< depth of the iteration being searched
+  uint8_t maxDepth;
+  uint8_t extensionExtraDepth;
+  uint8_t repetitionMoveFrom;
+  uint8_t repetitionMoveTo;
+  uint8_t done;           ///< 1 once maxDepth has been completed
+  uint8_t resultDepth;    ///< depth of the last completed iteration, or 0
+  uint8_t resultFrom;     ///< best move of the last completed iteration
+  uint8_t resultTo;
+  int16_t resultScore;    ///< its value, positive favoring white
+} SCL_Search;
+
+/**
+  Starts a time-sliced search for the best move of the currently moving player.
+  The board is copied, so the original may be changed during the search.
+  Parameters have the same meaning as in SCL_getAIMove; maxDepth is clamped so
+  that maxDepth plus extensionExtraDepth fits in SCL_SEARCH_MAX_PLY.
+*/
+void SCL_searchInit(
+  SCL_Search *search,
+  SCL_Board board,
+  uint8_t maxDepth,
+  uint8_t extensionExtraDepth,
+  SCL_StaticEvaluationFunction evalFunc,
+  uint8_t repetitionMoveFrom,
+  uint8_t repetitionMoveTo);
+
+/**
+  Advances the search by at most maxSteps steps. A step is visiting one
+  position or generating moves of one piece, so the time a call takes is
+  roughly proportional to maxSteps. Returns 1 if the search has finished.
+*/
+uint8_t SCL_searchStep(SCL_Search *search, uint16_t maxSteps);
+
 /**
   Prints given chessboard using given format and an abstract printing function.
 */
@@ -3008,6 +3097,431 @@ board,i,iteratedSquare,'q',moveStr));
   return bestScore;
 }
 
+#define _SCL_SEARCH_INFINITY 32767
+#define _SCL_SEARCH_MATE_LIMIT (SCL_EVALUATION_MAX_SCORE - SCL_SEARCH_MAX_PLY)
+
+#define _SCL_SEARCH_STAGE_ENTER 0
+#define _SCL_SEARCH_STAGE_HASH_MOVE 1
+#define _SCL_SEARCH_STAGE_MOVES 2
+
+#define _SCL_TT_EXACT 0
+#define _SCL_TT_LOWER 1
+#define _SCL_TT_UPPER 2
+
+#define _SCL_NO_SQUARE 0xff
+
+typedef struct
+{
+  uint32_t hash;
+  int16_t value;
+  int8_t depth;
+  uint8_t flag;
+  uint8_t moveFrom;
+  uint8_t moveTo;
+} _SCL_TTEntry;
+
+_SCL_TTEntry _SCL_tt[SCL_SEARCH_TT_SIZE];
+
+static inline _SCL_TTEntry *_SCL_ttEntry(uint32_t hash)
+{
+  return _SCL_tt + (hash & (SCL_SEARCH_TT_SIZE - 1));
+}
+
+/* Mate values depend on the ply at which they were found; the table stores
+  them relative to the node so that they stay valid at any ply. */
+static inline int16_t _SCL_ttValueToStore(int16_t value, uint8_t ply)
+{
+  return value > _SCL_SEARCH_MATE_LIMIT ? value + ply :
+    (value < -1 * _SCL_SEARCH_MATE_LIMIT ? value - ply : value);
+}
+
+static inline int16_t _SCL_ttValueFromStore(int16_t value, uint8_t ply)
+{
+  return value > _SCL_SEARCH_MATE_LIMIT ? value - ply :
+    (value < -1 * _SCL_SEARCH_MATE_LIMIT ? value + ply : value);
+}
+
+static inline int16_t _SCL_searchStaticValue(SCL_Search *search)
+{
+  int16_t value =
+#ifndef SCL_EVALUATION_FUNCTION
+    search->evalFunc(search->board);
+#else
+    SCL_EVALUATION_FUNCTION(search->board);
+#endif
+
+  return SCL_boardWhitesTurn(search->board) ? value : -1 * value;
+}
+
+static uint8_t _SCL_squareSetPop(SCL_SquareSet squareSet)
+{
+  for (uint8_t i = 0; i < 8; ++i)
+    if (squareSet[i] != 0)
+    {
+      uint8_t bit = 0;
+
+      while (!(squareSet[i] & (0x01 << bit)))
+        bit++;
+
+      squareSet[i] &= ~(0x01 << bit);
+
+      return i * 8 + bit;
+    }
+
+  return _SCL_NO_SQUARE;
+}
+
+static void _SCL_searchFrameInit(SCL_SearchFrame *frame, int8_t depth,
+  int16_t alpha, int16_t beta, int8_t takenSquare)
+{
+  frame->alpha = alpha;
+  frame->beta = beta;
+  frame->depth = depth;
+  frame->takenSquare = takenSquare;
+  frame->stage = _SCL_SEARCH_STAGE_ENTER;
+}
+
+/**
+  Handles entering a node. Returns 1 if the node's value is known right away
+  (stored in frame->best), 0 if its moves have to be searched.
+*/
+static uint8_t _SCL_searchEnter(SCL_Search *search, SCL_SearchFrame *frame)
+{
+  uint8_t ply = search->ply;
+
+  search->nodes++;
+
+#if SCL_CALL_WDT_RESET
+  wdt_reset();
+#endif
+
+  frame->alphaOrig = frame->alpha;
+  frame->hashMoveFrom = _SCL_NO_SQUARE;
+  frame->bestFrom = _SCL_NO_SQUARE;
+  frame->bestTo = _SCL_NO_SQUARE;
+  frame->square = _SCL_NO_SQUARE;
+  frame->capturesOnly = 0;
+  SCL_squareSetClear(frame->moves);
+
+  uint8_t positionType = SCL_boardGetPosition(search->board);
+
+  if (positionType == SCL_POSITION_MATE)
+  {
+    // prefer quicker mates, i.e. being mated later is better
+    frame->best = -1 * SCL_EVALUATION_MAX_SCORE + ply;
+    return 1;
+  }
+
+  if (positionType == SCL_POSITION_STALEMATE ||
+    positionType == SCL_POSITION_DEAD)
+  {
+    frame->best = 0;
+    return 1;
+  }
+
+  if (frame->depth <= 0)
+  {
+    /* Beyond base depth we only continue exchanges and checks (same idea as
+      the extensions of SCL_boardEvaluateDynamic), up to a hard limit. */
+    if (ply >= SCL_SEARCH_MAX_PLY - 1 ||
+      frame->depth <= -1 * search->extensionExtraDepth ||
+      (frame->takenSquare < 0 && positionType != SCL_POSITION_CHECK))
+    {
+      frame->best = _SCL_searchStaticValue(search);
+      return 1;
+    }
+
+    if (positionType != SCL_POSITION_CHECK)
+    {
+      // stand pat: the mover doesn't have to take
+      frame->capturesOnly = 1;
+      frame->best = _SCL_searchStaticValue(search);
+
+      if (frame->best >= frame->beta)
+        return 1;
+
+      if (frame->best > frame->alpha)
+        frame->alpha = frame->best;
+    }
+    else
+      frame->best = -1 * _SCL_SEARCH_INFINITY;
+  }
+  else
+  {
+    frame->best = -1 * _SCL_SEARCH_INFINITY;
+
+    _SCL_TTEntry *entry = _SCL_ttEntry(SCL_boardHash32(search->board));
+
+    if (entry->hash == SCL_boardHash32(search->board) &&
+      entry->moveFrom != _SCL_NO_SQUARE)
+    {
+      if (ply != 0 && entry->depth >= frame->depth)
+      {
+        int16_t value = _SCL_ttValueFromStore(entry->value,ply);
+
+        if (entry->flag == _SCL_TT_EXACT ||
+          (entry->flag == _SCL_TT_LOWER && value >= frame->beta) ||
+          (entry->flag == _SCL_TT_UPPER && value <= frame->alpha))
+        {
+          frame->best = value;
+          return 1;
+        }
+      }
+
+      frame->hashMoveFrom = entry->moveFrom;
+      frame->hashMoveTo = entry->moveTo;
+    }
+  }
+
+  frame->stage = _SCL_SEARCH_STAGE_HASH_MOVE;
+
+  return 0;
+}
+
+/**
+  Gets the next move to search at the current node. Returns 0 if there are no
+  more moves (or the node was cut off).
+*/
+static uint8_t _SCL_searchNextMove(SCL_Search *search, SCL_SearchFrame *frame,
+  uint8_t *from, uint8_t *to)
+{
+  const char *board = search->board;
+
+  if (frame->alpha >= frame->beta)
+    return 0;
+
+  if (frame->stage == _SCL_SEARCH_STAGE_HASH_MOVE)
+  {
+    frame->stage = _SCL_SEARCH_STAGE_MOVES;
+
+    if (frame->hashMoveFrom != _SCL_NO_SQUARE)
+    {
+      // the hash may collide, so make sure the move is valid here
+      char piece = board[frame->hashMoveFrom];
+
+      if (piece != '.' &&
+        SCL_pieceIsWhite(piece) == SCL_boardWhitesTurn(search->board) &&
+        (!frame->capturesOnly || board[frame->hashMoveTo] != '.'))
+      {
+        SCL_boardGetMoves(search->board,frame->hashMoveFrom,frame->moves);
+
+        if (SCL_squareSetContains(frame->moves,frame->hashMoveTo))
+        {
+          SCL_squareSetClear(frame->moves);
+          *from = frame->hashMoveFrom;
+          *to = frame->hashMoveTo;
+          return 1;
+        }
+
+        SCL_squareSetClear(frame->moves);
+      }
+
+      frame->hashMoveFrom = _SCL_NO_SQUARE;
+    }
+  }
+
+  while (1)
+  {
+    uint8_t square = _SCL_squareSetPop(frame->moves);
+
+    if (square != _SCL_NO_SQUARE)
+    {
+      if (frame->square == frame->hashMoveFrom && square == frame->hashMoveTo)
+        continue; // already searched first
+
+      *from = frame->square;
+      *to = square;
+      return 1;
+    }
+
+    // this piece has no more moves, get the next one's
+    do
+    {
+      frame->square++; // wraps from _SCL_NO_SQUARE to 0
+
+      if (frame->square >= SCL_BOARD_SQUARES)
+        return 0;
+    } while (board[frame->square] == '.' ||
+      SCL_pieceIsWhite(board[frame->square]) !=
+      SCL_boardWhitesTurn(search->board));
+
+    SCL_boardGetMoves(search->board,frame->square,frame->moves);
+
+    if (frame->capturesOnly)
+      for (uint8_t i = 0; i < SCL_BOARD_SQUARES; ++i)
+        if (board[i] == '.')
+          frame->moves[i / 8] &= ~(0x01 << (i % 8));
+  }
+}
+
+static void _SCL_searchRecordValue(SCL_SearchFrame *frame, int16_t value,
+  uint8_t from, uint8_t to)
+{
+  if (value > frame->best)
+  {
+    frame->best = value;
+    frame->bestFrom = from;
+    frame->bestTo = to;
+
+    if (value > frame->alpha)
+      frame->alpha = value;
+  }
+}
+
+static void _SCL_searchStartIteration(SCL_Search *search)
+{
+  search->ply = 0;
+  _SCL_searchFrameInit(search->stack,search->depth,-1 * _SCL_SEARCH_INFINITY,
+    _SCL_SEARCH_INFINITY,-1);
+}
+
+/**
+  Called when the value of the node at search->ply is final: stores it and
+  passes it to the parent node.
+*/
+static void _SCL_searchReturn(SCL_Search *search)
+{
+  SCL_SearchFrame *frame = search->stack + search->ply;
+
+  if (frame->stage != _SCL_SEARCH_STAGE_ENTER && frame->depth > 0 &&
+    frame->bestFrom != _SCL_NO_SQUARE)
+  {
+    uint32_t hash = SCL_boardHash32(search->board);
+    _SCL_TTEntry *entry = _SCL_ttEntry(hash);
+
+    if (entry->hash != hash || entry->depth <= frame->depth)
+    {
+      entry->hash = hash;
+      entry->value = _SCL_ttValueToStore(frame->best,search->ply);
+      entry->depth = frame->depth;
+      entry->flag = frame->best <= frame->alphaOrig ? _SCL_TT_UPPER :
+        (frame->best >= frame->beta ? _SCL_TT_LOWER : _SCL_TT_EXACT);
+      entry->moveFrom = frame->bestFrom;
+      entry->moveTo = frame->bestTo;
+    }
+  }
+
+  if (search->ply == 0)
+  {
+    // a whole iteration is done
+    if (frame->bestFrom != _SCL_NO_SQUARE)
+    {
+      search->resultFrom = frame->bestFrom;
+      search->resultTo = frame->bestTo;
+      search->resultScore = SCL_boardWhitesTurn(search->board) ?
+        frame->best : -1 * frame->best;
+      search->resultDepth = search->depth;
+    }
+
+    if (search->depth >= search->maxDepth ||
+      frame->best > _SCL_SEARCH_MATE_LIMIT ||
+      frame->best < -1 * _SCL_SEARCH_MATE_LIMIT ||
+      frame->bestFrom == _SCL_NO_SQUARE)
+      search->done = 1;
+    else
+    {
+      search->depth++;
+      _SCL_searchStartIteration(search);
+    }
+
+    return;
+  }
+
+  int16_t value = -1 * frame->best;
+
+  search->ply--;
+  frame--;
+
+  SCL_boardUndoMove(search->board,frame->undo);
+  _SCL_searchRecordValue(frame,value,frame->undo.squareFrom,
+    frame->undo.squareTo);
+}
+
+void SCL_searchInit(
+  SCL_Search *search,
+  SCL_Board board,
+  uint8_t maxDepth,
+  uint8_t extensionExtraDepth,
+  SCL_StaticEvaluationFunction evalFunc,
+  uint8_t repetitionMoveFrom,
+  uint8_t repetitionMoveTo)
+{
+  SCL_boardCopy(board,search->board);
+
+  if (maxDepth + extensionExtraDepth > SCL_SEARCH_MAX_PLY - 1)
+    maxDepth = extensionExtraDepth < SCL_SEARCH_MAX_PLY - 1 ?
+      SCL_SEARCH_MAX_PLY - 1 - extensionExtraDepth : 1;
+
+  search->evalFunc = evalFunc;
+  search->nodes = 0;
+  search->maxDepth = maxDepth == 0 ? 1 : maxDepth;
+  search->extensionExtraDepth = extensionExtraDepth;
+  search->repetitionMoveFrom = repetitionMoveFrom;
+  search->repetitionMoveTo = repetitionMoveTo;
+  search->done = 0;
+  search->resultDepth = 0;
+  search->resultFrom = _SCL_NO_SQUARE;
+  search->resultTo = _SCL_NO_SQUARE;
+  search->resultScore = 0;
+  search->depth = 1;
+
+  _SCL_searchStartIteration(search);
+}
+
+uint8_t SCL_searchStep(SCL_Search *search, uint16_t maxSteps)
+{
+  while (maxSteps > 0 && !search->done)
+  {
+    SCL_SearchFrame *frame = search->stack + search->ply;
+    uint8_t from, to;
+
+    maxSteps--;
+
+    if (frame->stage == _SCL_SEARCH_STAGE_ENTER)
+    {
+      if (_SCL_searchEnter(search,frame))
+        _SCL_searchReturn(search);
+
+      continue;
+    }
+
+    if (!_SCL_searchNextMove(search,frame,&from,&to))
+    {
+      _SCL_searchReturn(search);
+      continue;
+    }
+
+    if (search->ply == 0 && from == search->repetitionMoveFrom &&
+      to == search->repetitionMoveTo)
+    {
+      // playing this would repeat the position, count it as a draw
+      _SCL_searchRecordValue(frame,0,from,to);
+      continue;
+    }
+
+    int8_t takenSquare = search->board[to] != '.' ? to : -1;
+    int16_t childBeta = frame->best > frame->alpha ? frame->best : frame->alpha;
+
+    frame->undo = SCL_boardMakeMove(search->board,from,to,'q');
+    search->ply++;
+
+    _SCL_searchFrameInit(frame + 1,frame->depth - 1,-1 * frame->beta,
+      -1 * childBeta,takenSquare);
+  }
+
+  return search->done;
+}
+
+#undef _SCL_SEARCH_INFINITY
+#undef _SCL_SEARCH_MATE_LIMIT
+#undef _SCL_SEARCH_STAGE_ENTER
+#undef _SCL_SEARCH_STAGE_HASH_MOVE
+#undef _SCL_SEARCH_STAGE_MOVES
+#undef _SCL_TT_EXACT
+#undef _SCL_TT_LOWER
+#undef _SCL_TT_UPPER
+#undef _SCL_NO_SQUARE
+
 uint8_t SCL_boardToFEN(SCL_Board board, char *string)
 {
   uint8_t square = 56;
@@ -33,6 +33,8 @@
 #include "watch.h"
 #include "filesystem.h"
 #include "movement.h"
+#include "movement_timer.h"
+#include "movement_time.h"
 #include "shell.h"
 
 #ifndef MOVEMENT_FIRMWARE
@@ -222,6 +224,13 @@ static void _movement_handle_scheduled_tasks(void) {
     }
 }
 
+static void _movement_handle_timers(void) {
+    _movement_timer_advance(watch_rtc_get_date_time(), &movement_state.settings);
+
+    // like scheduled tasks, pending timers keep us out of low energy mode so that they fire on time.
+    if (movement_timer_get_count()) _movement_reset_inactivity_countdown();
+}
+
 void movement_request_tick_frequency(uint8_t freq) {
     // Movement uses the 128 Hz tick internally
     if (freq == 128) return;
@@ -301,6 +310,10 @@ void movement_move_to_next_face(void) {
     movement_move_to_face((movement_state.current_face_idx + 1) % face_max);
 }
 
+void movement_request_performance_level(watch_performance_level_t level) {
+    watch_set_performance_level(level);
+}
+
 void movement_schedule_background_task(watch_date_time date_time) {
     movement_schedule_background_task_for_face(movement_state.current_face_idx, date_time);
 }
@@ -453,6 +466,7 @@ void app_setup(void) {
         alarm_time.unit.second = 59; // after a match, the alarm fires at the next rising edge of CLK_RTC_CNT, so 59 seconds lets us update at :00
         watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_SS);
     }
+    _movement_time_advance(watch_rtc_get_date_time(), &movement_state.settings);
     if (movement_state.le_mode_ticks != -1) {
         watch_disable_extwake_interrupt(BTN_ALARM);
 
@@ -489,10 +503,15 @@ static void _sleep_mode_app_loop(void) {
     while (movement_state.le_mode_ticks == -1) {
         // we also have to handle background tasks here in the mini-runloop
         if (movement_state.needs_background_tasks_handled) _movement_handle_background_tasks();
+        // a background task may have started a timer; its callbacks can only run once we wake up.
+        if (movement_timer_get_count()) _movement_handle_timers();
 
+        _movement_time_advance(watch_rtc_get_date_time(), &movement_state.settings);
         event.event_type = EVENT_LOW_ENERGY_UPDATE;
         watch_faces[movement_state.current_face_idx].loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
 
+        watch_set_performance_level(WATCH_PERFORMANCE_LEVEL_LOW);
+
         // if we need to wake immediately, do it!
         if (movement_state.needs_wake) return;
         // otherwise enter sleep mode, and when the extwake handler is called, it will reset le_mode_ticks and force us out at the next loop.
@@ -536,6 +555,12 @@ bool app_loop(void) {
     // if we have a scheduled background task, handle that here:
     if (event.event_type == EVENT_TICK && movement_state.has_scheduled_background_task) _movement_handle_scheduled_tasks();
 
+    // likewise for any Movement timers:
+    if (event.event_type == EVENT_TICK && movement_timer_get_count()) _movement_handle_timers();
+
+    // and keep the shared notion of the current instant up to date for the faces that use it.
+    if (event.event_type == EVENT_TICK) _movement_time_advance(watch_rtc_get_date_time(), &movement_state.settings);
+
     // if we have timed out of our low energy mode countdown, enter low energy mode.
     if (movement_state.le_mode_ticks == 0) {
         movement_state.le_mode_ticks = -1;
@@ -602,6 +627,9 @@ bool app_loop(void) {
         }
     }
 
+    // whatever the watch face needed a faster clock for, it's done now.
+    watch_set_performance_level(WATCH_PERFORMANCE_LEVEL_LOW);
+
     // Now that we've handled all display update tasks, handle the alarm.
     if (movement_state.alarm_ticks >= 0) {
         uint8_t buzzer_phase = (movement_state.alarm_ticks + 80) % 128;
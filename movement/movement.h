@@ -293,6 +293,11 @@ void movement_illuminate_led(void);
 
 void movement_request_tick_frequency(uint8_t freq);
 
+// runs the CPU at a higher clock speed for compute-heavy work (see watch_set_performance_level). the level
+// only lasts for the current call into your watch face: Movement drops back to the low performance level
+// as soon as it returns, and before the buzzer plays or the watch goes to sleep.
+void movement_request_performance_level(watch_performance_level_t level);
+
 // note: watch faces can only schedule a background task when in the foreground, since
 // movement will associate the scheduled task with the currently active face.
 void movement_schedule_background_task(watch_date_time date_time);
@@ -125,6 +125,7 @@
 #include "smallchess_face.h"
 #include "beeps_face.h"
 #include "metronome_face.h"
+#include "activity_face.h"
 // New includes go above this line.
 
 #endif // MOVEMENT_FACES_H_
@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdbool.h>
+#include "movement_sensors.h"
+#include "thermistor_driver.h"
+#include "watch.h"
+#include "watch_utility.h"
+
+typedef struct {
+    uint32_t timestamp;     // when the reading was taken, in the RTC's local time
+    bool valid;
+} movement_sensor_reading_t;
+
+static movement_sensor_reading_t _readings[MOVEMENT_NUM_SENSORS];
+static uint8_t _subscriptions;
+static int16_t _temperature;
+static uint16_t _vcc_voltage;
+
+static inline uint32_t _now(void) {
+    // like the timers, readings only need a clock that's consistent with itself, so the RTC's local time will do.
+    return watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+}
+
+static bool _is_fresh(movement_sensor_t sensor, uint32_t now, uint32_t max_age) {
+    // if the clock was set back, now - timestamp wraps around and the reading counts as stale.
+    return max_age && _readings[sensor].valid && now - _readings[sensor].timestamp <= max_age;
+}
+
+static void _sample(movement_sensor_t sensor, uint32_t now) {
+    uint8_t sensors = _subscriptions | (1 << sensor);
+
+    // thermistor_driver_enable powers up the ADC along with the thermistor, so the voltage reading can share it.
+    if (sensors & (1 << MOVEMENT_SENSOR_TEMPERATURE)) thermistor_driver_enable();
+    else watch_enable_adc();
+
+    if (sensors & (1 << MOVEMENT_SENSOR_TEMPERATURE)) _temperature = thermistor_driver_get_temperature();
+    if (sensors & (1 << MOVEMENT_SENSOR_VCC)) _vcc_voltage = watch_get_vcc_voltage();
+
+    if (sensors & (1 << MOVEMENT_SENSOR_TEMPERATURE)) thermistor_driver_disable();
+    else watch_disable_adc();
+
+    for (uint8_t i = 0; i < MOVEMENT_NUM_SENSORS; i++) {
+        if (sensors & (1 << i)) {
+            _readings[i].timestamp = now;
+            _readings[i].valid = true;
+        }
+    }
+}
+
+void movement_sensors_subscribe(movement_sensor_t sensor) {
+    _subscriptions |= 1 << sensor;
+}
+
+int16_t movement_sensors_get_temperature_centi(uint32_t max_age) {
+    uint32_t now = _now();
+    if (!_is_fresh(MOVEMENT_SENSOR_TEMPERATURE, now, max_age)) _sample(MOVEMENT_SENSOR_TEMPERATURE, now);
+    return _temperature;
+}
+
+float movement_sensors_get_temperature(uint32_t max_age) {
+    return movement_sensors_get_temperature_centi(max_age) / 100.0f;
+}
+
+uint16_t movement_sensors_get_vcc_voltage(uint32_t max_age) {
+    uint32_t now = _now();
+    if (!_is_fresh(MOVEMENT_SENSOR_VCC, now, max_age)) _sample(MOVEMENT_SENSOR_VCC, now);
+    return _vcc_voltage;
+}
@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MOVEMENT_SENSORS_H_
+#define MOVEMENT_SENSORS_H_
+#include <stdint.h>
+
+// Movement sensor hub
+// Reading the thermistor or the battery voltage means powering up and calibrating the ADC, which costs
+// more than the conversion itself. Several faces can want a reading in the same minute (i.e. a couple of
+// temperature loggers in the background pass, and the clock checking the battery), so rather than have
+// each one power the ADC on its own, faces ask Movement for a reading no older than a given number of
+// seconds, and Movement keeps the last reading of each sensor to answer from.
+//
+// When a reading has to be taken, Movement also refreshes every sensor that a face has subscribed to,
+// with the ADC powered up once for all of them. A face that reads a sensor in the background should
+// subscribe to it in its setup function; then the first face to ask in a background pass takes one
+// conversion that serves every other subscriber in that pass. Background tasks run a minute apart, so
+// ask for a reading younger than that (i.e. 30 seconds), or you'll get the one from the last pass.
+
+typedef enum {
+    MOVEMENT_SENSOR_TEMPERATURE = 0,    // the thermistor on the temperature sensor board
+    MOVEMENT_SENSOR_VCC,                // the supply voltage, in millivolts
+    MOVEMENT_NUM_SENSORS
+} movement_sensor_t;
+
+/** @brief Asks Movement to refresh a sensor whenever it takes a reading of any other sensor.
+  * @param sensor The sensor to subscribe to. There's no need to unsubscribe; subscriptions last until reset.
+  */
+void movement_sensors_subscribe(movement_sensor_t sensor);
+
+/** @brief Returns the temperature from the thermistor, in hundredths of a degree Celsius.
+  * @param max_age The age in seconds beyond which the last reading is too old, and a new one is taken.
+  *                Pass 0 to always take a new reading.
+  * @note Only meaningful with a temperature sensor board installed.
+  */
+int16_t movement_sensors_get_temperature_centi(uint32_t max_age);
+
+/** @brief Returns the temperature from the thermistor, in degrees Celsius.
+  * @param max_age The age in seconds beyond which the last reading is too old, and a new one is taken.
+  *                Pass 0 to always take a new reading.
+  * @note Only meaningful with a temperature sensor board installed.
+  */
+float movement_sensors_get_temperature(uint32_t max_age);
+
+/** @brief Returns the supply voltage in millivolts, as watch_get_vcc_voltage does.
+  * @param max_age The age in seconds beyond which the last reading is too old, and a new one is taken.
+  *                Pass 0 to always take a new reading.
+  */
+uint16_t movement_sensors_get_vcc_voltage(uint32_t max_age);
+
+#endif // MOVEMENT_SENSORS_H_
@@ -0,0 +1,146 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stddef.h>
+#include <math.h>
+#include "movement_time.h"
+#include "movement_tz.h"
+#include "watch_utility.h"
+
+#define SECONDS_PER_DAY 86400
+#define SECONDS_PER_JULIAN_CENTURY 3155760000.0
+#define SECONDS_PER_JULIAN_MILLENNIUM 31557600000.0
+
+typedef enum {
+    DERIVED_JULIAN_DATE = 1 << 0,
+    DERIVED_JULIAN_CENTURIES = 1 << 1,
+    DERIVED_JULIAN_MILLENNIA = 1 << 2,
+    DERIVED_GMST = 1 << 3,
+} movement_time_derived_t;
+
+static movement_settings_t *_settings;
+static watch_date_time _local = {.reg = 0};
+static uint8_t _zone = MOVEMENT_TZ_CACHE_EMPTY;
+static int64_t _j2000;
+static movement_tz_cache_t _tz_cache = MOVEMENT_TZ_CACHE_INIT;
+
+static uint8_t _valid;
+static double _julian_date;
+static double _julian_centuries;
+static double _julian_millennia;
+static double _gmst;
+
+static inline uint32_t _seconds_into_hour(watch_date_time date_time) {
+    return date_time.unit.minute * 60 + date_time.unit.second;
+}
+
+void _movement_time_advance(watch_date_time date_time, movement_settings_t *settings) {
+    _settings = settings;
+    if (date_time.reg == _local.reg && settings->bit.time_zone == _zone) return;
+
+    // same hour, same time zone: just count the seconds since last time, as long as that doesn't carry us
+    // past a change of UTC offset.
+    if (settings->bit.time_zone == _zone && (date_time.reg >> 12) == (_local.reg >> 12)) {
+        int64_t j2000 = _j2000 + ((int64_t)((int32_t)_seconds_into_hour(date_time) - (int32_t)_seconds_into_hour(_local)) << MOVEMENT_TIME_FRACTION_BITS);
+        uint32_t timestamp = (uint32_t)(j2000 >> MOVEMENT_TIME_FRACTION_BITS) + MOVEMENT_TIME_J2000_UNIX;
+        if (timestamp - _tz_cache.start < _tz_cache.end - _tz_cache.start) {
+            _j2000 = j2000;
+            _local = date_time;
+            _valid = 0;
+            return;
+        }
+    }
+
+    uint32_t timestamp = movement_tz_local_to_utc(settings->bit.time_zone, watch_utility_date_time_to_unix_time(date_time, 0), &_tz_cache);
+    _j2000 = ((int64_t)timestamp - MOVEMENT_TIME_J2000_UNIX) << MOVEMENT_TIME_FRACTION_BITS;
+    _local = date_time;
+    _zone = settings->bit.time_zone;
+    _valid = 0;
+}
+
+static void _movement_time_sync(void) {
+    // faces may ask between ticks, i.e. on activate, or at a higher tick frequency than the one we advance on.
+    if (_settings != NULL) _movement_time_advance(watch_rtc_get_date_time(), _settings);
+}
+
+int64_t movement_time_get_j2000(void) {
+    _movement_time_sync();
+    return _j2000;
+}
+
+uint32_t movement_time_get_unix_time(void) {
+    _movement_time_sync();
+    return (uint32_t)(_j2000 >> MOVEMENT_TIME_FRACTION_BITS) + MOVEMENT_TIME_J2000_UNIX;
+}
+
+static inline double _seconds_since_j2000(void) {
+    return (double)_j2000 / (1 << MOVEMENT_TIME_FRACTION_BITS);
+}
+
+double movement_time_get_julian_date(void) {
+    _movement_time_sync();
+    if (!(_valid & DERIVED_JULIAN_DATE)) {
+        _julian_date = MOVEMENT_TIME_J2000_JD + _seconds_since_j2000() / SECONDS_PER_DAY;
+        _valid |= DERIVED_JULIAN_DATE;
+    }
+    return _julian_date;
+}
+
+double movement_time_get_julian_centuries(void) {
+    _movement_time_sync();
+    if (!(_valid & DERIVED_JULIAN_CENTURIES)) {
+        _julian_centuries = _seconds_since_j2000() / SECONDS_PER_JULIAN_CENTURY;
+        _valid |= DERIVED_JULIAN_CENTURIES;
+    }
+    return _julian_centuries;
+}
+
+double movement_time_get_julian_millennia(void) {
+    _movement_time_sync();
+    if (!(_valid & DERIVED_JULIAN_MILLENNIA)) {
+        _julian_millennia = _seconds_since_j2000() / SECONDS_PER_JULIAN_MILLENNIUM;
+        _valid |= DERIVED_JULIAN_MILLENNIA;
+    }
+    return _julian_millennia;
+}
+
+double movement_time_get_gmst(void) {
+    double t = movement_time_get_julian_centuries();
+    if (!(_valid & DERIVED_GMST)) {
+        // the formula astrolib uses (IAU 1982), but with whole days and the time of day split up front. the
+        // sidereal rate is 360.98564736629 degrees per day, and the 360 in that contributes nothing, so a whole
+        // day only advances GMST by 0.98564736629 degrees; that keeps the big term small enough to stay exact.
+        // days are counted from UNIX midnights, since seconds since J2000 overflow an int32_t in 2068.
+        uint32_t timestamp = (uint32_t)(_j2000 >> MOVEMENT_TIME_FRACTION_BITS) + MOVEMENT_TIME_J2000_UNIX;
+        uint32_t days = timestamp / SECONDS_PER_DAY;
+        int32_t time_of_day = (int32_t)(timestamp - days * SECONDS_PER_DAY) - SECONDS_PER_DAY / 2;
+        double gmst = 280.46061837 + 0.98564736629 * ((int32_t)days - MOVEMENT_TIME_J2000_UNIX / SECONDS_PER_DAY)
+                    + 360.98564736629 * time_of_day / SECONDS_PER_DAY + 0.000387933 * t * t - t * t * t / 38710000.0;
+        gmst = fmod(gmst, 360.0);
+        if (gmst < 0) gmst += 360.0;
+        _gmst = gmst / 15.0;
+        _valid |= DERIVED_GMST;
+    }
+    return _gmst;
+}
@@ -0,0 +1,84 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MOVEMENT_TIME_H_
+#define MOVEMENT_TIME_H_
+#include <stdint.h>
+#include "movement.h"
+
+// Movement time service
+// Astronomical watch faces all want the current instant in UTC, usually as a Julian date, and converting
+// the RTC's local date and time to one in software floating point costs more than most of them do with
+// it. Movement keeps the current instant here instead, as a 64-bit fixed point count of seconds since
+// the J2000 epoch (2000-01-01 12:00:00 UTC), and advances it on every tick. Within the same hour that's
+// a subtraction; only when the hour changes (or the time or time zone is set) does it convert the
+// whole date again. The home time zone is resolved with movement_tz, so it follows daylight saving time.
+//
+// Derived quantities like the Julian date and Greenwich mean sidereal time are computed the first time
+// a face asks for them in a given second, and cached until the next one, so any number of faces and
+// calls per tick share a single conversion. Like the rest of the watch, this ignores leap seconds and
+// the difference between UTC and UT1 or TT; astrolib applies its own correction to TT where it matters.
+
+#define MOVEMENT_TIME_FRACTION_BITS 16
+#define MOVEMENT_TIME_J2000_UNIX 946728000  // 2000-01-01 12:00:00 UTC
+#define MOVEMENT_TIME_J2000_JD 2451545.0
+
+/** @brief Returns the current instant, in seconds since J2000, as a signed fixed point number with
+  *        MOVEMENT_TIME_FRACTION_BITS fractional bits.
+  * @details The RTC counts whole seconds, so the fraction is always zero for now; it's there so that
+  *          callers can add intervals to it without losing precision.
+  */
+int64_t movement_time_get_j2000(void);
+
+/** @brief Returns the current instant as a UNIX timestamp, in UTC.
+  */
+uint32_t movement_time_get_unix_time(void);
+
+/** @brief Returns the current Julian date (in UTC).
+  */
+double movement_time_get_julian_date(void);
+
+/** @brief Returns the number of Julian centuries (36525 days) since J2000.
+  */
+double movement_time_get_julian_centuries(void);
+
+/** @brief Returns the number of Julian millennia since J2000, which is what VSOP87 takes as input.
+  */
+double movement_time_get_julian_millennia(void);
+
+/** @brief Returns Greenwich mean sidereal time, in hours (0 to 24). Same as astrolib's astro_get_GMST
+  *        for the current Julian date, but without the loss of precision from multiplying a large
+  *        Julian date by the sidereal rate.
+  */
+double movement_time_get_gmst(void);
+
+/** @brief Brings the current instant up to date with the RTC.
+  * @param date_time The current date and time, as returned by watch_rtc_get_date_time.
+  * @param settings A pointer to the global Movement settings, for the home time zone.
+  * @details Called by Movement on every tick. You should not call this from your watch face; the
+  *          movement_time_get functions are always up to date.
+  */
+void _movement_time_advance(watch_date_time date_time, movement_settings_t *settings);
+
+#endif // MOVEMENT_TIME_H_
@@ -0,0 +1,235 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include "movement_timer.h"
+#include "watch_utility.h"
+
+#define WHEEL_MASK (MOVEMENT_TIMER_WHEEL_SIZE - 1)
+#define WHEEL_INDEX(t, level) (((t) >> ((level) * MOVEMENT_TIMER_WHEEL_BITS)) & WHEEL_MASK)
+
+// if the clock jumps forward by more than this many seconds (i.e. the user set the time), we rebuild the
+// wheel rather than stepping through every second in between.
+#define WHEEL_MAX_STEPS (MOVEMENT_TIMER_WHEEL_SIZE * MOVEMENT_TIMER_WHEEL_SIZE)
+
+static movement_timer_t *_wheel[MOVEMENT_TIMER_WHEEL_LEVELS][MOVEMENT_TIMER_WHEEL_SIZE];
+static movement_timer_t *_overflow;
+static uint32_t _wheel_now;
+static uint16_t _num_timers;
+static bool _advancing;
+
+static inline uint32_t _timestamp(watch_date_time date_time) {
+    // the wheel runs on the RTC's local time; time zones don't matter as long as we're consistent.
+    return watch_utility_date_time_to_unix_time(date_time, 0);
+}
+
+static inline void _link(movement_timer_t **head, movement_timer_t *timer) {
+    timer->next = *head;
+    if (timer->next) timer->next->pprev = &timer->next;
+    timer->pprev = head;
+    *head = timer;
+}
+
+static inline void _unlink(movement_timer_t *timer) {
+    *timer->pprev = timer->next;
+    if (timer->next) timer->next->pprev = timer->pprev;
+    timer->next = NULL;
+    timer->pprev = NULL;
+}
+
+static void _insert(movement_timer_t *timer) {
+    uint32_t delta = timer->expires - _wheel_now;
+
+    for(uint8_t level = 0; level < MOVEMENT_TIMER_WHEEL_LEVELS; level++) {
+        if (delta < (1UL << ((level + 1) * MOVEMENT_TIMER_WHEEL_BITS))) {
+            _link(&_wheel[level][WHEEL_INDEX(timer->expires, level)], timer);
+            return;
+        }
+    }
+
+    _link(&_overflow, timer);
+}
+
+static void _cascade(movement_timer_t **head) {
+    // detach the whole list first: timers from the overflow list may well go right back onto it.
+    movement_timer_t *pending = *head;
+    movement_timer_t *timer;
+    if (pending) pending->pprev = &pending;
+    *head = NULL;
+
+    while ((timer = pending) != NULL) {
+        _unlink(timer);
+        _insert(timer);
+    }
+}
+
+static void _expire(movement_timer_t *timer, movement_settings_t *settings) {
+    _unlink(timer);
+    _num_timers--;
+    if (timer->callback) timer->callback(timer, settings, timer->context);
+}
+
+static void _step(movement_settings_t *settings) {
+    _wheel_now++;
+
+    // when a lower level wraps around, move the timers in the next slot of the level above down to where they belong.
+    if (WHEEL_INDEX(_wheel_now, 0) == 0) {
+        if (WHEEL_INDEX(_wheel_now, 1) == 0) {
+            if (WHEEL_INDEX(_wheel_now, 2) == 0) {
+                if (WHEEL_INDEX(_wheel_now, 3) == 0) _cascade(&_overflow);
+                _cascade(&_wheel[3][WHEEL_INDEX(_wheel_now, 3)]);
+            }
+            _cascade(&_wheel[2][WHEEL_INDEX(_wheel_now, 2)]);
+        }
+        _cascade(&_wheel[1][WHEEL_INDEX(_wheel_now, 1)]);
+    }
+
+    // everything left in the current level 0 slot expires now. callbacks may start new timers, but those
+    // will always land in a later slot, so this loop terminates.
+    movement_timer_t **head = &_wheel[0][WHEEL_INDEX(_wheel_now, 0)];
+    while (*head != NULL) _expire(*head, settings);
+}
+
+static void _rebuild(uint32_t now, movement_settings_t *settings) {
+    // pull every timer off the wheel...
+    movement_timer_t *pending = NULL;
+    movement_timer_t *timer;
+    for(uint8_t level = 0; level < MOVEMENT_TIMER_WHEEL_LEVELS; level++) {
+        for(uint8_t i = 0; i < MOVEMENT_TIMER_WHEEL_SIZE; i++) {
+            while ((timer = _wheel[level][i]) != NULL) {
+                _unlink(timer);
+                _link(&pending, timer);
+            }
+        }
+    }
+    while ((timer = _overflow) != NULL) {
+        _unlink(timer);
+        _link(&pending, timer);
+    }
+
+    // ...then put the ones that are still in the future back, relative to the new time.
+    _wheel_now = now;
+    while ((timer = pending) != NULL) {
+        if (timer->expires > now) {
+            _unlink(timer);
+            _insert(timer);
+        } else {
+            _expire(timer, settings);
+        }
+    }
+}
+
+static void _start(movement_timer_t *timer, uint32_t now, uint32_t expires) {
+    if (timer->pprev) _unlink(timer);
+    else _num_timers++;
+
+    // if the wheel was idle, it may not have been advanced in a while; catch it up for free.
+    if (_num_timers == 1 && !_advancing) _wheel_now = now;
+    // the current slot has already been handled, so the soonest we can fire is the next one.
+    if ((int32_t)(expires - _wheel_now) <= 0) expires = _wheel_now + 1;
+
+    timer->expires = expires;
+    _insert(timer);
+}
+
+void movement_timer_init(movement_timer_t *timer, const char *name, movement_timer_callback_t callback, void *context) {
+    timer->next = NULL;
+    timer->pprev = NULL;
+    timer->expires = 0;
+    timer->name = name;
+    timer->callback = callback;
+    timer->context = context;
+}
+
+void movement_timer_start(movement_timer_t *timer, uint32_t seconds) {
+    uint32_t now = _timestamp(watch_rtc_get_date_time());
+    _start(timer, now, now + seconds);
+}
+
+void movement_timer_start_at(movement_timer_t *timer, watch_date_time date_time) {
+    _start(timer, _timestamp(watch_rtc_get_date_time()), _timestamp(date_time));
+}
+
+void movement_timer_cancel(movement_timer_t *timer) {
+    if (timer->pprev == NULL) return;
+
+    _unlink(timer);
+    _num_timers--;
+}
+
+bool movement_timer_is_active(movement_timer_t *timer) {
+    return timer->pprev != NULL;
+}
+
+uint32_t movement_timer_get_remaining(movement_timer_t *timer) {
+    if (timer->pprev == NULL) return 0;
+
+    uint32_t now = _timestamp(watch_rtc_get_date_time());
+    if ((int32_t)(timer->expires - now) <= 0) return 0;
+
+    return timer->expires - now;
+}
+
+uint16_t movement_timer_get_count(void) {
+    return _num_timers;
+}
+
+void _movement_timer_advance(watch_date_time date_time, movement_settings_t *settings) {
+    if (_num_timers == 0) return;
+
+    uint32_t now = _timestamp(date_time);
+    int32_t steps = now - _wheel_now;
+
+    _advancing = true;
+    if (steps < 0 || steps > WHEEL_MAX_STEPS) {
+        // the clock was set; re-sort the timers against the new time.
+        _rebuild(now, settings);
+    } else {
+        while (steps-- > 0) _step(settings);
+    }
+    _advancing = false;
+}
+
+int movement_timer_cmd_timers(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+
+    uint32_t now = _timestamp(watch_rtc_get_date_time());
+    movement_timer_t *timer;
+
+    for(uint8_t level = 0; level < MOVEMENT_TIMER_WHEEL_LEVELS; level++) {
+        for(uint8_t i = 0; i < MOVEMENT_TIMER_WHEEL_SIZE; i++) {
+            for(timer = _wheel[level][i]; timer != NULL; timer = timer->next) {
+                printf("%s\t%lds\r\n", timer->name ? timer->name : "?", (long)(timer->expires - now));
+            }
+        }
+    }
+    for(timer = _overflow; timer != NULL; timer = timer->next) {
+        printf("%s\t%lds\r\n", timer->name ? timer->name : "?", (long)(timer->expires - now));
+    }
+    printf("%u active\r\n", _num_timers);
+
+    return 0;
+}
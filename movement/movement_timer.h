@@ -0,0 +1,121 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MOVEMENT_TIMER_H_
+#define MOVEMENT_TIMER_H_
+#include <stdbool.h>
+#include <stdint.h>
+#include "movement.h"
+
+// Movement timers
+// A watch face that needs to do something at a point in the future can ask Movement for a timer. Unlike
+// movement_schedule_background_task, which gives each face a single slot, a face can run as many timers
+// as it likes: the timer structs are owned by the watch face (typically stored in its context), and
+// Movement only links them into a hierarchical timing wheel. Starting and cancelling a timer are O(1),
+// and all timers are driven from Movement's one-second tick, so they don't need any hardware of their own.
+//
+// The wheel has four levels of 64 slots each. Level 0 holds timers expiring in the next 64 seconds, one
+// slot per second; level 1 holds timers expiring in the next 64 minutes, one slot per 64 seconds; and so
+// on up to level 3, which covers about 194 days. Timers further out than that wait on an overflow list.
+// As time passes, each slot of a higher level is "cascaded" into the levels below it, so every timer is
+// touched at most once per level before it fires.
+//
+// When a timer expires, Movement calls its callback from the main loop (not from an interrupt), so it's
+// safe to play a sound, update state or start another timer from there. Don't update the display unless
+// your face is in the foreground. While any timer is pending, the watch will not enter low energy mode.
+
+#define MOVEMENT_TIMER_WHEEL_BITS 6
+#define MOVEMENT_TIMER_WHEEL_SIZE (1 << MOVEMENT_TIMER_WHEEL_BITS)
+#define MOVEMENT_TIMER_WHEEL_LEVELS 4
+
+typedef struct movement_timer movement_timer_t;
+
+/** @brief A function to call when a timer expires.
+  * @param timer The timer that expired. It is no longer active, so you may restart it from the callback.
+  * @param settings A pointer to the global Movement settings.
+  * @param context The context pointer that was passed to movement_timer_start.
+  */
+typedef void (*movement_timer_callback_t)(movement_timer_t *timer, movement_settings_t *settings, void *context);
+
+struct movement_timer {
+    // private: managed by Movement, don't touch.
+    movement_timer_t *next;
+    movement_timer_t **pprev;
+    uint32_t expires;
+
+    // public: set by movement_timer_init.
+    const char *name;
+    movement_timer_callback_t callback;
+    void *context;
+};
+
+/** @brief Initializes a timer. Call this once, before you start the timer for the first time.
+  * @param timer A pointer to the timer. This memory must stay valid for as long as the timer is active.
+  * @param name A short, human-readable name for the timer, for debugging (i.e. the `timers` shell command).
+  * @param callback The function to call when the timer expires.
+  * @param context A pointer that will be passed to the callback; typically your watch face's context.
+  */
+void movement_timer_init(movement_timer_t *timer, const char *name, movement_timer_callback_t callback, void *context);
+
+/** @brief Starts a timer that will expire after the given number of seconds. If the timer is already
+  *        active, it is rescheduled.
+  * @param timer A pointer to an initialized timer.
+  * @param seconds The number of seconds from now. 0 means "at the next tick".
+  */
+void movement_timer_start(movement_timer_t *timer, uint32_t seconds);
+
+/** @brief Starts a timer that will expire at the given date and time. If the timer is already active,
+  *        it is rescheduled. If the date and time is in the past, the timer expires at the next tick.
+  * @param timer A pointer to an initialized timer.
+  * @param date_time The date and time in the watch's local time, i.e. as returned by watch_rtc_get_date_time.
+  */
+void movement_timer_start_at(movement_timer_t *timer, watch_date_time date_time);
+
+/** @brief Cancels a timer. It's safe to call this on a timer that isn't active.
+  * @param timer A pointer to an initialized timer.
+  */
+void movement_timer_cancel(movement_timer_t *timer);
+
+/** @brief Returns true if the timer is waiting to expire.
+  */
+bool movement_timer_is_active(movement_timer_t *timer);
+
+/** @brief Returns the number of seconds until the timer expires, or 0 if it isn't active.
+  */
+uint32_t movement_timer_get_remaining(movement_timer_t *timer);
+
+/** @brief Returns the number of active timers, across all watch faces.
+  */
+uint16_t movement_timer_get_count(void);
+
+/** @brief Advances the timing wheel to the given time, calling the callbacks of all timers that expired.
+  * @param date_time The current date and time, as returned by watch_rtc_get_date_time.
+  * @param settings A pointer to the global Movement settings, to pass to the callbacks.
+  * @details Called by Movement from the main loop. You should not call this from your watch face.
+  */
+void _movement_timer_advance(watch_date_time date_time, movement_settings_t *settings);
+
+int movement_timer_cmd_timers(int argc, char *argv[]);
+
+#endif // MOVEMENT_TIMER_H_
@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stddef.h>
+#include "movement_tz.h"
+#include "movement.h"
+
+static inline uint32_t _transition_time(uint32_t transition) {
+    return MOVEMENT_TZ_EPOCH + (transition >> 8) * MOVEMENT_TZ_QUANTUM;
+}
+
+static inline int32_t _transition_offset(uint32_t transition) {
+    return (int8_t)(transition & 0xFF) * MOVEMENT_TZ_QUANTUM;
+}
+
+int32_t movement_tz_get_utc_offset(uint8_t zone, uint32_t utc_timestamp, movement_tz_cache_t *cache) {
+    // unsigned wraparound makes this a single comparison: anything before start ends up huge.
+    if (cache != NULL && cache->zone == zone && utc_timestamp - cache->start < cache->end - cache->start) {
+        return cache->offset;
+    }
+
+    uint32_t start = 0;
+    uint32_t end = UINT32_MAX;
+    int32_t offset;
+    const movement_tz_zone_t *tz = &movement_tz_zones[zone];
+
+    if (tz->num_transitions == 0) {
+        offset = movement_timezone_offsets[zone] * 60;
+    } else {
+        // find the last transition at or before the timestamp. the first one is at the start of the table's range,
+        // and timestamps before it just get its offset.
+        uint16_t low = 0;
+        uint16_t high = tz->num_transitions;
+        while (high - low > 1) {
+            uint16_t middle = (low + high) / 2;
+            if (_transition_time(tz->transitions[middle]) <= utc_timestamp) low = middle;
+            else high = middle;
+        }
+        if (low > 0) start = _transition_time(tz->transitions[low]);
+        if (high < tz->num_transitions) end = _transition_time(tz->transitions[high]);
+        offset = _transition_offset(tz->transitions[low]);
+    }
+
+    if (cache != NULL) {
+        cache->start = start;
+        cache->end = end;
+        cache->offset = offset;
+        cache->zone = zone;
+    }
+
+    return offset;
+}
+
+uint32_t movement_tz_local_to_utc(uint8_t zone, uint32_t local_timestamp, movement_tz_cache_t *cache) {
+    // guess with the standard offset, then check the guess against the offset in effect at the time it gives.
+    int32_t guess = movement_tz_get_utc_offset(zone, local_timestamp - movement_timezone_offsets[zone] * 60, cache);
+    uint32_t utc_timestamp = local_timestamp - guess;
+    int32_t offset = movement_tz_get_utc_offset(zone, utc_timestamp, cache);
+
+    // if they disagree, the local time is in the hour that the clocks skip, so take it in the offset from before.
+    if (offset != guess) utc_timestamp = local_timestamp - offset;
+
+    return utc_timestamp;
+}
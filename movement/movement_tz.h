@@ -0,0 +1,86 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef MOVEMENT_TZ_H_
+#define MOVEMENT_TZ_H_
+#include <stdint.h>
+
+// Daylight saving time
+// movement_timezone_offsets only holds standard offsets. For the time zones that observe daylight saving
+// time, movement_tz_tables.c holds every change of UTC offset between 2020 and 2083, the years the RTC
+// can hold. It's generated ahead of time by utils/dst_tables/generate_dst_tables.py from the tzdata
+// snapshot in that directory, so the watch never has to evaluate the rules itself; to change which
+// zones have tables, edit utils/dst_tables/zones.txt and run the script again.
+//
+// Each transition is packed into one word: the upper 24 bits are the time of the change, in quarter
+// hours since 2020-01-01 00:00 UTC, and the lower 8 bits are the new UTC offset, in signed quarter
+// hours. The first entry is at time 0, and holds the offset in effect at the start of 2020.
+//
+// Looking up an offset takes a cache, which remembers the interval between the last two transitions
+// that were looked up. Most lookups are for the current time, which lands in the same interval until
+// the next change of offset, so each tick costs one comparison rather than a search.
+
+#define MOVEMENT_TZ_NUM_ZONES 41
+#define MOVEMENT_TZ_EPOCH 1577836800    // 2020-01-01 00:00:00 UTC
+#define MOVEMENT_TZ_QUANTUM 900         // transitions and offsets are in units of 15 minutes
+
+typedef struct {
+    const char *name;               // the IANA name of the zone, i.e. "America/New_York"
+    const uint32_t *transitions;
+    uint16_t num_transitions;
+} movement_tz_zone_t;
+
+typedef struct {
+    uint32_t start;     // the UTC timestamp at which the cached offset takes effect
+    uint32_t end;       // the UTC timestamp of the next change, or UINT32_MAX if there isn't one
+    int32_t offset;     // the cached UTC offset, in seconds
+    uint8_t zone;       // the index of the cached time zone, or MOVEMENT_TZ_CACHE_EMPTY
+} movement_tz_cache_t;
+
+#define MOVEMENT_TZ_CACHE_EMPTY 0xFF
+// a zeroed cache is also empty, since its interval has no length.
+#define MOVEMENT_TZ_CACHE_INIT { 0, 0, 0, MOVEMENT_TZ_CACHE_EMPTY }
+
+/// Indexed by the same time zone indexes as movement_timezone_offsets. Zones without DST have no transitions.
+extern const movement_tz_zone_t movement_tz_zones[MOVEMENT_TZ_NUM_ZONES];
+
+/** @brief Returns the UTC offset in effect in a time zone at a given time, including daylight saving time.
+  * @param zone An index into movement_timezone_offsets.
+  * @param utc_timestamp The time, as a UNIX timestamp.
+  * @param cache A cache to check first and update after, or NULL to always search the table.
+  * @return The UTC offset in seconds.
+  */
+int32_t movement_tz_get_utc_offset(uint8_t zone, uint32_t utc_timestamp, movement_tz_cache_t *cache);
+
+/** @brief Converts a local time in a time zone to a UNIX timestamp, accounting for daylight saving time.
+  * @param zone An index into movement_timezone_offsets.
+  * @param local_timestamp The local time, encoded as if it were a UNIX timestamp (i.e. the result of
+  *                        watch_utility_date_time_to_unix_time with a UTC offset of 0).
+  * @param cache A cache to check first and update after, or NULL to always search the table.
+  * @return The UNIX timestamp. A local time that's skipped when the clocks go forward is treated as
+  *         being in the old offset; one that happens twice when they go back is taken the second time.
+  */
+uint32_t movement_tz_local_to_utc(uint8_t zone, uint32_t local_timestamp, movement_tz_cache_t *cache);
+
+#endif // MOVEMENT_TZ_H_
@@ -0,0 +1,371 @@
+// Generated by utils/dst_tables/generate_dst_tables.py from tzdata 2025b; don't edit.
+// See movement_tz.h for the format.
+
+#include "movement_tz.h"
+
+static const uint32_t _europe_berlin[] = {
+    0x00000004, 0x00210408, 0x006fc404, 0x00a98408, 0x00fae404, 0x01320408,
+    0x01836404, 0x01ba8408, 0x020be404, 0x0245a408, 0x02946404, 0x02ce2408,
+    0x031ce404, 0x0356a408, 0x03a56404, 0x03df2408, 0x04308404, 0x0467a408,
+    0x04b90404, 0x04f02408, 0x05418404, 0x057b4408, 0x05ca0404, 0x0603c408,
+    0x06528404, 0x068c4408, 0x06dda404, 0x0714c408, 0x07662404, 0x079d4408,
+    0x07eea404, 0x0825c408, 0x08772404, 0x08b0e408, 0x08ffa404, 0x09396408,
+    0x09882404, 0x09c1e408, 0x0a134404, 0x0a4a6408, 0x0a9bc404, 0x0ad2e408,
+    0x0b244404, 0x0b5e0408, 0x0bacc404, 0x0be68408, 0x0c354404, 0x0c6f0408,
+    0x0cbdc404, 0x0cf78408, 0x0d48e404, 0x0d800408, 0x0dd16404, 0x0e088408,
+    0x0e59e404, 0x0e93a408, 0x0ee26404, 0x0f1c2408, 0x0f6ae404, 0x0fa4a408,
+    0x0ff60404, 0x102d2408, 0x107e8404, 0x10b5a408, 0x11070404, 0x1140c408,
+    0x118f8404, 0x11c94408, 0x12180404, 0x1251c408, 0x12a08404, 0x12da4408,
+    0x132ba404, 0x1362c408, 0x13b42404, 0x13eb4408, 0x143ca404, 0x14766408,
+    0x14c52404, 0x14fee408, 0x154da404, 0x15876408, 0x15d8c404, 0x160fe408,
+    0x16614404, 0x16986408, 0x16e9c404, 0x1720e408, 0x17724404, 0x17ac0408,
+    0x17fac404, 0x18348408, 0x18834404, 0x18bd0408, 0x190e6404, 0x19458408,
+    0x1996e404, 0x19ce0408, 0x1a1f6404, 0x1a592408, 0x1aa7e404, 0x1ae1a408,
+    0x1b306404, 0x1b6a2408, 0x1bb8e404, 0x1bf2a408, 0x1c440404, 0x1c7b2408,
+    0x1ccc8404, 0x1d03a408, 0x1d550404, 0x1d8ec408, 0x1ddd8404, 0x1e174408,
+    0x1e660404, 0x1e9fc408, 0x1ef12404, 0x1f284408, 0x1f79a404, 0x1fb0c408,
+    0x20022404, 0x203be408, 0x208aa404, 0x20c46408, 0x21132404, 0x214ce408,
+    0x219ba404, 0x21d56408, 0x2226c404,
+};
+
+static const uint32_t _australia_adelaide[] = {
+    0x0000002a, 0x00238226, 0x0067c22a, 0x00ac0226, 0x00f0422a, 0x01348226,
+    0x0178c22a, 0x01bd0226, 0x0201422a, 0x02482226, 0x028c622a, 0x02d0a226,
+    0x0314e22a, 0x03592226, 0x039d622a, 0x03e1a226, 0x0425e22a, 0x046a2226,
+    0x04ae622a, 0x04f2a226, 0x0539822a, 0x057dc226, 0x05c2022a, 0x06064226,
+    0x064a822a, 0x068ec226, 0x06d3022a, 0x07174226, 0x075b822a, 0x079fc226,
+    0x07e4022a, 0x08284226, 0x086f222a, 0x08b36226, 0x08f7a22a, 0x093be226,
+    0x0980222a, 0x09c46226, 0x0a08a22a, 0x0a4ce226, 0x0a91222a, 0x0ad56226,
+    0x0b1c422a, 0x0b608226, 0x0ba4c22a, 0x0be90226, 0x0c2d422a, 0x0c718226,
+    0x0cb5c22a, 0x0cfa0226, 0x0d3e422a, 0x0d828226, 0x0dc6c22a, 0x0e0b0226,
+    0x0e51e22a, 0x0e962226, 0x0eda622a, 0x0f1ea226, 0x0f62e22a, 0x0fa72226,
+    0x0feb622a, 0x102fa226, 0x1073e22a, 0x10b82226, 0x10fc622a, 0x11434226,
+    0x1187822a, 0x11cbc226, 0x1210022a, 0x12544226, 0x1298822a, 0x12dcc226,
+    0x1321022a, 0x13654226, 0x13a9822a, 0x13edc226, 0x1434a22a, 0x1478e226,
+    0x14bd222a, 0x15016226, 0x1545a22a, 0x1589e226, 0x15ce222a, 0x16126226,
+    0x1656a22a, 0x169ae226, 0x16df222a, 0x17236226, 0x176a422a, 0x17ae8226,
+    0x17f2c22a, 0x18370226, 0x187b422a, 0x18bf8226, 0x1903c22a, 0x19480226,
+    0x198c422a, 0x19d08226, 0x1a17622a, 0x1a5ba226, 0x1a9fe22a, 0x1ae42226,
+    0x1b28622a, 0x1b6ca226, 0x1bb0e22a, 0x1bf52226, 0x1c39622a, 0x1c7da226,
+    0x1cc1e22a, 0x1d062226, 0x1d4d022a, 0x1d914226, 0x1dd5822a, 0x1e19c226,
+    0x1e5e022a, 0x1ea24226, 0x1ee6822a, 0x1f2ac226, 0x1f6f022a, 0x1fb34226,
+    0x1ff7822a, 0x203e6226, 0x2082a22a, 0x20c6e226, 0x210b222a, 0x214f6226,
+    0x2193a22a, 0x21d7e226, 0x221c222a,
+};
+
+static const uint32_t _australia_sydney[] = {
+    0x0000002c, 0x00238028, 0x0067c02c, 0x00ac0028, 0x00f0402c, 0x01348028,
+    0x0178c02c, 0x01bd0028, 0x0201402c, 0x02482028, 0x028c602c, 0x02d0a028,
+    0x0314e02c, 0x03592028, 0x039d602c, 0x03e1a028, 0x0425e02c, 0x046a2028,
+    0x04ae602c, 0x04f2a028, 0x0539802c, 0x057dc028, 0x05c2002c, 0x06064028,
+    0x064a802c, 0x068ec028, 0x06d3002c, 0x07174028, 0x075b802c, 0x079fc028,
+    0x07e4002c, 0x08284028, 0x086f202c, 0x08b36028, 0x08f7a02c, 0x093be028,
+    0x0980202c, 0x09c46028, 0x0a08a02c, 0x0a4ce028, 0x0a91202c, 0x0ad56028,
+    0x0b1c402c, 0x0b608028, 0x0ba4c02c, 0x0be90028, 0x0c2d402c, 0x0c718028,
+    0x0cb5c02c, 0x0cfa0028, 0x0d3e402c, 0x0d828028, 0x0dc6c02c, 0x0e0b0028,
+    0x0e51e02c, 0x0e962028, 0x0eda602c, 0x0f1ea028, 0x0f62e02c, 0x0fa72028,
+    0x0feb602c, 0x102fa028, 0x1073e02c, 0x10b82028, 0x10fc602c, 0x11434028,
+    0x1187802c, 0x11cbc028, 0x1210002c, 0x12544028, 0x1298802c, 0x12dcc028,
+    0x1321002c, 0x13654028, 0x13a9802c, 0x13edc028, 0x1434a02c, 0x1478e028,
+    0x14bd202c, 0x15016028, 0x1545a02c, 0x1589e028, 0x15ce202c, 0x16126028,
+    0x1656a02c, 0x169ae028, 0x16df202c, 0x17236028, 0x176a402c, 0x17ae8028,
+    0x17f2c02c, 0x18370028, 0x187b402c, 0x18bf8028, 0x1903c02c, 0x19480028,
+    0x198c402c, 0x19d08028, 0x1a17602c, 0x1a5ba028, 0x1a9fe02c, 0x1ae42028,
+    0x1b28602c, 0x1b6ca028, 0x1bb0e02c, 0x1bf52028, 0x1c39602c, 0x1c7da028,
+    0x1cc1e02c, 0x1d062028, 0x1d4d002c, 0x1d914028, 0x1dd5802c, 0x1e19c028,
+    0x1e5e002c, 0x1ea24028, 0x1ee6802c, 0x1f2ac028, 0x1f6f002c, 0x1fb34028,
+    0x1ff7802c, 0x203e6028, 0x2082a02c, 0x20c6e028, 0x210b202c, 0x214f6028,
+    0x2193a02c, 0x21d7e028, 0x221c202c,
+};
+
+static const uint32_t _australia_lord_howe[] = {
+    0x0000002c, 0x00237c2a, 0x0067be2c, 0x00abfc2a, 0x00f03e2c, 0x01347c2a,
+    0x0178be2c, 0x01bcfc2a, 0x02013e2c, 0x02481c2a, 0x028c5e2c, 0x02d09c2a,
+    0x0314de2c, 0x03591c2a, 0x039d5e2c, 0x03e19c2a, 0x0425de2c, 0x046a1c2a,
+    0x04ae5e2c, 0x04f29c2a, 0x05397e2c, 0x057dbc2a, 0x05c1fe2c, 0x06063c2a,
+    0x064a7e2c, 0x068ebc2a, 0x06d2fe2c, 0x07173c2a, 0x075b7e2c, 0x079fbc2a,
+    0x07e3fe2c, 0x08283c2a, 0x086f1e2c, 0x08b35c2a, 0x08f79e2c, 0x093bdc2a,
+    0x09801e2c, 0x09c45c2a, 0x0a089e2c, 0x0a4cdc2a, 0x0a911e2c, 0x0ad55c2a,
+    0x0b1c3e2c, 0x0b607c2a, 0x0ba4be2c, 0x0be8fc2a, 0x0c2d3e2c, 0x0c717c2a,
+    0x0cb5be2c, 0x0cf9fc2a, 0x0d3e3e2c, 0x0d827c2a, 0x0dc6be2c, 0x0e0afc2a,
+    0x0e51de2c, 0x0e961c2a, 0x0eda5e2c, 0x0f1e9c2a, 0x0f62de2c, 0x0fa71c2a,
+    0x0feb5e2c, 0x102f9c2a, 0x1073de2c, 0x10b81c2a, 0x10fc5e2c, 0x11433c2a,
+    0x11877e2c, 0x11cbbc2a, 0x120ffe2c, 0x12543c2a, 0x12987e2c, 0x12dcbc2a,
+    0x1320fe2c, 0x13653c2a, 0x13a97e2c, 0x13edbc2a, 0x14349e2c, 0x1478dc2a,
+    0x14bd1e2c, 0x15015c2a, 0x15459e2c, 0x1589dc2a, 0x15ce1e2c, 0x16125c2a,
+    0x16569e2c, 0x169adc2a, 0x16df1e2c, 0x17235c2a, 0x176a3e2c, 0x17ae7c2a,
+    0x17f2be2c, 0x1836fc2a, 0x187b3e2c, 0x18bf7c2a, 0x1903be2c, 0x1947fc2a,
+    0x198c3e2c, 0x19d07c2a, 0x1a175e2c, 0x1a5b9c2a, 0x1a9fde2c, 0x1ae41c2a,
+    0x1b285e2c, 0x1b6c9c2a, 0x1bb0de2c, 0x1bf51c2a, 0x1c395e2c, 0x1c7d9c2a,
+    0x1cc1de2c, 0x1d061c2a, 0x1d4cfe2c, 0x1d913c2a, 0x1dd57e2c, 0x1e19bc2a,
+    0x1e5dfe2c, 0x1ea23c2a, 0x1ee67e2c, 0x1f2abc2a, 0x1f6efe2c, 0x1fb33c2a,
+    0x1ff77e2c, 0x203e5c2a, 0x20829e2c, 0x20c6dc2a, 0x210b1e2c, 0x214f5c2a,
+    0x21939e2c, 0x21d7dc2a, 0x221c1e2c,
+};
+
+static const uint32_t _pacific_auckland[] = {
+    0x00000034, 0x00237830, 0x00651834, 0x00abf830, 0x00ed9834, 0x01347830,
+    0x01761834, 0x01bcf830, 0x01fe9834, 0x02481830, 0x0289b834, 0x02d09830,
+    0x03123834, 0x03591830, 0x039ab834, 0x03e19830, 0x04233834, 0x046a1830,
+    0x04abb834, 0x04f29830, 0x0536d834, 0x057db830, 0x05bf5834, 0x06063830,
+    0x0647d834, 0x068eb830, 0x06d05834, 0x07173830, 0x0758d834, 0x079fb830,
+    0x07e15834, 0x08283830, 0x086c7834, 0x08b35830, 0x08f4f834, 0x093bd830,
+    0x097d7834, 0x09c45830, 0x0a05f834, 0x0a4cd830, 0x0a8e7834, 0x0ad55830,
+    0x0b199834, 0x0b607830, 0x0ba21834, 0x0be8f830, 0x0c2a9834, 0x0c717830,
+    0x0cb31834, 0x0cf9f830, 0x0d3b9834, 0x0d827830, 0x0dc41834, 0x0e0af830,
+    0x0e4f3834, 0x0e961830, 0x0ed7b834, 0x0f1e9830, 0x0f603834, 0x0fa71830,
+    0x0fe8b834, 0x102f9830, 0x10713834, 0x10b81830, 0x10f9b834, 0x11433830,
+    0x1184d834, 0x11cbb830, 0x120d5834, 0x12543830, 0x1295d834, 0x12dcb830,
+    0x131e5834, 0x13653830, 0x13a6d834, 0x13edb830, 0x1431f834, 0x1478d830,
+    0x14ba7834, 0x15015830, 0x1542f834, 0x1589d830, 0x15cb7834, 0x16125830,
+    0x1653f834, 0x169ad830, 0x16dc7834, 0x17235830, 0x17679834, 0x17ae7830,
+    0x17f01834, 0x1836f830, 0x18789834, 0x18bf7830, 0x19011834, 0x1947f830,
+    0x19899834, 0x19d07830, 0x1a14b834, 0x1a5b9830, 0x1a9d3834, 0x1ae41830,
+    0x1b25b834, 0x1b6c9830, 0x1bae3834, 0x1bf51830, 0x1c36b834, 0x1c7d9830,
+    0x1cbf3834, 0x1d061830, 0x1d4a5834, 0x1d913830, 0x1dd2d834, 0x1e19b830,
+    0x1e5b5834, 0x1ea23830, 0x1ee3d834, 0x1f2ab830, 0x1f6c5834, 0x1fb33830,
+    0x1ff4d834, 0x203e5830, 0x207ff834, 0x20c6d830, 0x21087834, 0x214f5830,
+    0x2190f834, 0x21d7d830, 0x22197834,
+};
+
+static const uint32_t _pacific_chatham[] = {
+    0x00000037, 0x00237833, 0x00651837, 0x00abf833, 0x00ed9837, 0x01347833,
+    0x01761837, 0x01bcf833, 0x01fe9837, 0x02481833, 0x0289b837, 0x02d09833,
+    0x03123837, 0x03591833, 0x039ab837, 0x03e19833, 0x04233837, 0x046a1833,
+    0x04abb837, 0x04f29833, 0x0536d837, 0x057db833, 0x05bf5837, 0x06063833,
+    0x0647d837, 0x068eb833, 0x06d05837, 0x07173833, 0x0758d837, 0x079fb833,
+    0x07e15837, 0x08283833, 0x086c7837, 0x08b35833, 0x08f4f837, 0x093bd833,
+    0x097d7837, 0x09c45833, 0x0a05f837, 0x0a4cd833, 0x0a8e7837, 0x0ad55833,
+    0x0b199837, 0x0b607833, 0x0ba21837, 0x0be8f833, 0x0c2a9837, 0x0c717833,
+    0x0cb31837, 0x0cf9f833, 0x0d3b9837, 0x0d827833, 0x0dc41837, 0x0e0af833,
+    0x0e4f3837, 0x0e961833, 0x0ed7b837, 0x0f1e9833, 0x0f603837, 0x0fa71833,
+    0x0fe8b837, 0x102f9833, 0x10713837, 0x10b81833, 0x10f9b837, 0x11433833,
+    0x1184d837, 0x11cbb833, 0x120d5837, 0x12543833, 0x1295d837, 0x12dcb833,
+    0x131e5837, 0x13653833, 0x13a6d837, 0x13edb833, 0x1431f837, 0x1478d833,
+    0x14ba7837, 0x15015833, 0x1542f837, 0x1589d833, 0x15cb7837, 0x16125833,
+    0x1653f837, 0x169ad833, 0x16dc7837, 0x17235833, 0x17679837, 0x17ae7833,
+    0x17f01837, 0x1836f833, 0x18789837, 0x18bf7833, 0x19011837, 0x1947f833,
+    0x19899837, 0x19d07833, 0x1a14b837, 0x1a5b9833, 0x1a9d3837, 0x1ae41833,
+    0x1b25b837, 0x1b6c9833, 0x1bae3837, 0x1bf51833, 0x1c36b837, 0x1c7d9833,
+    0x1cbf3837, 0x1d061833, 0x1d4a5837, 0x1d913833, 0x1dd2d837, 0x1e19b833,
+    0x1e5b5837, 0x1ea23833, 0x1ee3d837, 0x1f2ab833, 0x1f6c5837, 0x1fb33833,
+    0x1ff4d837, 0x203e5833, 0x207ff837, 0x20c6d833, 0x21087837, 0x214f5833,
+    0x2190f837, 0x21d7d833, 0x22197837,
+};
+
+static const uint32_t _america_anchorage[] = {
+    0x000000dc, 0x00194ce0, 0x007288dc, 0x00a46ce0, 0x00fda8dc, 0x012cece0,
+    0x018628dc, 0x01b56ce0, 0x020ea8dc, 0x023dece0, 0x029728dc, 0x02c66ce0,
+    0x031fa8dc, 0x034eece0, 0x03a828dc, 0x03da0ce0, 0x043348dc, 0x04628ce0,
+    0x04bbc8dc, 0x04eb0ce0, 0x054448dc, 0x05738ce0, 0x05ccc8dc, 0x05fc0ce0,
+    0x065548dc, 0x06872ce0, 0x06e068dc, 0x070face0, 0x0768e8dc, 0x07982ce0,
+    0x07f168dc, 0x0820ace0, 0x0879e8dc, 0x08a92ce0, 0x090268dc, 0x0931ace0,
+    0x098ae8dc, 0x09bccce0, 0x0a1608dc, 0x0a454ce0, 0x0a9e88dc, 0x0acdcce0,
+    0x0b2708dc, 0x0b564ce0, 0x0baf88dc, 0x0bdecce0, 0x0c3808dc, 0x0c674ce0,
+    0x0cc088dc, 0x0cf26ce0, 0x0d4ba8dc, 0x0d7aece0, 0x0dd428dc, 0x0e036ce0,
+    0x0e5ca8dc, 0x0e8bece0, 0x0ee528dc, 0x0f146ce0, 0x0f6da8dc, 0x0f9f8ce0,
+    0x0ff8c8dc, 0x10280ce0, 0x108148dc, 0x10b08ce0, 0x1109c8dc, 0x11390ce0,
+    0x119248dc, 0x11c18ce0, 0x121ac8dc, 0x124a0ce0, 0x12a348dc, 0x12d52ce0,
+    0x132e68dc, 0x135dace0, 0x13b6e8dc, 0x13e62ce0, 0x143f68dc, 0x146eace0,
+    0x14c7e8dc, 0x14f72ce0, 0x155068dc, 0x15824ce0, 0x15db88dc, 0x160acce0,
+    0x166408dc, 0x16934ce0, 0x16ec88dc, 0x171bcce0, 0x177508dc, 0x17a44ce0,
+    0x17fd88dc, 0x182ccce0, 0x188608dc, 0x18b7ece0, 0x191128dc, 0x19406ce0,
+    0x1999a8dc, 0x19c8ece0, 0x1a2228dc, 0x1a516ce0, 0x1aaaa8dc, 0x1ad9ece0,
+    0x1b3328dc, 0x1b626ce0, 0x1bbba8dc, 0x1bed8ce0, 0x1c46c8dc, 0x1c760ce0,
+    0x1ccf48dc, 0x1cfe8ce0, 0x1d57c8dc, 0x1d870ce0, 0x1de048dc, 0x1e0f8ce0,
+    0x1e68c8dc, 0x1e9aace0, 0x1ef3e8dc, 0x1f232ce0, 0x1f7c68dc, 0x1fabace0,
+    0x2004e8dc, 0x20342ce0, 0x208d68dc, 0x20bcace0, 0x2115e8dc, 0x21452ce0,
+    0x219e68dc, 0x21d04ce0, 0x222988dc,
+};
+
+static const uint32_t _america_los_angeles[] = {
+    0x000000e0, 0x001948e4, 0x007284e0, 0x00a468e4, 0x00fda4e0, 0x012ce8e4,
+    0x018624e0, 0x01b568e4, 0x020ea4e0, 0x023de8e4, 0x029724e0, 0x02c668e4,
+    0x031fa4e0, 0x034ee8e4, 0x03a824e0, 0x03da08e4, 0x043344e0, 0x046288e4,
+    0x04bbc4e0, 0x04eb08e4, 0x054444e0, 0x057388e4, 0x05ccc4e0, 0x05fc08e4,
+    0x065544e0, 0x068728e4, 0x06e064e0, 0x070fa8e4, 0x0768e4e0, 0x079828e4,
+    0x07f164e0, 0x0820a8e4, 0x0879e4e0, 0x08a928e4, 0x090264e0, 0x0931a8e4,
+    0x098ae4e0, 0x09bcc8e4, 0x0a1604e0, 0x0a4548e4, 0x0a9e84e0, 0x0acdc8e4,
+    0x0b2704e0, 0x0b5648e4, 0x0baf84e0, 0x0bdec8e4, 0x0c3804e0, 0x0c6748e4,
+    0x0cc084e0, 0x0cf268e4, 0x0d4ba4e0, 0x0d7ae8e4, 0x0dd424e0, 0x0e0368e4,
+    0x0e5ca4e0, 0x0e8be8e4, 0x0ee524e0, 0x0f1468e4, 0x0f6da4e0, 0x0f9f88e4,
+    0x0ff8c4e0, 0x102808e4, 0x108144e0, 0x10b088e4, 0x1109c4e0, 0x113908e4,
+    0x119244e0, 0x11c188e4, 0x121ac4e0, 0x124a08e4, 0x12a344e0, 0x12d528e4,
+    0x132e64e0, 0x135da8e4, 0x13b6e4e0, 0x13e628e4, 0x143f64e0, 0x146ea8e4,
+    0x14c7e4e0, 0x14f728e4, 0x155064e0, 0x158248e4, 0x15db84e0, 0x160ac8e4,
+    0x166404e0, 0x169348e4, 0x16ec84e0, 0x171bc8e4, 0x177504e0, 0x17a448e4,
+    0x17fd84e0, 0x182cc8e4, 0x188604e0, 0x18b7e8e4, 0x191124e0, 0x194068e4,
+    0x1999a4e0, 0x19c8e8e4, 0x1a2224e0, 0x1a5168e4, 0x1aaaa4e0, 0x1ad9e8e4,
+    0x1b3324e0, 0x1b6268e4, 0x1bbba4e0, 0x1bed88e4, 0x1c46c4e0, 0x1c7608e4,
+    0x1ccf44e0, 0x1cfe88e4, 0x1d57c4e0, 0x1d8708e4, 0x1de044e0, 0x1e0f88e4,
+    0x1e68c4e0, 0x1e9aa8e4, 0x1ef3e4e0, 0x1f2328e4, 0x1f7c64e0, 0x1faba8e4,
+    0x2004e4e0, 0x203428e4, 0x208d64e0, 0x20bca8e4, 0x2115e4e0, 0x214528e4,
+    0x219e64e0, 0x21d048e4, 0x222984e0,
+};
+
+static const uint32_t _america_denver[] = {
+    0x000000e4, 0x001944e8, 0x007280e4, 0x00a464e8, 0x00fda0e4, 0x012ce4e8,
+    0x018620e4, 0x01b564e8, 0x020ea0e4, 0x023de4e8, 0x029720e4, 0x02c664e8,
+    0x031fa0e4, 0x034ee4e8, 0x03a820e4, 0x03da04e8, 0x043340e4, 0x046284e8,
+    0x04bbc0e4, 0x04eb04e8, 0x054440e4, 0x057384e8, 0x05ccc0e4, 0x05fc04e8,
+    0x065540e4, 0x068724e8, 0x06e060e4, 0x070fa4e8, 0x0768e0e4, 0x079824e8,
+    0x07f160e4, 0x0820a4e8, 0x0879e0e4, 0x08a924e8, 0x090260e4, 0x0931a4e8,
+    0x098ae0e4, 0x09bcc4e8, 0x0a1600e4, 0x0a4544e8, 0x0a9e80e4, 0x0acdc4e8,
+    0x0b2700e4, 0x0b5644e8, 0x0baf80e4, 0x0bdec4e8, 0x0c3800e4, 0x0c6744e8,
+    0x0cc080e4, 0x0cf264e8, 0x0d4ba0e4, 0x0d7ae4e8, 0x0dd420e4, 0x0e0364e8,
+    0x0e5ca0e4, 0x0e8be4e8, 0x0ee520e4, 0x0f1464e8, 0x0f6da0e4, 0x0f9f84e8,
+    0x0ff8c0e4, 0x102804e8, 0x108140e4, 0x10b084e8, 0x1109c0e4, 0x113904e8,
+    0x119240e4, 0x11c184e8, 0x121ac0e4, 0x124a04e8, 0x12a340e4, 0x12d524e8,
+    0x132e60e4, 0x135da4e8, 0x13b6e0e4, 0x13e624e8, 0x143f60e4, 0x146ea4e8,
+    0x14c7e0e4, 0x14f724e8, 0x155060e4, 0x158244e8, 0x15db80e4, 0x160ac4e8,
+    0x166400e4, 0x169344e8, 0x16ec80e4, 0x171bc4e8, 0x177500e4, 0x17a444e8,
+    0x17fd80e4, 0x182cc4e8, 0x188600e4, 0x18b7e4e8, 0x191120e4, 0x194064e8,
+    0x1999a0e4, 0x19c8e4e8, 0x1a2220e4, 0x1a5164e8, 0x1aaaa0e4, 0x1ad9e4e8,
+    0x1b3320e4, 0x1b6264e8, 0x1bbba0e4, 0x1bed84e8, 0x1c46c0e4, 0x1c7604e8,
+    0x1ccf40e4, 0x1cfe84e8, 0x1d57c0e4, 0x1d8704e8, 0x1de040e4, 0x1e0f84e8,
+    0x1e68c0e4, 0x1e9aa4e8, 0x1ef3e0e4, 0x1f2324e8, 0x1f7c60e4, 0x1faba4e8,
+    0x2004e0e4, 0x203424e8, 0x208d60e4, 0x20bca4e8, 0x2115e0e4, 0x214524e8,
+    0x219e60e4, 0x21d044e8, 0x222980e4,
+};
+
+static const uint32_t _america_chicago[] = {
+    0x000000e8, 0x001940ec, 0x00727ce8, 0x00a460ec, 0x00fd9ce8, 0x012ce0ec,
+    0x01861ce8, 0x01b560ec, 0x020e9ce8, 0x023de0ec, 0x02971ce8, 0x02c660ec,
+    0x031f9ce8, 0x034ee0ec, 0x03a81ce8, 0x03da00ec, 0x04333ce8, 0x046280ec,
+    0x04bbbce8, 0x04eb00ec, 0x05443ce8, 0x057380ec, 0x05ccbce8, 0x05fc00ec,
+    0x06553ce8, 0x068720ec, 0x06e05ce8, 0x070fa0ec, 0x0768dce8, 0x079820ec,
+    0x07f15ce8, 0x0820a0ec, 0x0879dce8, 0x08a920ec, 0x09025ce8, 0x0931a0ec,
+    0x098adce8, 0x09bcc0ec, 0x0a15fce8, 0x0a4540ec, 0x0a9e7ce8, 0x0acdc0ec,
+    0x0b26fce8, 0x0b5640ec, 0x0baf7ce8, 0x0bdec0ec, 0x0c37fce8, 0x0c6740ec,
+    0x0cc07ce8, 0x0cf260ec, 0x0d4b9ce8, 0x0d7ae0ec, 0x0dd41ce8, 0x0e0360ec,
+    0x0e5c9ce8, 0x0e8be0ec, 0x0ee51ce8, 0x0f1460ec, 0x0f6d9ce8, 0x0f9f80ec,
+    0x0ff8bce8, 0x102800ec, 0x10813ce8, 0x10b080ec, 0x1109bce8, 0x113900ec,
+    0x11923ce8, 0x11c180ec, 0x121abce8, 0x124a00ec, 0x12a33ce8, 0x12d520ec,
+    0x132e5ce8, 0x135da0ec, 0x13b6dce8, 0x13e620ec, 0x143f5ce8, 0x146ea0ec,
+    0x14c7dce8, 0x14f720ec, 0x15505ce8, 0x158240ec, 0x15db7ce8, 0x160ac0ec,
+    0x1663fce8, 0x169340ec, 0x16ec7ce8, 0x171bc0ec, 0x1774fce8, 0x17a440ec,
+    0x17fd7ce8, 0x182cc0ec, 0x1885fce8, 0x18b7e0ec, 0x19111ce8, 0x194060ec,
+    0x19999ce8, 0x19c8e0ec, 0x1a221ce8, 0x1a5160ec, 0x1aaa9ce8, 0x1ad9e0ec,
+    0x1b331ce8, 0x1b6260ec, 0x1bbb9ce8, 0x1bed80ec, 0x1c46bce8, 0x1c7600ec,
+    0x1ccf3ce8, 0x1cfe80ec, 0x1d57bce8, 0x1d8700ec, 0x1de03ce8, 0x1e0f80ec,
+    0x1e68bce8, 0x1e9aa0ec, 0x1ef3dce8, 0x1f2320ec, 0x1f7c5ce8, 0x1faba0ec,
+    0x2004dce8, 0x203420ec, 0x208d5ce8, 0x20bca0ec, 0x2115dce8, 0x214520ec,
+    0x219e5ce8, 0x21d040ec, 0x22297ce8,
+};
+
+static const uint32_t _america_new_york[] = {
+    0x000000ec, 0x00193cf0, 0x007278ec, 0x00a45cf0, 0x00fd98ec, 0x012cdcf0,
+    0x018618ec, 0x01b55cf0, 0x020e98ec, 0x023ddcf0, 0x029718ec, 0x02c65cf0,
+    0x031f98ec, 0x034edcf0, 0x03a818ec, 0x03d9fcf0, 0x043338ec, 0x04627cf0,
+    0x04bbb8ec, 0x04eafcf0, 0x054438ec, 0x05737cf0, 0x05ccb8ec, 0x05fbfcf0,
+    0x065538ec, 0x06871cf0, 0x06e058ec, 0x070f9cf0, 0x0768d8ec, 0x07981cf0,
+    0x07f158ec, 0x08209cf0, 0x0879d8ec, 0x08a91cf0, 0x090258ec, 0x09319cf0,
+    0x098ad8ec, 0x09bcbcf0, 0x0a15f8ec, 0x0a453cf0, 0x0a9e78ec, 0x0acdbcf0,
+    0x0b26f8ec, 0x0b563cf0, 0x0baf78ec, 0x0bdebcf0, 0x0c37f8ec, 0x0c673cf0,
+    0x0cc078ec, 0x0cf25cf0, 0x0d4b98ec, 0x0d7adcf0, 0x0dd418ec, 0x0e035cf0,
+    0x0e5c98ec, 0x0e8bdcf0, 0x0ee518ec, 0x0f145cf0, 0x0f6d98ec, 0x0f9f7cf0,
+    0x0ff8b8ec, 0x1027fcf0, 0x108138ec, 0x10b07cf0, 0x1109b8ec, 0x1138fcf0,
+    0x119238ec, 0x11c17cf0, 0x121ab8ec, 0x1249fcf0, 0x12a338ec, 0x12d51cf0,
+    0x132e58ec, 0x135d9cf0, 0x13b6d8ec, 0x13e61cf0, 0x143f58ec, 0x146e9cf0,
+    0x14c7d8ec, 0x14f71cf0, 0x155058ec, 0x15823cf0, 0x15db78ec, 0x160abcf0,
+    0x1663f8ec, 0x16933cf0, 0x16ec78ec, 0x171bbcf0, 0x1774f8ec, 0x17a43cf0,
+    0x17fd78ec, 0x182cbcf0, 0x1885f8ec, 0x18b7dcf0, 0x191118ec, 0x19405cf0,
+    0x199998ec, 0x19c8dcf0, 0x1a2218ec, 0x1a515cf0, 0x1aaa98ec, 0x1ad9dcf0,
+    0x1b3318ec, 0x1b625cf0, 0x1bbb98ec, 0x1bed7cf0, 0x1c46b8ec, 0x1c75fcf0,
+    0x1ccf38ec, 0x1cfe7cf0, 0x1d57b8ec, 0x1d86fcf0, 0x1de038ec, 0x1e0f7cf0,
+    0x1e68b8ec, 0x1e9a9cf0, 0x1ef3d8ec, 0x1f231cf0, 0x1f7c58ec, 0x1fab9cf0,
+    0x2004d8ec, 0x20341cf0, 0x208d58ec, 0x20bc9cf0, 0x2115d8ec, 0x21451cf0,
+    0x219e58ec, 0x21d03cf0, 0x222978ec,
+};
+
+static const uint32_t _america_halifax[] = {
+    0x000000f0, 0x001938f4, 0x007274f0, 0x00a458f4, 0x00fd94f0, 0x012cd8f4,
+    0x018614f0, 0x01b558f4, 0x020e94f0, 0x023dd8f4, 0x029714f0, 0x02c658f4,
+    0x031f94f0, 0x034ed8f4, 0x03a814f0, 0x03d9f8f4, 0x043334f0, 0x046278f4,
+    0x04bbb4f0, 0x04eaf8f4, 0x054434f0, 0x057378f4, 0x05ccb4f0, 0x05fbf8f4,
+    0x065534f0, 0x068718f4, 0x06e054f0, 0x070f98f4, 0x0768d4f0, 0x079818f4,
+    0x07f154f0, 0x082098f4, 0x0879d4f0, 0x08a918f4, 0x090254f0, 0x093198f4,
+    0x098ad4f0, 0x09bcb8f4, 0x0a15f4f0, 0x0a4538f4, 0x0a9e74f0, 0x0acdb8f4,
+    0x0b26f4f0, 0x0b5638f4, 0x0baf74f0, 0x0bdeb8f4, 0x0c37f4f0, 0x0c6738f4,
+    0x0cc074f0, 0x0cf258f4, 0x0d4b94f0, 0x0d7ad8f4, 0x0dd414f0, 0x0e0358f4,
+    0x0e5c94f0, 0x0e8bd8f4, 0x0ee514f0, 0x0f1458f4, 0x0f6d94f0, 0x0f9f78f4,
+    0x0ff8b4f0, 0x1027f8f4, 0x108134f0, 0x10b078f4, 0x1109b4f0, 0x1138f8f4,
+    0x119234f0, 0x11c178f4, 0x121ab4f0, 0x1249f8f4, 0x12a334f0, 0x12d518f4,
+    0x132e54f0, 0x135d98f4, 0x13b6d4f0, 0x13e618f4, 0x143f54f0, 0x146e98f4,
+    0x14c7d4f0, 0x14f718f4, 0x155054f0, 0x158238f4, 0x15db74f0, 0x160ab8f4,
+    0x1663f4f0, 0x169338f4, 0x16ec74f0, 0x171bb8f4, 0x1774f4f0, 0x17a438f4,
+    0x17fd74f0, 0x182cb8f4, 0x1885f4f0, 0x18b7d8f4, 0x191114f0, 0x194058f4,
+    0x199994f0, 0x19c8d8f4, 0x1a2214f0, 0x1a5158f4, 0x1aaa94f0, 0x1ad9d8f4,
+    0x1b3314f0, 0x1b6258f4, 0x1bbb94f0, 0x1bed78f4, 0x1c46b4f0, 0x1c75f8f4,
+    0x1ccf34f0, 0x1cfe78f4, 0x1d57b4f0, 0x1d86f8f4, 0x1de034f0, 0x1e0f78f4,
+    0x1e68b4f0, 0x1e9a98f4, 0x1ef3d4f0, 0x1f2318f4, 0x1f7c54f0, 0x1fab98f4,
+    0x2004d4f0, 0x203418f4, 0x208d54f0, 0x20bc98f4, 0x2115d4f0, 0x214518f4,
+    0x219e54f0, 0x21d038f4, 0x222974f0,
+};
+
+static const uint32_t _america_st_johns[] = {
+    0x000000f2, 0x001936f6, 0x007272f2, 0x00a456f6, 0x00fd92f2, 0x012cd6f6,
+    0x018612f2, 0x01b556f6, 0x020e92f2, 0x023dd6f6, 0x029712f2, 0x02c656f6,
+    0x031f92f2, 0x034ed6f6, 0x03a812f2, 0x03d9f6f6, 0x043332f2, 0x046276f6,
+    0x04bbb2f2, 0x04eaf6f6, 0x054432f2, 0x057376f6, 0x05ccb2f2, 0x05fbf6f6,
+    0x065532f2, 0x068716f6, 0x06e052f2, 0x070f96f6, 0x0768d2f2, 0x079816f6,
+    0x07f152f2, 0x082096f6, 0x0879d2f2, 0x08a916f6, 0x090252f2, 0x093196f6,
+    0x098ad2f2, 0x09bcb6f6, 0x0a15f2f2, 0x0a4536f6, 0x0a9e72f2, 0x0acdb6f6,
+    0x0b26f2f2, 0x0b5636f6, 0x0baf72f2, 0x0bdeb6f6, 0x0c37f2f2, 0x0c6736f6,
+    0x0cc072f2, 0x0cf256f6, 0x0d4b92f2, 0x0d7ad6f6, 0x0dd412f2, 0x0e0356f6,
+    0x0e5c92f2, 0x0e8bd6f6, 0x0ee512f2, 0x0f1456f6, 0x0f6d92f2, 0x0f9f76f6,
+    0x0ff8b2f2, 0x1027f6f6, 0x108132f2, 0x10b076f6, 0x1109b2f2, 0x1138f6f6,
+    0x119232f2, 0x11c176f6, 0x121ab2f2, 0x1249f6f6, 0x12a332f2, 0x12d516f6,
+    0x132e52f2, 0x135d96f6, 0x13b6d2f2, 0x13e616f6, 0x143f52f2, 0x146e96f6,
+    0x14c7d2f2, 0x14f716f6, 0x155052f2, 0x158236f6, 0x15db72f2, 0x160ab6f6,
+    0x1663f2f2, 0x169336f6, 0x16ec72f2, 0x171bb6f6, 0x1774f2f2, 0x17a436f6,
+    0x17fd72f2, 0x182cb6f6, 0x1885f2f2, 0x18b7d6f6, 0x191112f2, 0x194056f6,
+    0x199992f2, 0x19c8d6f6, 0x1a2212f2, 0x1a5156f6, 0x1aaa92f2, 0x1ad9d6f6,
+    0x1b3312f2, 0x1b6256f6, 0x1bbb92f2, 0x1bed76f6, 0x1c46b2f2, 0x1c75f6f6,
+    0x1ccf32f2, 0x1cfe76f6, 0x1d57b2f2, 0x1d86f6f6, 0x1de032f2, 0x1e0f76f6,
+    0x1e68b2f2, 0x1e9a96f6, 0x1ef3d2f2, 0x1f2316f6, 0x1f7c52f2, 0x1fab96f6,
+    0x2004d2f2, 0x203416f6, 0x208d52f2, 0x20bc96f6, 0x2115d2f2, 0x214516f6,
+    0x219e52f2, 0x21d036f6, 0x222972f2,
+};
+
+static const uint32_t _atlantic_azores[] = {
+    0x000000fc, 0x00210400, 0x006fc4fc, 0x00a98400, 0x00fae4fc, 0x01320400,
+    0x018364fc, 0x01ba8400, 0x020be4fc, 0x0245a400, 0x029464fc, 0x02ce2400,
+    0x031ce4fc, 0x0356a400, 0x03a564fc, 0x03df2400, 0x043084fc, 0x0467a400,
+    0x04b904fc, 0x04f02400, 0x054184fc, 0x057b4400, 0x05ca04fc, 0x0603c400,
+    0x065284fc, 0x068c4400, 0x06dda4fc, 0x0714c400, 0x076624fc, 0x079d4400,
+    0x07eea4fc, 0x0825c400, 0x087724fc, 0x08b0e400, 0x08ffa4fc, 0x09396400,
+    0x098824fc, 0x09c1e400, 0x0a1344fc, 0x0a4a6400, 0x0a9bc4fc, 0x0ad2e400,
+    0x0b2444fc, 0x0b5e0400, 0x0bacc4fc, 0x0be68400, 0x0c3544fc, 0x0c6f0400,
+    0x0cbdc4fc, 0x0cf78400, 0x0d48e4fc, 0x0d800400, 0x0dd164fc, 0x0e088400,
+    0x0e59e4fc, 0x0e93a400, 0x0ee264fc, 0x0f1c2400, 0x0f6ae4fc, 0x0fa4a400,
+    0x0ff604fc, 0x102d2400, 0x107e84fc, 0x10b5a400, 0x110704fc, 0x1140c400,
+    0x118f84fc, 0x11c94400, 0x121804fc, 0x1251c400, 0x12a084fc, 0x12da4400,
+    0x132ba4fc, 0x1362c400, 0x13b424fc, 0x13eb4400, 0x143ca4fc, 0x14766400,
+    0x14c524fc, 0x14fee400, 0x154da4fc, 0x15876400, 0x15d8c4fc, 0x160fe400,
+    0x166144fc, 0x16986400, 0x16e9c4fc, 0x1720e400, 0x177244fc, 0x17ac0400,
+    0x17fac4fc, 0x18348400, 0x188344fc, 0x18bd0400, 0x190e64fc, 0x19458400,
+    0x1996e4fc, 0x19ce0400, 0x1a1f64fc, 0x1a592400, 0x1aa7e4fc, 0x1ae1a400,
+    0x1b3064fc, 0x1b6a2400, 0x1bb8e4fc, 0x1bf2a400, 0x1c4404fc, 0x1c7b2400,
+    0x1ccc84fc, 0x1d03a400, 0x1d5504fc, 0x1d8ec400, 0x1ddd84fc, 0x1e174400,
+    0x1e6604fc, 0x1e9fc400, 0x1ef124fc, 0x1f284400, 0x1f79a4fc, 0x1fb0c400,
+    0x200224fc, 0x203be400, 0x208aa4fc, 0x20c46400, 0x211324fc, 0x214ce400,
+    0x219ba4fc, 0x21d56400, 0x2226c4fc,
+};
+
+const movement_tz_zone_t movement_tz_zones[MOVEMENT_TZ_NUM_ZONES] = {
+    [1] = { "Europe/Berlin", _europe_berlin, 129 },
+    [16] = { "Australia/Adelaide", _australia_adelaide, 129 },
+    [17] = { "Australia/Sydney", _australia_sydney, 129 },
+    [18] = { "Australia/Lord_Howe", _australia_lord_howe, 129 },
+    [20] = { "Pacific/Auckland", _pacific_auckland, 129 },
+    [21] = { "Pacific/Chatham", _pacific_chatham, 129 },
+    [29] = { "America/Anchorage", _america_anchorage, 129 },
+    [30] = { "America/Los_Angeles", _america_los_angeles, 129 },
+    [31] = { "America/Denver", _america_denver, 129 },
+    [32] = { "America/Chicago", _america_chicago, 129 },
+    [33] = { "America/New_York", _america_new_york, 129 },
+    [35] = { "America/Halifax", _america_halifax, 129 },
+    [36] = { "America/St_Johns", _america_st_johns, 129 },
+    [40] = { "Atlantic/Azores", _atlantic_azores, 129 },
+};
@@ -29,11 +29,13 @@
 #include <stdlib.h>
 
 #include "filesystem.h"
+#include "movement_timer.h"
 #include "watch.h"
 
 static int help_cmd(int argc, char *argv[]);
 static int flash_cmd(int argc, char *argv[]);
 static int stress_cmd(int argc, char *argv[]);
+static int cdcbench_cmd(int argc, char *argv[]);
 
 shell_command_t g_shell_commands[] = {
     {
@@ -87,9 +89,9 @@ shell_command_t g_shell_commands[] = {
     },
     {
         .name = "format",
-        .help = "usage: format YES",
+        .help = "usage: format [/ext] YES",
         .min_args = 1,
-        .max_args = 1,
+        .max_args = 2,
         .cb = filesystem_cmd_format,
     },
     {
@@ -99,6 +101,27 @@ shell_command_t g_shell_commands[] = {
         .max_args = 3,
         .cb = filesystem_cmd_echo,
     },
+    {
+        .name = "get",
+        .help = "send a file to the host; use utils/watch_file_transfer",
+        .min_args = 1,
+        .max_args = 1,
+        .cb = filesystem_cmd_get,
+    },
+    {
+        .name = "put",
+        .help = "receive a file from the host; use utils/watch_file_transfer",
+        .min_args = 2,
+        .max_args = 2,
+        .cb = filesystem_cmd_put,
+    },
+    {
+        .name = "timers",
+        .help = "list active Movement timers",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = movement_timer_cmd_timers,
+    },
     {
         .name = "stress",
         .help = "test CDC write; usage: stress [LEN] [DELAY_MS]",
@@ -106,6 +129,13 @@ shell_command_t g_shell_commands[] = {
         .max_args = 2,
         .cb = stress_cmd,
     },
+    {
+        .name = "cdcbench",
+        .help = "measure CDC write throughput; usage: cdcbench [KB]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = cdcbench_cmd,
+    },
 };
 
 const size_t g_num_shell_commands = sizeof(g_shell_commands) / sizeof(shell_command_t);
@@ -163,3 +193,53 @@ static int stress_cmd(int argc, char *argv[]) {
 
     return 0;
 }
+
+#define CDCBENCH_DEFAULT_KB  (64)
+#define CDCBENCH_MAX_KB  (1024)
+static int cdcbench_cmd(int argc, char *argv[]) {
+    uint32_t total = CDCBENCH_DEFAULT_KB * 1024;
+
+    if (argc >= 2) {
+        int kb = atoi(argv[1]);
+        if (kb <= 0 || kb > CDCBENCH_MAX_KB) {
+            return -1;
+        }
+        total = kb * 1024;
+    }
+
+    // One packet-sized line of printable text.
+    char line[64];
+    for (size_t i = 0; i < sizeof(line) - 2; i++) {
+        line[i] = 'A' + (i % 26);
+    }
+    line[sizeof(line) - 2] = '\r';
+    line[sizeof(line) - 1] = '\n';
+
+    int8_t client = watch_timebase_register_client();
+    if (client == WATCH_TIMEBASE_INVALID_CLIENT) {
+        return -1;
+    }
+
+    fflush(stdout);
+    uint64_t start = watch_timebase_now();
+    uint32_t sent = 0;
+    while (sent < total) {
+        size_t len = (total - sent < sizeof(line)) ? total - sent : sizeof(line);
+        if (fwrite(line, 1, len, stdout) != len) {
+            break;
+        }
+        sent += len;
+    }
+    fflush(stdout);
+    uint32_t ms = (watch_timebase_now() - start) * 1000 / WATCH_TIMEBASE_FREQUENCY;
+
+    watch_timebase_unregister_client(client);
+
+    printf("\r\n%lu bytes in %lu ms", (unsigned long)sent, (unsigned long)ms);
+    if (ms > 0) {
+        printf(" (%lu bytes/s)", (unsigned long)((uint64_t)sent * 1000 / ms));
+    }
+    printf("\r\n");
+
+    return sent == total ? 0 : -1;
+}
@@ -0,0 +1,271 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* Checks the FAT view of a littlefs volume by reading it back the way a host would.
+ * littlefs runs on a RAM-backed copy of the watch's storage area, so this runs on any computer:
+ *
+ *     cc -I.. -I../../littlefs ../../littlefs/lfs.c ../../littlefs/lfs_util.c ../filesystem_fat.c \
+ *        test_filesystem_fat.c -o test_filesystem_fat && ./test_filesystem_fat
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "filesystem_fat.h"
+
+// most checks call the code under test, so unlike assert, this one can't be compiled out with NDEBUG.
+#define CHECK(x) do { \
+    if (!(x)) { \
+        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #x); \
+        exit(1); \
+    } \
+} while (0)
+
+#define NVMCTRL_ROW_SIZE 256
+#define NVMCTRL_PAGE_SIZE 64
+#define NVMCTRL_RWWEE_PAGES 128
+
+// the same RAM storage the simulator uses in place of the EEPROM emulation area.
+static uint8_t storage[NVMCTRL_ROW_SIZE * NVMCTRL_RWWEE_PAGES / 4];
+
+static bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t size) {
+    memcpy(buffer, storage + row * NVMCTRL_ROW_SIZE + offset, size);
+    return true;
+}
+
+static bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
+    memcpy(storage + row * NVMCTRL_ROW_SIZE + offset, buffer, size);
+    return true;
+}
+
+static bool watch_storage_erase(uint32_t row) {
+    memset(storage + row * NVMCTRL_ROW_SIZE, 0xff, NVMCTRL_ROW_SIZE);
+    return true;
+}
+
+static int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size) {
+    (void) cfg;
+    return watch_storage_read(block, off, buffer, size) ? 0 : LFS_ERR_IO;
+}
+
+static int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
+    (void) cfg;
+    filesystem_fat_invalidate();
+    return watch_storage_write(block, off, buffer, size) ? 0 : LFS_ERR_IO;
+}
+
+static int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block) {
+    (void) cfg;
+    filesystem_fat_invalidate();
+    return watch_storage_erase(block) ? 0 : LFS_ERR_IO;
+}
+
+static int lfs_storage_sync(const struct lfs_config *cfg) {
+    (void) cfg;
+    return 0;
+}
+
+// same geometry as movement/filesystem.c
+static const struct lfs_config cfg = {
+    .read  = lfs_storage_read,
+    .prog  = lfs_storage_prog,
+    .erase = lfs_storage_erase,
+    .sync  = lfs_storage_sync,
+    .read_size = 16,
+    .prog_size = NVMCTRL_PAGE_SIZE,
+    .block_size = NVMCTRL_ROW_SIZE,
+    .block_count = NVMCTRL_RWWEE_PAGES / 4,
+    .cache_size = NVMCTRL_PAGE_SIZE,
+    .lookahead_size = 16,
+    .block_cycles = 100,
+};
+
+static lfs_t lfs;
+
+static void write_file(const char *name, size_t size) {
+    lfs_file_t file;
+    CHECK(lfs_file_open(&lfs, &file, name, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) == 0);
+    for(size_t i = 0; i < size; i++) {
+        uint8_t c = (i * 7 + strlen(name)) & 0xFF;
+        CHECK(lfs_file_write(&lfs, &file, &c, 1) == 1);
+    }
+    CHECK(lfs_file_close(&lfs, &file) == 0);
+}
+
+static uint16_t get16(const uint8_t *p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p) {
+    return get16(p) | ((uint32_t)get16(p + 2) << 16);
+}
+
+static uint16_t fat_entry(const uint8_t *fat, uint16_t cluster) {
+    uint16_t value = get16(fat + cluster * 3 / 2);
+    return (cluster & 1) ? value >> 4 : value & 0xFFF;
+}
+
+// reads the volume like a FAT driver would, and checks every file against littlefs. returns the number of files.
+static int check_volume(void) {
+    uint8_t sector[FILESYSTEM_FAT_SECTOR_SIZE];
+    uint8_t fat[FILESYSTEM_FAT_SECTOR_SIZE];
+    uint8_t fat2[FILESYSTEM_FAT_SECTOR_SIZE];
+
+    CHECK(filesystem_fat_read_sector(0, sector));
+    CHECK(sector[510] == 0x55 && sector[511] == 0xAA);
+    uint16_t bytes_per_sector = get16(sector + 11);
+    uint16_t reserved = get16(sector + 14);
+    uint8_t num_fats = sector[16];
+    uint16_t root_entries = get16(sector + 17);
+    uint16_t total_sectors = get16(sector + 19);
+    uint16_t fat_sectors = get16(sector + 22);
+    uint16_t root_start = reserved + num_fats * fat_sectors;
+    uint16_t data_start = root_start + root_entries * 32 / bytes_per_sector;
+    CHECK(bytes_per_sector == FILESYSTEM_FAT_SECTOR_SIZE);
+    CHECK(sector[13] == 1);
+    CHECK(root_start == FILESYSTEM_FAT_ROOT_START);
+    CHECK(total_sectors == FILESYSTEM_FAT_NUM_SECTORS);
+    // fewer than 4085 clusters is what makes it FAT12.
+    CHECK(total_sectors - data_start < 4085);
+
+    CHECK(filesystem_fat_read_sector(reserved, fat));
+    CHECK(filesystem_fat_read_sector(reserved + 1, fat2));
+    CHECK(memcmp(fat, fat2, sizeof(fat)) == 0);
+    CHECK(fat_entry(fat, 0) == 0xFF8);
+
+    char long_name[256] = {0};
+    uint8_t checksum = 0;
+    int num_files = 0;
+    bool seen_label = false;
+
+    for(uint16_t i = 0; i < root_entries; i++) {
+        if (i % 16 == 0) CHECK(filesystem_fat_read_sector(root_start + i / 16, sector));
+        uint8_t *entry = sector + (i % 16) * 32;
+        if (entry[0] == 0) break;
+
+        if (entry[11] == 0x0F) {
+            static const uint8_t offsets[13] = { 1, 3, 5, 7, 9, 14, 16, 18, 20, 22, 24, 28, 30 };
+            uint8_t ordinal = entry[0] & 0x3F;
+            if (entry[0] & 0x40) memset(long_name, 0, sizeof(long_name));
+            for(uint8_t j = 0; j < 13; j++) {
+                uint16_t c = get16(entry + offsets[j]);
+                if (c != 0 && c != 0xFFFF) long_name[(ordinal - 1) * 13 + j] = c;
+            }
+            checksum = entry[13];
+            continue;
+        }
+        if (entry[11] & 0x08) {
+            CHECK(!seen_label && memcmp(entry, "SENSORWATCH", 11) == 0);
+            seen_label = true;
+            continue;
+        }
+
+        // work out the name the host would show.
+        char name[256];
+        uint8_t sum = 0;
+        for(uint8_t j = 0; j < 11; j++) sum = ((sum & 1) << 7) + (sum >> 1) + entry[j];
+        if (long_name[0]) {
+            CHECK(sum == checksum);
+            strcpy(name, long_name);
+            memset(long_name, 0, sizeof(long_name));
+        } else {
+            char *p = name;
+            for(uint8_t j = 0; j < 8 && entry[j] != ' '; j++) *p++ = (entry[12] & 0x08) ? entry[j] | 0x20 : entry[j];
+            if (entry[8] != ' ') *p++ = '.';
+            for(uint8_t j = 8; j < 11 && entry[j] != ' '; j++) *p++ = (entry[12] & 0x10) ? entry[j] | 0x20 : entry[j];
+            *p = '\0';
+        }
+
+        // follow the cluster chain and compare against the file in littlefs.
+        struct lfs_info info;
+        CHECK(lfs_stat(&lfs, name, &info) == 0);
+        CHECK(info.type == LFS_TYPE_REG);
+        uint32_t size = get32(entry + 28);
+        CHECK(size == info.size);
+
+        lfs_file_t file;
+        CHECK(lfs_file_open(&lfs, &file, name, LFS_O_RDONLY) == 0);
+        uint16_t cluster = get16(entry + 26);
+        uint32_t remaining = size;
+        while (remaining > 0) {
+            uint8_t data[FILESYSTEM_FAT_SECTOR_SIZE];
+            uint8_t expected[FILESYSTEM_FAT_SECTOR_SIZE];
+            uint32_t len = remaining < sizeof(expected) ? remaining : sizeof(expected);
+            CHECK(cluster >= 2 && cluster < 0xFF8);
+            CHECK(filesystem_fat_read_sector(data_start + cluster - 2, data));
+            CHECK(lfs_file_read(&lfs, &file, expected, len) == (lfs_ssize_t)len);
+            CHECK(memcmp(data, expected, len) == 0);
+            remaining -= len;
+            cluster = fat_entry(fat, cluster);
+        }
+        CHECK(size == 0 ? get16(entry + 26) == 0 : cluster >= 0xFF8);
+        lfs_file_close(&lfs, &file);
+
+        printf("%-11.11s %5lu %s\n", entry, (unsigned long)size, name);
+        num_files++;
+    }
+
+    return num_files;
+}
+
+int main(void) {
+    CHECK(lfs_format(&lfs, &cfg) == 0);
+    CHECK(lfs_mount(&lfs, &cfg) == 0);
+    filesystem_fat_init(&lfs);
+
+    // an empty volume is still a valid disk.
+    CHECK(filesystem_fat_is_stale());
+    CHECK(filesystem_fat_refresh());
+    CHECK(!filesystem_fat_is_stale());
+    CHECK(check_volume() == 0);
+
+    write_file("README", 10);                   // a plain 8.3 name
+    write_file("hello.txt", 700);               // lowercase, shown with the case flags
+    write_file("MiXed.Txt", 1);                 // mixed case needs a long name
+    write_file("a file with a long name.json", 1500);
+    write_file("empty", 0);
+    write_file("LONGNA~1.TXT", 3);              // looks like a generated short name
+    CHECK(lfs_mkdir(&lfs, "subdir") == 0);     // not shown
+
+    CHECK(filesystem_fat_is_stale());
+    CHECK(filesystem_fat_refresh());
+    CHECK(check_volume() == 6);
+
+    // changing the volume makes the view stale, and refreshing picks up the change.
+    CHECK(!filesystem_fat_is_stale());
+    CHECK(lfs_remove(&lfs, "hello.txt") == 0);
+    write_file("new.bin", 2000);
+    CHECK(filesystem_fat_is_stale());
+    CHECK(filesystem_fat_refresh());
+    CHECK(check_volume() == 6);
+
+    // sectors past the end of the disk don't exist.
+    uint8_t sector[FILESYSTEM_FAT_SECTOR_SIZE];
+    CHECK(!filesystem_fat_read_sector(FILESYSTEM_FAT_NUM_SECTORS, sector));
+
+    lfs_unmount(&lfs);
+    printf("OK\n");
+
+    return 0;
+}
@@ -0,0 +1,329 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Checks the division-free calendar conversions in watch_utility.c against the musl-derived code they replaced,
+// which is kept below as a reference. It builds watch_utility.c on its own, so this runs on any computer:
+//
+//     cc -I../../watch-library/shared/watch test_watch_utility.c -lm -o test_watch_utility && ./test_watch_utility
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// just enough of watch.h for watch_utility.c.
+#define WATCH_H_
+#define WATCH_RTC_REFERENCE_YEAR (2020)
+typedef union {
+    struct {
+        uint32_t second : 6;
+        uint32_t minute : 6;
+        uint32_t hour : 5;
+        uint32_t day : 5;
+        uint32_t month : 4;
+        uint32_t year : 6;
+    } unit;
+    uint32_t reg;
+} watch_date_time;
+
+#include "watch_utility.c"
+
+#define TIMESTAMP_2019 1546300800u
+#define TIMESTAMP_2085 3944678400u
+// the reference counts seconds from 2000-03-01 in an int32_t, which overflows on 2068-03-19, after which it
+// returns all zeroes. past that point, the conversions are checked against each other instead.
+#define TIMESTAMP_REFERENCE_LIMIT (951868800u + INT32_MAX)
+#define ITERATIONS 1000000
+
+// Function taken from `src/time/__year_to_secs.c` of musl libc
+// https://musl.libc.org
+static uint32_t __year_to_secs(uint32_t year, int *is_leap)
+{
+	if (year-2ULL <= 136) {
+		int y = year;
+		int leaps = (y-68)>>2;
+		if (!((y-68)&3)) {
+			leaps--;
+			if (is_leap) *is_leap = 1;
+		} else if (is_leap) *is_leap = 0;
+		return 31536000*(y-70) + 86400*leaps;
+	}
+
+	int cycles, centuries, leaps, rem;
+
+	if (!is_leap) is_leap = &(int){0};
+	cycles = (year-100) / 400;
+	rem = (year-100) % 400;
+	if (rem < 0) {
+		cycles--;
+		rem += 400;
+	}
+	if (!rem) {
+		*is_leap = 1;
+		centuries = 0;
+		leaps = 0;
+	} else {
+		if (rem >= 200) {
+			if (rem >= 300) centuries = 3, rem -= 300;
+			else centuries = 2, rem -= 200;
+		} else {
+			if (rem >= 100) centuries = 1, rem -= 100;
+			else centuries = 0;
+		}
+		if (!rem) {
+			*is_leap = 0;
+			leaps = 0;
+		} else {
+			leaps = rem / 4U;
+			rem %= 4U;
+			*is_leap = !rem;
+		}
+	}
+
+	leaps += 97*cycles + 24*centuries - *is_leap;
+
+	return (year-100) * 31536000LL + leaps * 86400LL + 946684800 + 86400;
+}
+
+// Function taken from `src/time/__month_to_secs.c` of musl libc
+// https://musl.libc.org
+static int __month_to_secs(int month, int is_leap)
+{
+	static const int secs_through_month[] = {
+		0, 31*86400, 59*86400, 90*86400,
+		120*86400, 151*86400, 181*86400, 212*86400,
+		243*86400, 273*86400, 304*86400, 334*86400 };
+	int t = secs_through_month[month];
+	if (is_leap && month >= 2) t+=86400;
+	return t;
+}
+
+// Function adapted from `src/time/__tm_to_secs.c` of musl libc
+// https://musl.libc.org
+static uint32_t reference_convert_to_unix_time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, uint32_t utc_offset) {
+    int is_leap;
+
+    // POSIX tm struct starts year at 1900 and month at 0
+    // https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/time.h.html 
+    uint32_t timestamp = __year_to_secs(year - 1900, &is_leap);
+    timestamp += __month_to_secs(month - 1, is_leap);
+
+    // Regular conversion from musl libc
+    timestamp += (day - 1) * 86400;
+    timestamp += hour * 3600;
+    timestamp += minute * 60;
+    timestamp += second;
+    timestamp -= utc_offset;
+
+    return timestamp;
+}
+
+static uint32_t reference_date_time_to_unix_time(watch_date_time date_time, uint32_t utc_offset) {
+    return reference_convert_to_unix_time(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second, utc_offset);
+}
+
+#define LEAPOCH (946684800LL + 86400*(31+29))
+
+
+static watch_date_time reference_date_time_from_unix_time(uint32_t timestamp, uint32_t utc_offset) {
+    watch_date_time retval;
+    retval.reg = 0;
+    int32_t days, secs;
+    int32_t remdays, remsecs, remyears;
+    int32_t qc_cycles, c_cycles, q_cycles;
+    int32_t years, months;
+    int32_t wday, yday, leap;
+    static const int8_t days_in_month[] = {31,30,31,30,31,31,30,31,30,31,31,29};
+    timestamp += utc_offset;
+
+    secs = timestamp - LEAPOCH;
+    days = secs / 86400;
+    remsecs = secs % 86400;
+    if (remsecs < 0) {
+        remsecs += 86400;
+        days--;
+    }
+
+    wday = (3+days)%7;
+    if (wday < 0) wday += 7;
+
+    qc_cycles = (int)(days / DAYS_PER_400Y);
+    remdays = days % DAYS_PER_400Y;
+    if (remdays < 0) {
+        remdays += DAYS_PER_400Y;
+        qc_cycles--;
+    }
+
+    c_cycles = remdays / DAYS_PER_100Y;
+    if (c_cycles == 4) c_cycles--;
+    remdays -= c_cycles * DAYS_PER_100Y;
+
+    q_cycles = remdays / DAYS_PER_4Y;
+    if (q_cycles == 25) q_cycles--;
+    remdays -= q_cycles * DAYS_PER_4Y;
+
+    remyears = remdays / 365;
+    if (remyears == 4) remyears--;
+    remdays -= remyears * 365;
+
+    leap = !remyears && (q_cycles || !c_cycles);
+    yday = remdays + 31 + 28 + leap;
+    if (yday >= 365+leap) yday -= 365+leap;
+
+    years = remyears + 4*q_cycles + 100*c_cycles + 400*qc_cycles;
+
+    for (months=0; days_in_month[months] <= remdays; months++)
+        remdays -= days_in_month[months];
+
+    years += 2000;
+
+    months += 2;
+    if (months >= 12) {
+        months -=12;
+        years++;
+    }
+
+    if (years < 2020 || years > 2083) return retval;
+    retval.unit.year = years - WATCH_RTC_REFERENCE_YEAR;
+    retval.unit.month = months + 1;
+    retval.unit.day = remdays + 1;
+
+    retval.unit.hour = remsecs / 3600;
+    retval.unit.minute = remsecs / 60 % 60;
+    retval.unit.second = remsecs % 60;
+
+    return retval;
+}
+
+
+static uint32_t random_u32(void) {
+    return ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+}
+
+static int32_t random_utc_offset(void) {
+    // UTC-12:00 to UTC+14:00, in quarter hours.
+    return ((int32_t)(random_u32() % 105) - 48) * 900;
+}
+
+static watch_date_time make_date_time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second) {
+    watch_date_time date_time;
+    date_time.unit.year = year - WATCH_RTC_REFERENCE_YEAR;
+    date_time.unit.month = month;
+    date_time.unit.day = day;
+    date_time.unit.hour = hour;
+    date_time.unit.minute = minute;
+    date_time.unit.second = second;
+    return date_time;
+}
+
+static void check_reciprocals(void) {
+    for (uint32_t x = 0; x < 4096; x++) assert(_div_100(x) == x / 100);
+    for (uint32_t x = 0; x < DAYS_PER_400Y; x++) assert(_div_36524(x) == x / 36524);
+    for (uint32_t x = 0; x < DAYS_PER_100Y + 1; x++) assert(_div_1461(x) == x / 1461);
+    for (uint32_t x = 0; x < DAYS_PER_4Y; x++) assert(_div_365(x) == x / 365);
+    for (uint32_t x = 0; x < 5 * 366 + 2; x++) assert(_div_153(x) == x / 153);
+    for (uint32_t x = 0; x < 86400; x++) assert(_div_3600(x) == x / 3600);
+    for (uint32_t x = 0; x < 3600; x++) assert(_div_60(x) == x / 60);
+    // the start and end of every day, and random seconds in between.
+    for (uint32_t day = 0; day <= UINT32_MAX / 86400; day++) {
+        uint32_t t = day * 86400;
+        assert(_div_86400(t) == day);
+        if (t + 86399 > t) assert(_div_86400(t + 86399) == day);
+        assert(_div_86400(t + random_u32() % 86400) == t / 86400 || t + 86399 < t);
+    }
+    assert(_div_86400(UINT32_MAX) == UINT32_MAX / 86400);
+}
+
+static void check_from_unix_time(void) {
+    // every second of a leap day, and midnight of every day in range.
+    for (uint32_t t = 1709164800; t < 1709251200; t++) {
+        assert(watch_utility_date_time_from_unix_time(t, 0).reg == reference_date_time_from_unix_time(t, 0).reg);
+    }
+    for (uint32_t t = TIMESTAMP_2019; t < TIMESTAMP_REFERENCE_LIMIT; t += 86400) {
+        assert(watch_utility_date_time_from_unix_time(t, 0).reg == reference_date_time_from_unix_time(t, 0).reg);
+        assert(watch_utility_date_time_from_unix_time(t - 1, 0).reg == reference_date_time_from_unix_time(t - 1, 0).reg);
+    }
+    for (int i = 0; i < ITERATIONS; i++) {
+        int32_t offset = random_utc_offset();
+        uint32_t t = TIMESTAMP_2019 + random_u32() % (TIMESTAMP_REFERENCE_LIMIT - TIMESTAMP_2019 - 14 * 3600);
+        assert(watch_utility_date_time_from_unix_time(t, offset).reg == reference_date_time_from_unix_time(t, offset).reg);
+    }
+    // the first and last seconds the watch can represent.
+    assert(watch_utility_date_time_from_unix_time(1577836800 - 1, 0).reg == 0);
+    assert(watch_utility_date_time_from_unix_time(1577836800, 0).reg == make_date_time(2020, 1, 1, 0, 0, 0).reg);
+    assert(watch_utility_date_time_from_unix_time(3597523200 - 1, 0).reg == make_date_time(2083, 12, 31, 23, 59, 59).reg);
+    assert(watch_utility_date_time_from_unix_time(3597523200, 0).reg == 0);
+}
+
+static void check_to_unix_time(void) {
+    for (int i = 0; i < ITERATIONS; i++) {
+        watch_date_time date_time;
+        date_time.unit.year = random_u32() % 64;
+        date_time.unit.month = 1 + random_u32() % 12;
+        date_time.unit.day = 1 + random_u32() % days_in_month(date_time.unit.month, date_time.unit.year + WATCH_RTC_REFERENCE_YEAR);
+        date_time.unit.hour = random_u32() % 24;
+        date_time.unit.minute = random_u32() % 60;
+        date_time.unit.second = random_u32() % 60;
+        int32_t offset = random_utc_offset();
+        uint32_t t = watch_utility_date_time_to_unix_time(date_time, offset);
+        assert(t == reference_date_time_to_unix_time(date_time, offset));
+        // and back again, which covers the dates past the reference's limit.
+        assert(watch_utility_date_time_from_unix_time(t, offset).reg == date_time.reg);
+    }
+    // outside the watch's range, but callers use it for other dates.
+    assert(watch_utility_convert_to_unix_time(1970, 1, 1, 0, 0, 0, 0) == 0);
+    assert(watch_utility_convert_to_unix_time(2000, 2, 29, 12, 0, 0, 0) == reference_convert_to_unix_time(2000, 2, 29, 12, 0, 0, 0));
+    assert(watch_utility_convert_to_unix_time(2106, 2, 7, 6, 28, 15, 0) == UINT32_MAX);
+}
+
+static void check_advance(void) {
+    for (int i = 0; i < ITERATIONS; i++) {
+        uint32_t t = TIMESTAMP_2019 + random_u32() % (TIMESTAMP_2085 - TIMESTAMP_2019);
+        // mostly small steps, which take the incremental path, and some long ones.
+        uint32_t step = (i % 8) ? random_u32() % 86400 : random_u32() % (86400 * 400);
+        watch_date_time date_time = watch_utility_date_time_from_unix_time(t, 0);
+        if (date_time.reg == 0) continue;
+        assert(watch_utility_date_time_advance(date_time, step).reg == watch_utility_date_time_from_unix_time(t + step, 0).reg);
+    }
+    // a clock ticking through a whole leap year, one second at a time, and off the end of 2083.
+    uint32_t t = 1704067200;
+    watch_date_time date_time = reference_date_time_from_unix_time(t, 0);
+    for (uint32_t n = 0; n < 366 * 86400; n++) {
+        date_time = watch_utility_date_time_advance(date_time, 1);
+        assert(date_time.reg == reference_date_time_from_unix_time(++t, 0).reg);
+    }
+    date_time = watch_utility_date_time_from_unix_time(3597523200 - 1, 0);
+    assert(watch_utility_date_time_advance(date_time, 1).reg == 0);
+}
+
+int main(void) {
+    srand(2024);
+    check_reciprocals();
+    check_from_unix_time();
+    check_to_unix_time();
+    check_advance();
+    printf("All calendar conversions match.\n");
+    return 0;
+}
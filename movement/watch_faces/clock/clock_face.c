@@ -35,6 +35,7 @@
 #include "watch.h"
 #include "watch_utility.h"
 #include "watch_private_display.h"
+#include "movement_sensors.h"
 
 // 2.2 volts will happen when the battery has maybe 5-10% remaining?
 // we can refine this later.
@@ -114,9 +115,7 @@ static void clock_check_battery_periodically(clock_state_t *clock, watch_date_ti
 
     clock->last_battery_check = date_time.unit.day;
 
-    watch_enable_adc();
-    uint16_t voltage = watch_get_vcc_voltage();
-    watch_disable_adc();
+    uint16_t voltage = movement_sensors_get_vcc_voltage(3600);
 
     clock->battery_low = voltage < CLOCK_FACE_LOW_BATTERY_VOLTAGE_THRESHOLD;
 
@@ -27,6 +27,7 @@
 #include "watch.h"
 #include "watch_utility.h"
 #include "watch_private_display.h"
+#include "movement_sensors.h"
 
 void play_hour_chime(void) {
         watch_buzzer_play_note(BUZZER_NOTE_C6, 75);
@@ -101,9 +102,7 @@ bool repetition_minute_face_loop(movement_event_t event, movement_settings_t *se
             // check the battery voltage once a day...
             if (date_time.unit.day != state->last_battery_check) {
                 state->last_battery_check = date_time.unit.day;
-                watch_enable_adc();
-                uint16_t voltage = watch_get_vcc_voltage();
-                watch_disable_adc();
+                uint16_t voltage = movement_sensors_get_vcc_voltage(3600);
                 // 2.2 volts will happen when the battery has maybe 5-10% remaining?
                 // we can refine this later.
                 state->battery_low = (voltage < 2200);
@@ -183,8 +183,8 @@ static bool mode_display(movement_event_t event, movement_settings_t *settings,
 
             /* Determine current time at time zone and store date/time */
 	    date_time = watch_rtc_get_date_time();
-	    timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60);
-	    date_time = watch_utility_date_time_from_unix_time(timestamp, movement_timezone_offsets[state->current_zone] * 60);
+	    timestamp = movement_tz_local_to_utc(settings->bit.time_zone, watch_utility_date_time_to_unix_time(date_time, 0), &state->home_tz_cache);
+	    date_time = watch_utility_date_time_from_unix_time(timestamp, movement_tz_get_utc_offset(state->current_zone, timestamp, &state->tz_cache));
 	    previous_date_time = state->previous_date_time;
 	    state->previous_date_time = date_time.reg;
 
@@ -73,6 +73,9 @@
  *  * The main display shows the time in the selected time zone in either
  *    12-hour or 24-hour form. There is no timeout, allowing users to keep
  *    the chosen time zone displayed for as long as they wish.
+ *  * Time zones listed in utils/dst_tables/zones.txt follow daylight saving
+ *    time, so the time shown is the local time there all year round; the
+ *    settings mode still lists them by their standard offset.
  *
  * The user can navigate through the selected time zones using the following
  * buttons:
@@ -89,6 +92,7 @@
 #define NUM_TIME_ZONES  41
 
 #include "movement.h"
+#include "movement_tz.h"
 
 typedef enum {
     WORLD_CLOCK2_MODE_DISPLAY,
@@ -104,6 +108,8 @@ typedef struct {
     world_clock2_mode_t current_mode;
     uint8_t current_zone;
     uint32_t previous_date_time;
+    movement_tz_cache_t home_tz_cache;
+    movement_tz_cache_t tz_cache;
 } world_clock2_state_t;
 
 void world_clock2_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr);
@@ -27,6 +27,7 @@
 #include "world_clock_face.h"
 #include "watch.h"
 #include "watch_utility.h"
+#include "movement_tz.h"
 
 void world_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
@@ -67,8 +68,8 @@ static bool world_clock_face_do_display_mode(movement_event_t event, movement_se
         case EVENT_TICK:
         case EVENT_LOW_ENERGY_UPDATE:
             date_time = watch_rtc_get_date_time();
-            timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60);
-            date_time = watch_utility_date_time_from_unix_time(timestamp, movement_timezone_offsets[state->settings.bit.timezone_index] * 60);
+            timestamp = movement_tz_local_to_utc(settings->bit.time_zone, watch_utility_date_time_to_unix_time(date_time, 0), &state->home_tz_cache);
+            date_time = watch_utility_date_time_from_unix_time(timestamp, movement_tz_get_utc_offset(state->settings.bit.timezone_index, timestamp, &state->tz_cache));
             previous_date_time = state->previous_date_time;
             state->previous_date_time = date_time.reg;
 
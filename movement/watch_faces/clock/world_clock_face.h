@@ -41,12 +41,14 @@
  * to the time zone setting, and press ALARM to cycle through the available time
  * zones. Press LIGHT one last time to return to the world clock display.
  *
- * Note that the second slot cannot display all letters or numbers. Also note
- * that at this time, time zones do not automatically update for daylight saving
- * time; you will need to manually adjust this field each spring and fall.
+ * Note that the second slot cannot display all letters or numbers. Time zones
+ * listed in utils/dst_tables/zones.txt (such as US Eastern or Central European
+ * Time) follow daylight saving time automatically; choose them by their
+ * standard time offset. Other zones keep a fixed offset all year.
  */
 
 #include "movement.h"
+#include "movement_tz.h"
 
 typedef union {
     struct {
@@ -62,6 +64,8 @@ typedef struct {
     uint8_t backup_register;
     uint8_t current_screen;
     uint32_t previous_date_time;
+    movement_tz_cache_t home_tz_cache;
+    movement_tz_cache_t tz_cache;
 } world_clock_state_t;
 
 void world_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -28,6 +28,7 @@
 #include <math.h>
 #include "astronomy_face.h"
 #include "watch_utility.h"
+#include "movement_time.h"
 
 #if __EMSCRIPTEN__
 #include <emscripten.h>
@@ -60,6 +61,7 @@ static const char astronomy_celestial_body_names[NUM_AVAILABLE_BODIES][3] = {
 };
 
 static void _astronomy_face_recalculate(movement_settings_t *settings, astronomy_state_t *state) {
+    (void) settings;
 #if __EMSCRIPTEN__
     int16_t browser_lat = EM_ASM_INT({
         return lat;
@@ -79,10 +81,7 @@ static void _astronomy_face_recalculate(movement_settings_t *settings, astronomy
     }
 #endif
 
-    watch_date_time date_time = watch_rtc_get_date_time();
-    uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60);
-    date_time = watch_utility_date_time_from_unix_time(timestamp, 0);
-    double jd = astro_convert_date_to_julian_date(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
+    double jd = movement_time_get_julian_date();
 
     astro_equatorial_coordinates_t radec_precession = astro_get_ra_dec(jd, astronomy_available_celestial_bodies[state->active_body_index], state->latitude_radians, state->longitude_radians, true);
     printf("\nParams to convert: %f %f %f %f %f\n",
@@ -22,11 +22,6 @@
  * SOFTWARE.
  */
 
-// Emulator only: need time() to seed the random number generator
-#if __EMSCRIPTEN__
-#include <time.h>
-#endif
-
 #include <stdlib.h>
 #include <string.h>
 #include "butterfly_game_face.h"
@@ -78,11 +73,7 @@ static int8_t game_win_melody[] = {
 
 // returns a random integer r with 0 <= r < max
 static inline uint8_t _get_rand(uint8_t max) {
-#if __EMSCRIPTEN__
-    return rand() % max;
-#else
-    return arc4random_uniform(max);
-#endif
+    return watch_random_uniform(max);
 }
 
 /*
@@ -426,11 +417,6 @@ void butterfly_game_face_setup(movement_settings_t *settings, uint8_t watch_face
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
     // Do any pin or peripheral setup here; this will be called whenever the watch wakes from deep sleep.
-#if __EMSCRIPTEN__
-    // simulator only: seed the random number generator
-    time_t t;
-    srand((unsigned) time(&t));
-#endif
 }
 
 void butterfly_game_face_activate(movement_settings_t *settings, void *context) {
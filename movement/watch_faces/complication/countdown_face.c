@@ -76,8 +76,7 @@ static void schedule_countdown(countdown_state_t *state, movement_settings_t *se
     uint32_t new_now = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), get_tz_offset(settings));
     state->target_ts = watch_utility_offset_timestamp(new_now, state->hours, state->minutes, state->seconds);
     state->now_ts = new_now;
-    watch_date_time target_dt = watch_utility_date_time_from_unix_time(state->target_ts, get_tz_offset(settings));
-    movement_schedule_background_task_for_face(state->watch_face_index, target_dt);
+    movement_timer_start(&state->timer, state->target_ts - state->now_ts);
 }
 
 static void auto_repeat(countdown_state_t *state, movement_settings_t *settings) {
@@ -141,13 +140,13 @@ static void draw(countdown_state_t *state, uint8_t subsecond) {
 
 static void pause(countdown_state_t *state) {
     state->mode = cd_paused;
-    movement_cancel_background_task_for_face(state->watch_face_index);
+    movement_timer_cancel(&state->timer);
     watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
 }
 
 static void reset(countdown_state_t *state) {
     state->mode = cd_reset;
-    movement_cancel_background_task_for_face(state->watch_face_index);
+    movement_timer_cancel(&state->timer);
     load_countdown(state);
 }
 
@@ -165,6 +164,11 @@ static void times_up(movement_settings_t *settings, countdown_state_t *state) {
     }
 }
 
+static void countdown_timer_callback(movement_timer_t *timer, movement_settings_t *settings, void *context) {
+    (void) timer;
+    times_up(settings, (countdown_state_t *)context);
+}
+
 static void settings_increment(countdown_state_t *state) {
     switch(state->selection) {
         case 0:
@@ -193,7 +197,7 @@ void countdown_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
         memset(*context_ptr, 0, sizeof(countdown_state_t));
         state->minutes = DEFAULT_MINUTES;
         state->mode = cd_reset;
-        state->watch_face_index = watch_face_index;
+        movement_timer_init(&state->timer, "countdown", countdown_timer_callback, state);
         store_countdown(state);
     }
 }
@@ -321,9 +325,6 @@ bool countdown_face_loop(movement_event_t event, movement_settings_t *settings,
         case EVENT_ALARM_LONG_UP:
             abort_quick_ticks(state);
             break;
-        case EVENT_BACKGROUND_TASK:
-            times_up(settings, state);
-            break;
         case EVENT_TIMEOUT:
             abort_quick_ticks(state);
             movement_move_to_face(0);
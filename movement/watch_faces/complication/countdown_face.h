@@ -38,11 +38,12 @@
  *
  * Max countdown is 23 hours, 59 minutes and 59 seconds.
  *
- * Note: we have to prevent the watch from going to deep sleep using
- * movement_schedule_background_task() while the timer is running.
+ * Note: the countdown runs on a Movement timer, which also prevents the
+ * watch from going to deep sleep while the countdown is running.
  */
 
 #include "movement.h"
+#include "movement_timer.h"
 
 typedef enum {
     cd_paused,
@@ -63,7 +64,7 @@ typedef struct {
     uint8_t selection;
     countdown_mode_t mode;
     bool repeat;
-    uint8_t watch_face_index;
+    movement_timer_t timer;
 } countdown_state_t;
 
 
@@ -29,94 +29,32 @@
 #include "watch.h"
 #include "watch_utility.h"
 #include "watch_rtc.h"
-
-/*
- * IMPORTANT: This watch face uses the same TC2 callback counter as the Stock Stopwatch
- * watch-face. It works through calling a global handler function. The two watch-faces
- * therefore can't coexist within the same firmware. If you want to compile this watch-face
- * then you need to remove the line <../watch_faces/complication/stock_stopwatch_face.c \>
- * from the Makefile.
- */
-
-// FROM stock_stopwatch_face.c ////////////////////////////////////////////////
-// Copyright (c) 2022 Andreas Nebinger
-
-#if __EMSCRIPTEN__
-#include <emscripten.h>
-#include <emscripten/html5.h>
-#else
-#include "../../../watch-library/hardware/include/saml22j18a.h"
-#include "../../../watch-library/hardware/include/component/tc.h"
-#include "../../../watch-library/hardware/hri/hri_tc_l22.h"
-#endif
+#include "watch_timebase.h"
 
 static const watch_date_time distant_future = {.unit = {0, 0, 0, 1, 1, 63}};
 static bool _is_running;
 static uint32_t _ticks;
+static int8_t _timebase_client = WATCH_TIMEBASE_INVALID_CLIENT;
+static uint64_t _origin;
 
-#if __EMSCRIPTEN__
-
-static long _em_interval_id = 0;
-
-void em_dual_timer_cb_handler(void *userData) {
-    // interrupt handler for emscripten 128 Hz callbacks
-    (void) userData;
-    _ticks++;
-}
-
-static void _dual_timer_cb_initialize() { }
-
-static inline void _dual_timer_cb_stop() {
-    emscripten_clear_interval(_em_interval_id);
-    _em_interval_id = 0;
-    _is_running = false;
-}
-
-static inline void _dual_timer_cb_start() {
-    // initiate 128 hz callback
-    _em_interval_id = emscripten_set_interval(em_dual_timer_cb_handler, (double)(1000/128), (void *)NULL);
-}
-
-#else
+// timebase ticks per 128 Hz timer tick (32768 Hz / 128 Hz)
+#define TIMEBASE_TICKS_PER_TICK_SHIFT 8
 
 static inline void _dual_timer_cb_start() {
-    // start the TC2 timer
-    hri_tc_set_CTRLA_ENABLE_bit(TC2);
-    _is_running = true;
+    // the shared timebase runs for as long as we are registered
+    _timebase_client = watch_timebase_register_client();
+    _origin = watch_timebase_now();
 }
 
 static inline void _dual_timer_cb_stop() {
-    // stop the TC2 timer
-    hri_tc_clear_CTRLA_ENABLE_bit(TC2);
-    _is_running = false;
+    watch_timebase_unregister_client(_timebase_client);
+    _timebase_client = WATCH_TIMEBASE_INVALID_CLIENT;
 }
 
-static void _dual_timer_cb_initialize() {
-    // setup and initialize TC2 for a 64 Hz interrupt
-    hri_mclk_set_APBCMASK_TC2_bit(MCLK);
-    hri_gclk_write_PCHCTRL_reg(GCLK, TC2_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK3 | GCLK_PCHCTRL_CHEN);
-    _dual_timer_cb_stop();
-    hri_tc_write_CTRLA_reg(TC2, TC_CTRLA_SWRST);
-    hri_tc_wait_for_sync(TC2, TC_SYNCBUSY_SWRST);
-    hri_tc_write_CTRLA_reg(TC2, TC_CTRLA_PRESCALER_DIV64 | // 32 Khz divided by 64 divided by 4 results in a 128 Hz interrupt
-                           TC_CTRLA_MODE_COUNT8 | 
-                           TC_CTRLA_RUNSTDBY);
-    hri_tccount8_write_PER_reg(TC2, 3);
-    hri_tc_set_INTEN_OVF_bit(TC2);
-    NVIC_ClearPendingIRQ(TC2_IRQn);
-    NVIC_EnableIRQ (TC2_IRQn);
+static inline void _dual_timer_update_ticks() {
+    if (_is_running) _ticks = (watch_timebase_now() - _origin) >> TIMEBASE_TICKS_PER_TICK_SHIFT;
 }
 
-// you need to take stock_stopwatch.c out of the Makefile or this will create a conflict
-// you have to choose between one of the stopwatches
- void TC2_Handler(void) {
-    // interrupt handler for TC2 (globally!)
-    _ticks++;
-    TC2->COUNT8.INTFLAG.reg |= TC_INTFLAG_OVF;
-}
-
-#endif
-
 // STATIC FUNCTIONS ///////////////////////////////////////////////////////////
 
 /** @brief converts tick counts to duration struct for time display 
@@ -234,9 +172,6 @@ void dual_timer_face_setup(movement_settings_t *settings, uint8_t watch_face_ind
         memset(*context_ptr, 0, sizeof(dual_timer_state_t));
         _ticks = 0;
     }
-    if (!_is_running) {
-        _dual_timer_cb_initialize();
-    }
 }
 
 void dual_timer_face_activate(movement_settings_t *settings, void *context) {
@@ -250,6 +185,8 @@ void dual_timer_face_activate(movement_settings_t *settings, void *context) {
 bool dual_timer_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     dual_timer_state_t *state = (dual_timer_state_t *)context;
 
+    _dual_timer_update_ticks();
+
     // timers stop at 99:23:59:59:99
     if ( (_ticks - state->start_ticks[0]) >= 1105919999 )
         stop_timer(state, 0);
@@ -60,11 +60,8 @@
  * the timers. In this case LONG PRESSING MODE will move to the next face instead of moving
  * back to the default watch face.
  *
- * IMPORTANT: This watch face uses the same TC2 callback counter as the Stock Stopwatch
- * watch-face. It works through calling a global handler function. The two watch-faces
- * therefore can't coexist within the same firmware. If you want to compile this watch-face
- * then you need to remove the line <../watch_faces/complication/stock_stopwatch_face.c \>
- * from the Makefile.
+ * Time is measured with the watch library's shared timebase, so this face can be used
+ * alongside the Stock Stopwatch face.
  */
 
 #include "movement.h"
@@ -90,12 +87,6 @@ void dual_timer_face_activate(movement_settings_t *settings, void *context);
 bool dual_timer_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void dual_timer_face_resign(movement_settings_t *settings, void *context);
 
-#if __EMSCRIPTEN__
-void em_dual_timer_cb_handler(void *userData);
-#else
-void TC2_Handler(void);
-#endif
-
 #define dual_timer_face ((const watch_face_t){ \
     dual_timer_face_setup, \
     dual_timer_face_activate, \
@@ -99,11 +99,7 @@ static void print_binary(uint32_t value, int bits) {
 }
 
 static uint32_t get_random(uint32_t max) {
-    #if __EMSCRIPTEN__
-    return rand() % max;
-    #else
-    return arc4random_uniform(max);
-    #endif
+    return watch_random_uniform(max);
 }
 
 static uint32_t get_random_nonzero(uint32_t max) {
@@ -80,12 +80,7 @@ static uint8_t deck[DECK_SIZE] = {0};
 static uint8_t current_card = 0;
 
 static uint8_t generate_random_number(uint8_t num_values) {
-    // Emulator: use rand. Hardware: use arc4random.
-#if __EMSCRIPTEN__
-    return rand() % num_values;
-#else
-    return arc4random_uniform(num_values);
-#endif
+    return watch_random_uniform(num_values);
 }
 
 static void stack_deck(void) {
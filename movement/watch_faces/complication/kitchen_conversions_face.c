@@ -25,12 +25,13 @@
 #include <stdlib.h>
 #include <string.h>
 #include "kitchen_conversions_face.h"
+#include "decimal.h"
 
 typedef struct
 {
     char name[6];          // Name to display on selection
-    double conv_factor_uk; // Unit as represented in base units (UK)
-    double conv_factor_us; // Unit as represented in base units (US)
+    decimal_t conv_factor_uk; // Unit as represented in base units (UK), as {mantissa, exponent}
+    decimal_t conv_factor_us; // Unit as represented in base units (US)
     int16_t linear_factor; // Addition of constant (For temperatures)
 } unit;
 
@@ -51,28 +52,28 @@ static char measures[MEASURES_COUNT][6] = {"WeIght", " Temp", " VOL"};
 const uint8_t units_count[4] = {WEIGHT_COUNT, TEMP_COUNT, VOL_COUNT};
 
 static const unit weights[WEIGHT_COUNT] = {
-    {" g", 1., 1., 0}, // BASE
-    {" kg", 1000., 1000, 0},
-    {"Ounce", 28.34952, 28.34952, 0},
-    {" Pound", 453.5924, 453.5924, 0},
+    {" g", {1, 0}, {1, 0}, 0}, // BASE
+    {" kg", {1, 3}, {1, 3}, 0},
+    {"Ounce", {2834952, -5}, {2834952, -5}, 0},
+    {" Pound", {4535924, -4}, {4535924, -4}, 0},
 };
 
 static const unit temps[TEMP_COUNT] = {
-    {" # C", 1.8, 1.8, 32},
-    {" # F", 1., 1., 0}, // BASE
-    {"Gas Mk", 25., 25., 250},
+    {" # C", {18, -1}, {18, -1}, 32},
+    {" # F", {1, 0}, {1, 0}, 0}, // BASE
+    {"Gas Mk", {25, 0}, {25, 0}, 250},
 };
 
 static const unit vols[VOL_COUNT] = {
-    {"  n&L", 1., 1., 0}, // BASE (ml)
-    {"   L", 1000., 1000., 0},
-    {" Fl Oz", 28.41306, 29.57353, 0},
-    {" Tbsp", 17.75816, 14.78677, 0},
-    {" Tsp", 5.919388, 4.928922, 0},
-    {"  Cup", 284.1306, 236.5882, 0},
-    {" Pint", 568.2612, 473.1765, 0},
-    {" Quart", 1136.522, 946.353, 0},
-    {"Gallon", 4546.09, 3785.412, 0},
+    {"  n&L", {1, 0}, {1, 0}, 0}, // BASE (ml)
+    {"   L", {1, 3}, {1, 3}, 0},
+    {" Fl Oz", {2841306, -5}, {2957353, -5}, 0},
+    {" Tbsp", {1775816, -5}, {1478677, -5}, 0},
+    {" Tsp", {5919388, -6}, {4928922, -6}, 0},
+    {"  Cup", {2841306, -4}, {2365882, -4}, 0},
+    {" Pint", {5682612, -4}, {4731765, -4}, 0},
+    {" Quart", {1136522, -3}, {946353, -3}, 0},
+    {"Gallon", {454609, -2}, {3785412, -3}, 0},
 };
 
 static int8_t calc_success_seq[5] = {BUZZER_NOTE_G6, 10, BUZZER_NOTE_C7, 10, 0};
@@ -244,15 +245,17 @@ static void display(kitchen_conversions_state_t *state, movement_settings_t *set
         unit froms = get_unit_list(state->measurement_i)[state->from_i];
         unit tos = get_unit_list(state->measurement_i)[state->to_i];
         // Chooses correct factor for locale
-        double f_conv_factor = state->from_is_us ? froms.conv_factor_us : froms.conv_factor_uk;
-        double t_conv_factor = state->to_is_us ? tos.conv_factor_us : tos.conv_factor_uk;
+        decimal_t f_conv_factor = state->from_is_us ? froms.conv_factor_us : froms.conv_factor_uk;
+        decimal_t t_conv_factor = state->to_is_us ? tos.conv_factor_us : tos.conv_factor_uk;
         // Converts
-        double to_base = (state->selection_value * f_conv_factor) + 100 * froms.linear_factor;
-        double conversion = ((to_base - 100 * tos.linear_factor) / t_conv_factor);
+        decimal_t to_base = decimal_add(decimal_mul(decimal_from_int(state->selection_value), f_conv_factor),
+                                        decimal_from_int(100 * froms.linear_factor));
+        decimal_t conversion = decimal_div(decimal_sub(to_base, decimal_from_int(100 * tos.linear_factor)), t_conv_factor);
+        int64_t rounded;
 
         // If number too large or too small
         uint8_t lower_bound = (state->measurement_i == TEMP && state->to_i == 2) ? 100 : 0;
-        if (conversion >= 1000000 || conversion < lower_bound)
+        if (!decimal_to_fixed(conversion, 0, &rounded) || rounded >= 1000000 || rounded < lower_bound)
         {
             watch_set_indicator(WATCH_INDICATOR_BELL);
             watch_display_string("Err", 5);
@@ -262,9 +265,8 @@ static void display(kitchen_conversions_state_t *state, movement_settings_t *set
         }
         else
         {
-            uint32_t rounded = conversion + .5;
             char buf[7];
-            sprintf(buf, "%6lu", rounded);
+            sprintf(buf, "%6lu", (uint32_t)rounded);
             watch_display_string(buf, 4);
 
             // Make sure LSDs always filled
@@ -33,6 +33,8 @@
 #include <math.h>
 #include "moon_phase_face.h"
 #include "watch_utility.h"
+#include "movement_time.h"
+#include "movement_tz.h"
 
 #define LUNAR_DAYS 29.53058770576
 #define LUNAR_SECONDS (LUNAR_DAYS * (24 * 60 * 60))
@@ -58,9 +60,8 @@ void moon_phase_face_activate(movement_settings_t *settings, void *context) {
 static void _update(movement_settings_t *settings, moon_phase_state_t *state, uint32_t offset) {
     (void)state;
     char buf[11];
-    watch_date_time date_time = watch_rtc_get_date_time();
-    uint32_t now = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60) + offset;
-    date_time = watch_utility_date_time_from_unix_time(now, movement_timezone_offsets[settings->bit.time_zone] * 60);
+    uint32_t now = movement_time_get_unix_time() + offset;
+    watch_date_time date_time = watch_utility_date_time_from_unix_time(now, movement_tz_get_utc_offset(settings->bit.time_zone, now, NULL));
     double currentfrac = fmod(now - FIRST_MOON, LUNAR_SECONDS) / LUNAR_SECONDS;
     double currentday = currentfrac * LUNAR_DAYS;
     uint8_t phase_index = 0;
@@ -29,6 +29,8 @@
 #include "watch.h"
 #include "watch_utility.h"
 #include "planetary_time_face.h"
+#include "movement_time.h"
+#include "movement_tz.h"
 
 #if __EMSCRIPTEN__
 #include <emscripten.h>
@@ -128,8 +130,8 @@ static void _planetary_solar_phase(movement_settings_t *settings, planetary_time
     // location detected
     state->no_location = false;
 
-    watch_date_time date_time = watch_rtc_get_date_time(); // the current local date / time
-    watch_date_time utc_now = watch_utility_date_time_convert_zone(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60, 0); // the current date / time in UTC
+    now_epoch = movement_time_get_unix_time(); // the current UNIX epoch time
+    watch_date_time utc_now = watch_utility_date_time_from_unix_time(now_epoch, 0); // the current date / time in UTC
     watch_date_time scratch_time; // scratchpad, contains different values at different times
     watch_date_time midnight;
     scratch_time.reg = midnight.reg = utc_now.reg;
@@ -141,11 +143,9 @@ static void _planetary_solar_phase(movement_settings_t *settings, planetary_time
     double lat = (double)lat_centi / 100.0;
     double lon = (double)lon_centi / 100.0;
 
-    // save UTC offset
-    state->utc_offset = ((double)movement_timezone_offsets[settings->bit.time_zone]) / 60.0;
+    // save UTC offset, including daylight saving time
+    state->utc_offset = ((double)movement_tz_get_utc_offset(settings->bit.time_zone, now_epoch, NULL)) / 3600.0;
 
-    // get UNIX epoch time
-    now_epoch = watch_utility_date_time_to_unix_time(utc_now, 0);
     midnight_epoch = watch_utility_date_time_to_unix_time(midnight, 0);
 
     // calculate sunrise and sunset of current day in decimal hours after midnight
@@ -211,10 +211,11 @@ static void _planetary_time(movement_event_t event, movement_settings_t *setting
         watch_set_colon();
 
     // get current time and convert to UTC
-    state->scratch = watch_utility_date_time_convert_zone(watch_rtc_get_date_time(), movement_timezone_offsets[settings->bit.time_zone] * 60, 0); 
+    uint32_t now_epoch = movement_time_get_unix_time();
+    state->scratch = watch_utility_date_time_from_unix_time(now_epoch, 0);
 
     // when current phase ends calculate the next phase
-    if ( watch_utility_date_time_to_unix_time(state->scratch, 0) >= state->phase_end ) {
+    if ( now_epoch >= state->phase_end ) {
         _planetary_solar_phase(settings, state);
         return;
     }
@@ -339,11 +339,7 @@ static void _generate_blindspot(randonaut_state_t *state) {
 /** @brief pseudo random number generator
  */
 static uint32_t _get_pseudo_entropy(uint32_t max) {
-    #if __EMSCRIPTEN__
-    return rand() % max;
-    #else
-    return arc4random_uniform(max);
-    #endif
+    return watch_random_uniform(max);
 }
 
 /** @brief true random number generator
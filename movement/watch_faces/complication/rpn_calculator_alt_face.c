@@ -24,7 +24,6 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 
 #include "rpn_calculator_alt_face.h"
 
@@ -42,31 +41,38 @@ void rpn_calculator_alt_face_setup(movement_settings_t *settings, uint8_t watch_
     // Do any pin or peripheral setup here; this will be called whenever the watch wakes from deep sleep.
 }
 
-static void show_number(double num) {
+static void show_number(decimal_t num) {
     char buf[9] = {0};
-    bool negative = num < 0;
+    bool negative = decimal_is_negative(num);
     int max_digits = negative ? 5 : 6;
 
     // Add back in for debugging...
-    // printf("%f\n", num);
+    // decimal_to_string(num, buf); printf("%s\n", buf);
 
-    if (isnan(num)) {
+    if (decimal_is_nan(num)) {
         watch_clear_colon();
         watch_display_string("  nan   ", 2);
         return;
     }
 
-    if (negative) {
-        num = -num;
+    if (decimal_is_inf(num)) {
+        watch_clear_colon();
+        watch_display_string("   big  ", 2);
+        return;
     }
 
+    num = decimal_abs(num);
+
     // Can we reasonably represent this number without a decimal point?
-    if (num == 0 || (num >= 0.5 && fabs(num - (int)num) < 0.0001)) {
-        if (floor(log10(num)) + 1 <= max_digits) {
+    if (decimal_is_zero(num) || (decimal_cmp(num, DECIMAL(5, -1)) >= 0 &&
+                                 decimal_cmp(decimal_sub(num, decimal_floor(num)), DECIMAL(1, -4)) < 0)) {
+        if (decimal_get_magnitude(num) + 1 <= max_digits) {
+            int64_t value;
+            decimal_to_fixed(num, 0, &value);
             if (negative) {
-                sprintf(buf, "  -%-5d", (int)round(num));
+                sprintf(buf, "  -%-5d", (int)value);
             } else {
-                sprintf(buf, "  %-6d", (int)round(num));
+                sprintf(buf, "  %-6d", (int)value);
             }
             watch_clear_colon();
             watch_display_string(buf, 2);
@@ -76,10 +82,11 @@ static void show_number(double num) {
 
     // Is this a floating point number where scientific
     // notation won't get us much? (i.e. between 0.1 and 1)
-    if (num < 1 && num >= 0.0999) {
+    if (decimal_cmp(num, DECIMAL_ONE) < 0 && decimal_cmp(num, DECIMAL(999, -4)) >= 0) {
         // Display as boring floating point number... (e.g. 0.25)
-        int digits = (int)round(num * 10000);
-        sprintf(buf, "   0%04d", digits);
+        int64_t digits;
+        decimal_to_fixed(num, 4, &digits);
+        sprintf(buf, "   0%04d", (int)digits);
         if (negative) {
             buf[2 ] = '-';
         }
@@ -88,19 +95,10 @@ static void show_number(double num) {
         return;
     }
 
-    // Fall back to scientific notation
-
-    // Calculate exponent
-    int exponent = 0;
-    while (num < 1) {
-        num *= 10;
-        --exponent;
-    }
-
-    while (num >= 10) {
-        num /= 10;
-        ++exponent;
-    }
+    // Fall back to scientific notation, with five significant digits.
+    int32_t digits;
+    int16_t exponent;
+    decimal_to_digits(num, 5, &digits, &exponent);
 
     if (exponent < -9) {
         sprintf(buf, "  small ");
@@ -116,7 +114,7 @@ static void show_number(double num) {
         return;
     }
 
-    sprintf(buf, "%2d%c%05d", exponent, negative ? '-' : ' ', (int)round(num * 10000));
+    sprintf(buf, "%2d%c%05d", exponent, negative ? '-' : ' ', (int)digits);
     watch_set_colon();
     watch_display_string(buf, 2);
 }
@@ -128,7 +126,7 @@ static void show_number(double num) {
 void rpn_calculator_alt_face_activate(movement_settings_t *settings, void *context) {
     (void) settings;
     calculator_state_t *s = (calculator_state_t *)context;
-    s->min = s->max = NAN;
+    s->min = s->max = DECIMAL_NAN;
 }
 
 static void change_mode(calculator_state_t *s, enum calculator_mode mode) {
@@ -150,103 +148,104 @@ static void adjust_number(calculator_state_t *s, int direction) {
     // If the direction we want to go has no bound (i.e. isnan),
     // then first get the sign right (moving to 0, then +-10), and
     // after than go up by *10.
-    if (isnan(direction > 0 ? s->max : s->min)) {
-        if (direction * C < 0) {
-            C = 0;
-        } else if (C == 0) {
-            C = direction * 10;
+    if (decimal_is_nan(direction > 0 ? s->max : s->min)) {
+        if (!decimal_is_zero(C) && decimal_is_negative(C) == (direction > 0)) {
+            C = DECIMAL_ZERO;
+        } else if (decimal_is_zero(C)) {
+            C = decimal_from_int(direction * 10);
         } else {
-            C *= 10;
+            C = decimal_mul(C, DECIMAL(10, 0));
         }
     } else {
         // We have a higher and lower bound. Split them.
-        C = (s->max + s->min) / 2;
+        C = decimal_mul(decimal_add(s->max, s->min), DECIMAL(5, -1));
         // Subtract 0.1 so we don't apply most significant rounding to things that are _exactly_ 1/10/100 apart.
-        double mag = log10(fabs(s->max - s->min)) - 0.1;
-        if (mag > 0.0) {
+        decimal_t mag = decimal_sub(decimal_log10(decimal_abs(decimal_sub(s->max, s->min))), DECIMAL(1, -1));
+        if (decimal_cmp(mag, DECIMAL_ZERO) > 0) {
             // i.e. the different is >= 2, which means we want to round aggressively
             // to not show people complicated looking numbers.
             // e.g. this takes a number like 3.2 to 3, or a number like 464 to 500
             // (depending on how fine-grained 'mag' tells us to be).
-            float div = pow(10, floor(mag));
-            int sign = C < 0 ? -1 : 1;
-            C = sign * floor(fabs(C) / div) * div;
+            decimal_t div = decimal_pow(DECIMAL(10, 0), decimal_floor(mag));
+            bool negative = decimal_is_negative(C);
+            C = decimal_mul(decimal_floor(decimal_div(decimal_abs(C), div)), div);
+            if (negative) C = decimal_neg(C);
         }
     }
 }
 
 static void fn_number(calculator_state_t *s) {
-    PUSH(10);
-    s->min = s->max = NAN;
+    PUSH(DECIMAL(10, 0));
+    s->min = s->max = DECIMAL_NAN;
     change_mode(s, CALC_NUMBER);
 }
 
 static void fn_add(calculator_state_t *s) {
-    double a = POP();
-    double b = POP();
-    PUSH(a + b);
+    decimal_t a = POP();
+    decimal_t b = POP();
+    PUSH(decimal_add(a, b));
 }
 
 static void fn_sub(calculator_state_t *s) {
-    double a = POP();
-    double b = POP();
-    PUSH(b - a);
+    decimal_t a = POP();
+    decimal_t b = POP();
+    PUSH(decimal_sub(b, a));
 }
 
 static void fn_mul(calculator_state_t *s) {
-    double a = POP();
-    double b = POP();
-    PUSH(a * b);
+    decimal_t a = POP();
+    decimal_t b = POP();
+    PUSH(decimal_mul(a, b));
 }
 
 static void fn_div(calculator_state_t *s) {
-    double a = POP();
-    double b = POP();
-    PUSH(b / a);
+    decimal_t a = POP();
+    decimal_t b = POP();
+    PUSH(decimal_div(b, a));
 }
 
 static void fn_pow(calculator_state_t *s) {
-    double a = POP();
-    double b = POP();
-    PUSH(pow(b, a));
+    decimal_t a = POP();
+    decimal_t b = POP();
+    PUSH(decimal_pow(b, a));
 }
 
 static void fn_sqrt(calculator_state_t *s) {
-    double x = POP();
-    PUSH(sqrt(x));
+    decimal_t x = POP();
+    PUSH(decimal_sqrt(x));
 }
 
 static void fn_log(calculator_state_t *s) {
-    double x = POP();
-    PUSH(log(x));
+    decimal_t x = POP();
+    PUSH(decimal_ln(x));
 }
 
 static void fn_log10(calculator_state_t *s) {
-    double x = POP();
-    PUSH(log10(x));
+    decimal_t x = POP();
+    PUSH(decimal_log10(x));
 }
 
 static void fn_e(calculator_state_t *s) {
-    PUSH(M_E);
+    PUSH(DECIMAL_E);
 }
 
 static void fn_sin(calculator_state_t *s) {
-    double x = POP();
-    PUSH(sin(x));
+    decimal_t x = POP();
+    PUSH(decimal_sin(x));
 }
 
 static void fn_cos(calculator_state_t *s) {
-    double x = POP();
-    PUSH(cos(x));
+    decimal_t x = POP();
+    PUSH(decimal_cos(x));
 }
 
 static void fn_tan(calculator_state_t *s) {
-    double x = POP();
-    PUSH(tan(x));
+    decimal_t x = POP();
+    PUSH(decimal_tan(x));
 }
 
 static void fn_pi(calculator_state_t *s) {
-    PUSH(M_PI);
+    PUSH(DECIMAL_PI);
 }
 
 static void fn_pop(calculator_state_t *s) {
@@ -254,14 +253,14 @@ static void fn_pop(calculator_state_t *s) {
 }
 
 static void fn_swap(calculator_state_t *s) {
-    double a = POP();
-    double b = POP();
+    decimal_t a = POP();
+    decimal_t b = POP();
     PUSH(a);
     PUSH(b);
 }
 
 static void fn_duplicate(calculator_state_t *s) {
-    double a = POP();
+    decimal_t a = POP();
     PUSH(a);
     PUSH(a);
 }
@@ -271,7 +270,7 @@ static void fn_clear(calculator_state_t *s) {
 }
 
 static void fn_size(calculator_state_t *s) {
-    double a = s->stack_size;
+    decimal_t a = decimal_from_int(s->stack_size);
     PUSH(a);
 }
 
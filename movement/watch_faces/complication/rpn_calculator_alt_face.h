@@ -60,6 +60,7 @@
  */
 
 #include "movement.h"
+#include "decimal.h"
 
 #define CALC_MAX_STACK_SIZE 20
 
@@ -69,12 +70,12 @@ enum calculator_mode {
 };
 
 typedef struct {
-    double stack[CALC_MAX_STACK_SIZE];
+    decimal_t stack[CALC_MAX_STACK_SIZE];
     uint8_t stack_size;  // this is the current stack top + 1 (so that '0' means nothing on the stack)
     uint8_t fn_index;
 
-    double min;
-    double max;
+    decimal_t min;
+    decimal_t max;
 
     enum calculator_mode mode;
 } calculator_state_t;
@@ -24,12 +24,15 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "rpn_calculator_face.h"
 
-static void draw_number(char *buf, float num) {
-    float f = fmodf(num, 1.0) * 100;
-    sprintf(buf, "CA  %4d%02d", ((int)num) % 10000, (int) f);
+static void draw_number(char *buf, decimal_t num) {
+    int64_t fixed;
+    if (!decimal_to_fixed(num, 2, &fixed)) {
+        sprintf(buf, "CA   err  ");
+        return;
+    }
+    sprintf(buf, "CA  %4d%02d", (int)((fixed / 100) % 10000), (int)(fixed < 0 ? -fixed : fixed) % 100);
 }
 
 static void draw_op(char *buf, rpn_calculator_op_t op) {
@@ -60,14 +63,18 @@ static void draw_op(char *buf, rpn_calculator_op_t op) {
     }
 }
 
+static void printf_decimal(const char *label, decimal_t d) {
+    char buf[18];
+    decimal_to_string(d, buf);
+    printf("%s%s", label, buf);
+}
+
 static void printf_stack(rpn_calculator_state_t *state) {
-    printf("Stack: [%f, %f, %f, %f], top: %d\n",
-        state->stack[0],
-        state->stack[1],
-        state->stack[2],
-        state->stack[3],
-        state->top
-    );
+    printf_decimal("Stack: [", state->stack[0]);
+    printf_decimal(", ", state->stack[1]);
+    printf_decimal(", ", state->stack[2]);
+    printf_decimal(", ", state->stack[3]);
+    printf("], top: %d\n", state->top);
 }
 
 static void next_op(rpn_calculator_state_t *state) {
@@ -75,28 +82,26 @@ static void next_op(rpn_calculator_state_t *state) {
     state->op = state->op % RPN_CALCULATOR_MAX_OPS;
 }
 
-// increase a digit of a floating point number
-// FIXME: this converts the number to string and back, there might
-// be better ways to do this
-static float inc_digit(float num, uint8_t position) {
-    char buf[8];
-    if (position > 5) {
-        return 0.0;
+// increase a digit of the number, as displayed: position 0 is the
+// hundredths, position 5 the thousands.
+static decimal_t inc_digit(decimal_t num, uint8_t position) {
+    int64_t fixed;
+    if (position > 5 || !decimal_to_fixed(num, 2, &fixed)) {
+        return DECIMAL_ZERO;
     }
-    // inverse position (rtl)
-    position = 5 - position;
-    float f = fmodf(num, 1.0) * 100;
-    sprintf(buf, "%04d%02d", ((int)num) % 10000, (int) f);
-    uint8_t digit = buf[position] - '0';
-    digit = (digit + 1) % 10;
-    buf[position] = digit + '0';
-    printf("buf: %s\n", buf);
-    return strtof(buf, NULL) / 100.0;
+    bool negative = fixed < 0;
+    int32_t value = (negative ? -fixed : fixed) % 1000000;
+    int32_t place = 1;
+    while (position--) place *= 10;
+    if ((value / place) % 10 == 9) value -= 9 * place;
+    else value += place;
+    return DECIMAL(negative ? -value : value, -2);
 }
 
-static void stack_push(rpn_calculator_state_t *state, float f) {
+static void stack_push(rpn_calculator_state_t *state, decimal_t f) {
     printf_stack(state);
-    printf("push: %f\n", f);
+    printf_decimal("push: ", f);
+    printf("\n");
     state->top++;
     if (state->top >= RPN_CALCULATOR_STACK_SIZE) {
         // FIXME: implement this using a circular buffer?
@@ -107,18 +112,19 @@ static void stack_push(rpn_calculator_state_t *state, float f) {
     state->stack[state->top] = f;
 }
 
-static float stack_peek(rpn_calculator_state_t *state) {
+static decimal_t stack_peek(rpn_calculator_state_t *state) {
     if (state->top > -1) {
         return state->stack[state->top];
     }
-    return 0;
+    return DECIMAL_ZERO;
 }
 
-static float stack_pop(rpn_calculator_state_t *state) {
+static decimal_t stack_pop(rpn_calculator_state_t *state) {
     printf_stack(state);
-    float f = stack_peek(state);
-    state->stack[state->top] = 0;
-    printf("pop: %f\n", f);
+    decimal_t f = stack_peek(state);
+    state->stack[state->top] = DECIMAL_ZERO;
+    printf_decimal("pop: ", f);
+    printf("\n");
     if (state->top > -1) {
         state->top--;
     } else {
@@ -133,7 +139,7 @@ static void run_op(rpn_calculator_state_t *state) {
     // ops without parameters
     switch (state->op)  {
         case rpn_calculator_op_pi:
-            stack_push(state, M_PI);
+            stack_push(state, DECIMAL_PI);
             op_found = true;
             break;
         default:
@@ -149,11 +155,12 @@ static void run_op(rpn_calculator_state_t *state) {
         state->mode = rpn_calculator_err;
         return;
     }
-    float right = stack_pop(state);
-    printf("right: %f\n", right);
+    decimal_t right = stack_pop(state);
+    printf_decimal("right: ", right);
+    printf("\n");
     switch (state->op)  {
         case rpn_calculator_op_sqrt:
-            stack_push(state, sqrt(right));
+            stack_push(state, decimal_sqrt(right));
             op_found = true;
             break;
         default:
@@ -170,27 +177,28 @@ static void run_op(rpn_calculator_state_t *state) {
         state->mode = rpn_calculator_err;
         return;
     }
-    float left = stack_pop(state);
-    printf("left: %f\n", left);
+    decimal_t left = stack_pop(state);
+    printf_decimal("left: ", left);
+    printf("\n");
     switch (state->op)  {
         case rpn_calculator_op_add:
-            stack_push(state, left + right);
+            stack_push(state, decimal_add(left, right));
             op_found = true;
             break;
         case rpn_calculator_op_sub:
-            stack_push(state, left - right);
+            stack_push(state, decimal_sub(left, right));
             op_found = true;
             break;
         case rpn_calculator_op_mul:
-            stack_push(state, left * right);
+            stack_push(state, decimal_mul(left, right));
             op_found = true;
             break;
         case rpn_calculator_op_div:
-            stack_push(state, left / right);
+            stack_push(state, decimal_div(left, right));
             op_found = true;
             break;
         case rpn_calculator_op_pow:
-            stack_push(state, powf(left, right));
+            stack_push(state, decimal_pow(left, right));
             op_found = true;
             break;
         default:
@@ -304,7 +312,7 @@ bool rpn_calculator_face_loop(movement_event_t event, movement_settings_t *setti
                 case rpn_calculator_waiting:
                     state->mode = rpn_calculator_number;
                     state->selection = 2;
-                    stack_push(state, 0);
+                    stack_push(state, DECIMAL_ZERO);
                     draw(state, event.subsecond);
                     movement_request_tick_frequency(4);
                     break;
@@ -35,6 +35,7 @@
  */
 
 #include "movement.h"
+#include "decimal.h"
 
 #define RPN_CALCULATOR_STACK_SIZE 4
 #define RPN_CALCULATOR_MAX_OPS 7;
@@ -59,7 +60,7 @@ typedef enum {
 typedef struct {
     rpn_calculator_mode_t mode;
     rpn_calculator_op_t op;
-    float stack[RPN_CALCULATOR_STACK_SIZE];
+    decimal_t stack[RPN_CALCULATOR_STACK_SIZE];
     int8_t top;
     uint8_t selection;
 } rpn_calculator_state_t;
@@ -27,11 +27,6 @@
 #include <stdlib.h>
 #include <string.h>
 
-// Emulator only: need time() to seed the random number generator
-#if __EMSCRIPTEN__
-#include <time.h>
-#endif
-
 static char _simon_display_buf[12];
 static uint8_t _timer;
 static uint16_t _delay_beep;
@@ -39,11 +34,7 @@ static uint16_t _timeout;
 static uint8_t _secSub;
 
 static inline uint8_t _simon_get_rand_num(uint8_t num_values) {
-#if __EMSCRIPTEN__
-    return rand() % num_values;
-#else
-    return arc4random_uniform(num_values);
-#endif
+    return watch_random_uniform(num_values);
 }
 
 static void _simon_clear_display(simon_state_t *state) {
@@ -213,11 +204,6 @@ void simon_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     }
     // Do any pin or peripheral setup here; this will be called whenever the watch
     // wakes from deep sleep.
-#if __EMSCRIPTEN__
-    // simulator only: seed the randon number generator
-    time_t t;
-    srand((unsigned)time(&t));
-#endif
 }
 
 void simon_face_activate(movement_settings_t *settings, void *context) {
@@ -24,8 +24,8 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "simple_calculator_face.h"
+#include "decimal.h"
 
 void simple_calculator_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
@@ -68,27 +68,19 @@ static void increment_placeholder(calculator_number_t *number, calculator_placeh
     *digits[placeholder] = (*digits[placeholder] + 1) % 10;
 }
 
-static float convert_to_float(calculator_number_t number) {
-    float result = 0.0;
+static decimal_t convert_to_decimal(calculator_number_t number) {
+    // the digits are exactly the mantissa, with the decimal point two places from the right.
+    int32_t result = number.thousands * 100000 +
+                     number.hundreds * 10000 +
+                     number.tens * 1000 +
+                     number.ones * 100 +
+                     number.tenths * 10 +
+                     number.hundredths;
 
-    // Add the whole number portion
-    result += number.thousands * 1000.0f;
-    result += number.hundreds * 100.0f;
-    result += number.tens * 10.0f;
-    result += number.ones * 1.0f;
-
-    // Add the fractional portion
-    result += number.tenths * 0.1f;
-    result += number.hundredths * 0.01f;
-
-    // Round to nearest hundredth
-    result = roundf(result * 100) / 100;
-    
     // Handle negative numbers
     if (number.negative) result = -result;
-    //printf("convert_to_float results = %f\n", result); // For debugging
 
-    return result;
+    return DECIMAL(result, -2);
 }
 
 static char* update_display_number(calculator_number_t *number, char *display_string, uint8_t which_num) {
@@ -136,7 +128,8 @@ static void cycle_operation(simple_calculator_state_t *state) {
 }
 
 
-static calculator_number_t convert_to_string(float number) {
+// number has already been rounded to hundredths, i.e. 1234.56 is passed in as 123456.
+static calculator_number_t convert_to_string(int32_t number) {
     calculator_number_t result;
 
     // Handle negative numbers
@@ -146,21 +139,13 @@ static calculator_number_t convert_to_string(float number) {
     } else result.negative = false;
 
     // Get each digit from each placeholder
-    int int_part = (int)number;
-
-    float decimal_part_float = ((number - int_part) * 100); // two decimal places
-    //printf("decimal_part_float = %f\n", decimal_part_float); //For debugging
+    result.thousands = number / 100000 % 10;
+    result.hundreds = number / 10000 % 10;
+    result.tens = number / 1000 % 10;
+    result.ones = number / 100 % 10;
 
-    int decimal_part = round(decimal_part_float);
-    //printf("decimal_part = %d\n", decimal_part); //For debugging
-
-    result.thousands = int_part / 1000 % 10;
-    result.hundreds = int_part / 100 % 10;
-    result.tens = int_part / 10 % 10;
-    result.ones = int_part % 10;
-
-    result.tenths = decimal_part / 10 % 10;
-    result.hundredths = decimal_part % 10;
+    result.tenths = number / 10 % 10;
+    result.hundredths = number % 10;
 
     return result;
 }
@@ -192,62 +177,60 @@ static void set_number(calculator_number_t *number, calculator_placeholder_t pla
 
 static void view_results(simple_calculator_state_t *state, char *display_string) {
 
-    // Initialize float variables to do the math
-    float first_num_float, second_num_float, result_float = 0.0f;
+    // Initialize decimal variables to do the math
+    decimal_t first_num, second_num, result = DECIMAL_ZERO;
+    int64_t result_fixed;
 
-    // Convert the passed numbers to floats
-    first_num_float = convert_to_float(state->first_num);
-    second_num_float = convert_to_float(state->second_num);
+    // Convert the passed numbers to decimals
+    first_num = convert_to_decimal(state->first_num);
+    second_num = convert_to_decimal(state->second_num);
     
     // Perform the calculation based on the selected operation
     switch (state->operation) {
         case OP_ADD:
-            result_float = first_num_float + second_num_float;
+            result = decimal_add(first_num, second_num);
             break;
         case OP_SUB:
-            result_float = first_num_float - second_num_float;
+            result = decimal_sub(first_num, second_num);
             break;
         case OP_MULT:
-            result_float = first_num_float * second_num_float;
+            result = decimal_mul(first_num, second_num);
             break;
         case OP_DIV:
-            if (second_num_float != 0) {
-                result_float = first_num_float / second_num_float;
+            if (!decimal_is_zero(second_num)) {
+                result = decimal_div(first_num, second_num);
             } else {
                 state->mode = MODE_ERROR;
                 return;
             }
             break;
         case OP_ROOT:
-            if (first_num_float >= 0) {
-                result_float = sqrtf(first_num_float);
+            if (!decimal_is_negative(first_num)) {
+                result = decimal_sqrt(first_num);
             } else {
                 state->mode = MODE_ERROR;
                 return;
             }
             break;
         case OP_POWER:
-            result_float = powf(first_num_float, second_num_float);
+            result = decimal_pow(first_num, second_num);
             break;
         default:
-            result_float = 0.0f;
+            result = DECIMAL_ZERO;
             break;
     }
 
-    // Be sure the result can fit on the watch display, else error
-    if (result_float > 9999.99 || result_float < -9999.99) {
+    // Round to hundredths, and be sure the result can fit on the watch display, else error
+    // (this also catches results that aren't numbers, like a negative number to a fractional power)
+    if (!decimal_to_fixed(result, 2, &result_fixed) || result_fixed > 999999 || result_fixed < -999999) {
         state->mode = MODE_ERROR;
         return;
     }
-    
-    result_float = roundf(result_float * 100.0f) / 100.0f; // Might not be needed
 
-    //printf("result as float = %f\n", result_float); // For debugging
-    
-    // Convert the float result to a string
+    // Convert the result to digits
     // This isn't strictly necessary, but allows easily reusing the result as
     // the next calculation's first_num
-    state->result = convert_to_string(result_float);
+    state->result = convert_to_string(result_fixed);
     
     // Update the display with the result
     update_display_number(&state->result, display_string, 3);
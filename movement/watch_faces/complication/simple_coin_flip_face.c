@@ -49,11 +49,7 @@ void simple_coin_flip_face_activate(movement_settings_t *settings, void *context
 }
 
 static uint32_t get_random(uint32_t max) {
-    #if __EMSCRIPTEN__
-    return rand() % max;
-    #else
-    return arc4random_uniform(max);
-    #endif
+    return watch_random_uniform(max);
 }
 
 static void animation_0() {
@@ -32,6 +32,16 @@
 
 #define PIECE_LIST_END_MARKER 0xff
 
+/* the CPU searches up to this many plys, plus a few more for exchanges and checks */
+#define SMALLCHESS_SEARCH_MAX_DEPTH 5
+#define SMALLCHESS_SEARCH_EXTENSION_DEPTH 2
+/* while thinking, search for SMALLCHESS_THINK_SLICE timebase ticks (~80 ms) out of every 125 ms tick... */
+#define SMALLCHESS_THINK_TICK_FREQUENCY 8
+#define SMALLCHESS_THINK_SLICE (WATCH_TIMEBASE_FREQUENCY * 80 / 1000)
+#define SMALLCHESS_SEARCH_STEPS 16
+/* ...and play the best move found so far after 10 seconds. */
+#define SMALLCHESS_THINK_TICKS (SMALLCHESS_THINK_TICK_FREQUENCY * 10)
+
 int8_t cpu_done_beep[] = {BUZZER_NOTE_C5, 5, BUZZER_NOTE_C6, 5, BUZZER_NOTE_C7, 5, 0};
 
 static void smallchess_init_board(smallchess_face_state_t *state) {
@@ -50,6 +60,8 @@ void smallchess_face_setup(movement_settings_t *settings, uint8_t watch_face_ind
         /* now alloc/init the game board */
         smallchess_face_state_t *state = (smallchess_face_state_t *)*context_ptr;
         state->game = malloc(sizeof(SCL_Game));
+        state->search = malloc(sizeof(SCL_Search));
+        state->timebase_client = WATCH_TIMEBASE_INVALID_CLIENT;
         smallchess_init_board(*context_ptr);
     }
 }
@@ -77,26 +89,38 @@ static void _smallchess_calc_moveable_pieces(smallchess_face_state_t *state) {
     state->moveable_pieces_idx = 0;
 }
 
-static void _smallchess_make_ai_move(smallchess_face_state_t *state) {
-    char ai_from_str[3] = {0};
-    char ai_to_str[3] = {0};
+static void _smallchess_start_timebase(smallchess_face_state_t *state) {
+    if (state->timebase_client == WATCH_TIMEBASE_INVALID_CLIENT) state->timebase_client = watch_timebase_register_client();
+}
+
+static void _smallchess_stop_timebase(smallchess_face_state_t *state) {
+    watch_timebase_unregister_client(state->timebase_client);
+    state->timebase_client = WATCH_TIMEBASE_INVALID_CLIENT;
+}
+
+static void _smallchess_start_ai_move(smallchess_face_state_t *state) {
     uint8_t rep_from, rep_to;
-    char ai_prom;
 
-    watch_clear_display();
-    watch_start_character_blink('C', 100);
     SCL_gameGetRepetiotionMove(state->game, &rep_from, &rep_to);
+    SCL_searchInit(state->search, ((SCL_Game *)state->game)->board, SMALLCHESS_SEARCH_MAX_DEPTH, SMALLCHESS_SEARCH_EXTENSION_DEPTH, SCL_boardEvaluateStatic, rep_from, rep_to);
+    state->think_ticks = 0;
+    state->state = SMALLCHESS_THINKING;
+
+    _smallchess_start_timebase(state);
+    movement_request_tick_frequency(SMALLCHESS_THINK_TICK_FREQUENCY);
+}
 
-#ifndef __EMSCRIPTEN__
-    hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_16_Val);
-#endif
-    SCL_getAIMove(state->game, 3, 0, 0, SCL_boardEvaluateStatic, NULL, 0, rep_from, rep_to, &state->ai_from_square, &state->ai_to_square, &ai_prom);
-#ifndef __EMSCRIPTEN__
-    hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_4_Val);
-#endif
+static void _smallchess_finish_ai_move(smallchess_face_state_t *state) {
+    SCL_Search *search = (SCL_Search *)state->search;
+    char ai_from_str[3] = {0};
+    char ai_to_str[3] = {0};
+
+    state->ai_from_square = search->resultFrom;
+    state->ai_to_square = search->resultTo;
+    SCL_gameMakeMove(state->game, state->ai_from_square, state->ai_to_square, 'q');
 
-    SCL_gameMakeMove(state->game, state->ai_from_square, state->ai_to_square, ai_prom);
-    watch_stop_blink();
+    _smallchess_stop_timebase(state);
+    movement_request_tick_frequency(1);
 
     watch_buzzer_play_sequence(cpu_done_beep, NULL);
 
@@ -107,6 +131,24 @@ static void _smallchess_make_ai_move(smallchess_face_state_t *state) {
 
     /* now cache the list of legal pieces we can move */
     _smallchess_calc_moveable_pieces(state);
+
+    state->state = SMALLCHESS_SHOW_CPU_MOVE;
+}
+
+static void _smallchess_think(smallchess_face_state_t *state) {
+    SCL_Search *search = (SCL_Search *)state->search;
+
+    /* search for one slice of time, then give the rest of the tick back to the watch */
+    movement_request_performance_level(WATCH_PERFORMANCE_LEVEL_HIGH);
+    uint64_t deadline = watch_timebase_now() + SMALLCHESS_THINK_SLICE;
+    while (!SCL_searchStep(search, SMALLCHESS_SEARCH_STEPS) && watch_timebase_now() < deadline);
+
+    if (state->think_ticks < 255) state->think_ticks++;
+
+    /* play once the search is done, or when we're out of time and have a move to show for it */
+    if (search->done || (state->think_ticks >= SMALLCHESS_THINK_TICKS && search->resultDepth > 0)) {
+        _smallchess_finish_ai_move(state);
+    }
 }
 
 static char _smallchess_make_lowercase(char c) {
@@ -150,6 +192,16 @@ static void _smallchess_face_update_lcd(smallchess_face_state_t *state) {
     uint16_t ply = ((SCL_Game *)state->game)->ply;
 
     switch (state->state) {
+        case SMALLCHESS_THINKING:
+            /* show the depth searched so far and the best move at that depth */
+            if (((SCL_Search *)state->search)->resultDepth > 0) {
+                SCL_squareToString(((SCL_Search *)state->search)->resultFrom, start_coord);
+                SCL_squareToString(((SCL_Search *)state->search)->resultTo, end_coord);
+                snprintf(buf, sizeof(buf), "CP%2d %s-%s", ((SCL_Search *)state->search)->resultDepth, start_coord, end_coord);
+            } else {
+                snprintf(buf, sizeof(buf), "CP        ");
+            }
+            break;
         case SMALLCHESS_MENU_RESUME:
             snprintf(buf, sizeof(buf), "SC%2dResume", ply);
             break;
@@ -233,8 +285,7 @@ static void _smallchess_select_main_menu_subitem(smallchess_face_state_t *state)
         case SMALLCHESS_MENU_NEW_BLACK:
             SCL_gameInit((SCL_Game *)state->game, 0);
             /* force a move since black is playing */
-            _smallchess_make_ai_move(state);
-            state->state = SMALLCHESS_SHOW_CPU_MOVE;
+            _smallchess_start_ai_move(state);
             break;
         case SMALLCHESS_MENU_SHOW_LAST_MOVE:
             /* fetch the move */
@@ -357,8 +408,7 @@ static void _smallchess_handle_select_dest_button_event(smallchess_face_state_t
 
             /* if the player didn't win or draw here, calculate a move */
             if (((SCL_Game *)state->game)->state == SCL_GAME_STATE_PLAYING) {
-                _smallchess_make_ai_move(state);
-                state->state = SMALLCHESS_SHOW_CPU_MOVE;
+                _smallchess_start_ai_move(state);
             } else {
                 /* player ended the game through mate or draw; jump to select piece screen to show state */
                 state->state = SMALLCHESS_SELECT_PIECE;
@@ -369,6 +419,19 @@ static void _smallchess_handle_select_dest_button_event(smallchess_face_state_t
     }
 }
 
+static void _smallchess_handle_thinking_button_event(smallchess_face_state_t *state, movement_event_t event) {
+    switch (event.event_type) {
+        case EVENT_ALARM_LONG_PRESS:
+            /* play now, if we have found anything yet */
+            if (((SCL_Search *)state->search)->resultDepth > 0) {
+                _smallchess_finish_ai_move(state);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
 /* this just waits until any button is hit */
 static void _smallchess_handle_show_cpu_move_button_event(smallchess_face_state_t *state, movement_event_t event) {
     switch (event.event_type) {
@@ -401,6 +464,8 @@ static void _smallchess_handle_playing_button_event(smallchess_face_state_t *sta
         _smallchess_handle_select_piece_button_event(state, event);
     } else if (state->state == SMALLCHESS_SELECT_DEST) {
         _smallchess_handle_select_dest_button_event(state, event);
+    } else if (state->state == SMALLCHESS_THINKING) {
+        _smallchess_handle_thinking_button_event(state, event);
     } else if (state->state == SMALLCHESS_SHOW_CPU_MOVE) {
         _smallchess_handle_show_cpu_move_button_event(state, event);
     } else if (state->state == SMALLCHESS_SHOW_LAST_MOVE) {
@@ -469,7 +534,11 @@ bool smallchess_face_loop(movement_event_t event, movement_settings_t *settings,
 
     switch (event.event_type) {
         case EVENT_ACTIVATE:
-            if (((SCL_Game *)state->game)->ply == 0) {
+            if (state->state == SMALLCHESS_THINKING) {
+                /* pick up the search where we left it */
+                _smallchess_start_timebase(state);
+                movement_request_tick_frequency(SMALLCHESS_THINK_TICK_FREQUENCY);
+            } else if (((SCL_Game *)state->game)->ply == 0) {
                 state->state = SMALLCHESS_MENU_NEW_WHITE;
             } else {
                 state->state = SMALLCHESS_MENU_RESUME;
@@ -484,6 +553,10 @@ bool smallchess_face_loop(movement_event_t event, movement_settings_t *settings,
             _smallchess_face_update_lcd(state);
             break;
         case EVENT_TICK:
+            if (state->state == SMALLCHESS_THINKING) {
+                _smallchess_think(state);
+                _smallchess_face_update_lcd(state);
+            }
             break;
         case EVENT_TIMEOUT:
             break;
@@ -499,6 +572,8 @@ bool smallchess_face_loop(movement_event_t event, movement_settings_t *settings,
 
 void smallchess_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
-    (void) context;
+    smallchess_face_state_t *state = (smallchess_face_state_t *)context;
+    /* if we're thinking, the search stays where it is until we come back */
+    _smallchess_stop_timebase(state);
     watch_set_led_off();
 }
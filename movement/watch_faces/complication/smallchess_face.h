@@ -40,6 +40,11 @@
  * - Alarm button: navigate forwards through the current menu
  * - Light button (long press): navigate up to the parent menu
  * - Alarm button (long press): select the current item or submenu
+ *
+ * While the CPU is thinking, the display shows CP, the search depth and the
+ * best move found so far at that depth. The search runs in short slices
+ * between ticks, so the watch stays responsive; long press the alarm button
+ * to make the CPU play its best move right away.
  */
 
 enum smallchess_state {
@@ -53,6 +58,7 @@ enum smallchess_state {
     SMALLCHESS_PLAYING_SPLIT,
 
     /* playing game submenu */
+    SMALLCHESS_THINKING,
     SMALLCHESS_SHOW_LAST_MOVE,
     SMALLCHESS_SHOW_CPU_MOVE,
     SMALLCHESS_SELECT_PIECE,
@@ -64,6 +70,9 @@ enum smallchess_state {
 
 typedef struct {
     void *game;
+    void *search;
+    uint8_t think_ticks;
+    int8_t timebase_client;
     enum smallchess_state state;
     uint8_t moveable_pieces[SMALLCHESS_NUM_PIECES + 1];
     uint8_t moveable_pieces_idx;
@@ -28,6 +28,7 @@
 #include "watch.h"
 #include "watch_utility.h"
 #include "watch_rtc.h"
+#include "watch_timebase.h"
 
 /*
     This watch face implements the original F-91W stopwatch functionality
@@ -39,20 +40,15 @@
        turns on on each button press or it doesn't.
 */
 
-#if __EMSCRIPTEN__
-#include <emscripten.h>
-#include <emscripten/html5.h>
-#else
-#include "../../../watch-library/hardware/include/saml22j18a.h"
-#include "../../../watch-library/hardware/include/component/tc.h"
-#include "../../../watch-library/hardware/hri/hri_tc_l22.h"
-#endif
-
 // distant future for background task: January 1, 2083
 static const watch_date_time distant_future = {
     .unit = {0, 0, 0, 1, 1, 63}
 };
 
+// timebase ticks per stopwatch tick (32768 Hz / 128 Hz)
+#define TIMEBASE_TICKS_PER_TICK_SHIFT 8
+#define TIMEBASE_TICKS_PER_HOUR ((uint64_t)WATCH_TIMEBASE_FREQUENCY * 60 * 60)
+
 static uint32_t _ticks;
 static uint32_t _lap_ticks;
 static uint8_t _blink_ticks;
@@ -61,68 +57,31 @@ static uint8_t _old_minutes;
 static uint8_t _hours;
 static bool _colon;
 static bool _is_running;
-
-#if __EMSCRIPTEN__
-
-static long _em_interval_id = 0;
-
-void em_cb_handler(void *userData) {
-    // interrupt handler for emscripten 128 Hz callbacks
-    (void) userData;
-    _ticks++;
-}
-
-static void _cb_initialize() { }
-
-static inline void _cb_stop() {
-    emscripten_clear_interval(_em_interval_id);
-    _em_interval_id = 0;
-    _is_running = false;
-}
-
-static inline void _cb_start() {
-    // initiate 128 hz callback
-    _em_interval_id = emscripten_set_interval(em_cb_handler, (double)(1000/128), (void *)NULL);
-}
-
-#else
+static int8_t _timebase_client = WATCH_TIMEBASE_INVALID_CLIENT;
+static uint64_t _start;     // timebase value at which the stopwatch would have read zero
+static uint64_t _elapsed;   // elapsed timebase ticks while the stopwatch is stopped
 
 static inline void _cb_start() {
-    // start the TC2 timer
-    hri_tc_set_CTRLA_ENABLE_bit(TC2);
+    // the shared timebase only runs while somebody needs it, so register when we start...
+    if (_timebase_client == WATCH_TIMEBASE_INVALID_CLIENT) _timebase_client = watch_timebase_register_client();
+    // ...and continue from where we stopped.
+    _start = watch_timebase_now() - _elapsed;
     _is_running = true;
 }
 
 static inline void _cb_stop() {
-    // stop the TC2 timer
-    hri_tc_clear_CTRLA_ENABLE_bit(TC2);
+    _elapsed = watch_timebase_now() - _start;
+    _ticks = _elapsed >> TIMEBASE_TICKS_PER_TICK_SHIFT;
+    // ...and unregister when we stop, so the timebase can power down if nobody else is using it.
+    watch_timebase_unregister_client(_timebase_client);
+    _timebase_client = WATCH_TIMEBASE_INVALID_CLIENT;
     _is_running = false;
 }
 
-static void _cb_initialize() {
-    // setup and initialize TC2 for a 64 Hz interrupt
-    hri_mclk_set_APBCMASK_TC2_bit(MCLK);
-    hri_gclk_write_PCHCTRL_reg(GCLK, TC2_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK3 | GCLK_PCHCTRL_CHEN);
-    _cb_stop();
-    hri_tc_write_CTRLA_reg(TC2, TC_CTRLA_SWRST);
-    hri_tc_wait_for_sync(TC2, TC_SYNCBUSY_SWRST);
-    hri_tc_write_CTRLA_reg(TC2, TC_CTRLA_PRESCALER_DIV64 | // 32 Khz divided by 64 divided by 4 results in a 128 Hz interrupt
-                           TC_CTRLA_MODE_COUNT8 | 
-                           TC_CTRLA_RUNSTDBY);
-    hri_tccount8_write_PER_reg(TC2, 3);
-    hri_tc_set_INTEN_OVF_bit(TC2);
-    NVIC_ClearPendingIRQ(TC2_IRQn);
-    NVIC_EnableIRQ (TC2_IRQn);
+static inline void _update_ticks() {
+    if (_is_running) _ticks = (watch_timebase_now() - _start) >> TIMEBASE_TICKS_PER_TICK_SHIFT;
 }
 
-void TC2_Handler(void) {
-    // interrupt handler for TC2 (globally!)
-    _ticks++;
-    TC2->COUNT8.INTFLAG.reg |= TC_INTFLAG_OVF;
-}
-
-#endif
-
 static inline void _button_beep(movement_settings_t *settings) {
     // play a beep as confirmation for a button press (if applicable)
     if (settings->bit.button_should_sound) watch_buzzer_play_note(BUZZER_NOTE_C7, 50);
@@ -210,13 +169,10 @@ void stock_stopwatch_face_setup(movement_settings_t *settings, uint8_t watch_fac
         memset(*context_ptr, 0, sizeof(stock_stopwatch_state_t));
         stock_stopwatch_state_t *state = (stock_stopwatch_state_t *)*context_ptr;
         _ticks = _lap_ticks = _blink_ticks = _old_minutes = _old_seconds = _hours = 0;
-    _is_running = _colon = false;
+        _elapsed = 0;
+        _is_running = _colon = false;
         state->light_on_button = true;
     }
-    if (!_is_running) {
-        // prepare the 128 Hz callback source
-        _cb_initialize();
-    }
 }
 
 void stock_stopwatch_face_activate(movement_settings_t *settings, void *context) {
@@ -231,9 +187,14 @@ void stock_stopwatch_face_activate(movement_settings_t *settings, void *context)
 bool stock_stopwatch_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     stock_stopwatch_state_t *state = (stock_stopwatch_state_t *)context;
 
+    _update_ticks();
+
     // handle overflow of fast ticks
     while (_ticks >= (128 * 60 * 60)) {
         _ticks -= (128 * 60 * 60);
+        // move the reference point along so the next reading is within the hour too
+        if (_is_running) _start += TIMEBASE_TICKS_PER_HOUR;
+        else _elapsed -= TIMEBASE_TICKS_PER_HOUR;
         _hours++;
         if (_hours >= 24) _hours -= 24;
         // initiate a re-draw
@@ -262,7 +223,7 @@ bool stock_stopwatch_face_loop(movement_event_t event, movement_settings_t *sett
             if (_is_running) {
                 // start or continue stopwatch
                 movement_request_tick_frequency(16);
-                // register 128 hz callback for time measuring
+                // start measuring time with the shared timebase
                 _cb_start();
                 // schedule the keepalive task when running
                 movement_schedule_background_task(distant_future);
@@ -286,7 +247,7 @@ bool stock_stopwatch_face_loop(movement_event_t event, movement_settings_t *sett
                     movement_request_tick_frequency(16);
                 } else {
                     // set lap ticks and stop updating the display
-                    _lap_ticks = _ticks;
+                    _lap_ticks = (watch_timebase_capture(_timebase_client) - _start) >> TIMEBASE_TICKS_PER_TICK_SHIFT;
                     movement_request_tick_frequency(2);
                     _set_colon();
                 }
@@ -297,6 +258,7 @@ bool stock_stopwatch_face_loop(movement_event_t event, movement_settings_t *sett
                 } else if (_ticks) {
                     // reset stopwatch
                     _ticks = _lap_ticks = _blink_ticks = _old_minutes = _old_seconds = _hours = 0;
+                    _elapsed = 0;
                     _button_beep(settings);
                 }
             }
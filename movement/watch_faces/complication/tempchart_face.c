@@ -29,7 +29,7 @@
 #include "watch.h"
 #include "watch_private_display.h"
 #include "filesystem.h"
-#include "thermistor_driver.h"
+#include "movement_sensors.h"
 
 struct {
     uint8_t stat[24 * 70];
@@ -46,6 +46,7 @@ void tempchart_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
     (void) settings;
     (void) context_ptr;
     (void) watch_face_index;
+    movement_sensors_subscribe(MOVEMENT_SENSOR_TEMPERATURE);
     // At boot, context_ptr will be NULL indicating that we don't have anyplace to store our context.
     if (filesystem_get_file_size("tempchart.ini") != sizeof(tempchart_state)) {
         // No previous ini or old version of ini file - create new config file
@@ -101,9 +102,7 @@ bool tempchart_face_loop(movement_event_t event, movement_settings_t *settings,
             break;
         case EVENT_BACKGROUND_TASK:
             // Here we measure temperature and do main frequency correction
-            thermistor_driver_enable();
-            float temperature_c = thermistor_driver_get_temperature();
-            thermistor_driver_disable();
+            float temperature_c = movement_sensors_get_temperature(30);
             watch_date_time date_time = watch_rtc_get_date_time();
 
             int temp = round(temperature_c * 2);
@@ -28,11 +28,7 @@
 #include "watch_utility.h"
 
 static uint32_t get_random(uint32_t max) {
-    #if __EMSCRIPTEN__
-    return rand() % max;
-    #else
-    return arc4random_uniform(max);
-    #endif
+    return watch_random_uniform(max);
 }
 
 static uint8_t get_first_pos(WordleLetterResult *word_elements_result) {
@@ -60,18 +56,46 @@ static uint8_t get_prev_pos(uint8_t curr_pos, WordleLetterResult *word_elements_
     return curr_pos;
 }
 
-static void get_next_letter(const uint8_t curr_pos, uint8_t *word_elements, const bool *known_wrong_letters, const bool skip_wrong_letter) {
+static void get_next_letter(const uint8_t curr_pos, uint8_t *word_elements, const uint16_t known_wrong_letters, const bool skip_wrong_letter) {
     do {
         if (word_elements[curr_pos] >= WORDLE_NUM_VALID_LETTERS) word_elements[curr_pos] = 0;
         else word_elements[curr_pos] = (word_elements[curr_pos] + 1) % WORDLE_NUM_VALID_LETTERS;
-    } while (skip_wrong_letter && known_wrong_letters[word_elements[curr_pos]]);  
+    } while (skip_wrong_letter && (known_wrong_letters & (1 << word_elements[curr_pos])));
 }
 
-static void get_prev_letter(const uint8_t curr_pos, uint8_t *word_elements, const bool *known_wrong_letters, const bool skip_wrong_letter) {
+static void get_prev_letter(const uint8_t curr_pos, uint8_t *word_elements, const uint16_t known_wrong_letters, const bool skip_wrong_letter) {
     do {
         if (word_elements[curr_pos] >= WORDLE_NUM_VALID_LETTERS) word_elements[curr_pos] = WORDLE_NUM_VALID_LETTERS - 1;
         else word_elements[curr_pos] = (word_elements[curr_pos] + WORDLE_NUM_VALID_LETTERS - 1) % WORDLE_NUM_VALID_LETTERS;
-    } while (skip_wrong_letter && known_wrong_letters[word_elements[curr_pos]]);  
+    } while (skip_wrong_letter && (known_wrong_letters & (1 << word_elements[curr_pos])));
+}
+
+// The dictionaries in wordle_face_dict.h store the last four letters of each word, one per nibble.
+static uint16_t pack_word(const uint8_t *word_elements) {
+    uint16_t packed = 0;
+    for (size_t i = 1; i < WORDLE_LENGTH; i++)
+        packed = (packed << 4) | word_elements[i];
+    return packed;
+}
+
+static void get_answer(uint16_t answer, uint8_t *word_elements) {
+    uint16_t dict_index = _valid_words[answer];
+    uint16_t packed = _valid_dict[dict_index];
+    uint8_t first_letter = 0;
+    while (_valid_dict_start[first_letter + 1] <= dict_index) first_letter++;
+    word_elements[0] = first_letter;
+    for (size_t i = WORDLE_LENGTH - 1; i > 0; i--) {
+        word_elements[i] = packed & 0xF;
+        packed >>= 4;
+    }
+}
+
+static void get_answer_string(uint16_t answer, char *buf) {
+    uint8_t answer_elements[WORDLE_LENGTH];
+    get_answer(answer, answer_elements);
+    for (size_t i = 0; i < WORDLE_LENGTH; i++)
+        buf[i] = _valid_letters[answer_elements[i]];
+    buf[WORDLE_LENGTH] = '\0';
 }
 
 static void display_letter(wordle_state_t *state, bool display_dash) {
@@ -108,28 +132,28 @@ static void display_already_guessed(wordle_state_t *state) {
     watch_display_string("GUESSD", 4);
 }
 
-static uint32_t check_word_in_dict(uint8_t *word_elements) {
-    bool is_exact_match;
-    for (uint16_t i = 0; i < WORDLE_NUM_WORDS; i++) {
-        is_exact_match = true;
-        for (size_t j = 0; j < WORDLE_LENGTH; j++) {
-            if (_valid_letters[word_elements[j]] != _valid_words[i][j]) {
-                is_exact_match = false;
-                break;  
-            }
-        }
-        if (is_exact_match) return i;
+// Binary search through the words in the dictionary that start with the same letter.
+static int32_t find_in_dict(const uint16_t *dict, const uint16_t *dict_start, const uint8_t *word_elements) {
+    uint16_t packed = pack_word(word_elements);
+    uint16_t lo = dict_start[word_elements[0]];
+    uint16_t hi = dict_start[word_elements[0] + 1];
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        if (dict[mid] < packed) lo = mid + 1;
+        else if (dict[mid] > packed) hi = mid;
+        else return mid;
     }
-    for (uint16_t i = 0; i < WORDLE_NUM_POSSIBLE_WORDS; i++) {
-        is_exact_match = true;
-        for (size_t j = 0; j < WORDLE_LENGTH; j++) {
-            if (_valid_letters[word_elements[j]] != _possible_words[i][j]) {
-                is_exact_match = false;
-                break;  
-            }
-        }
-        if (is_exact_match) return WORDLE_NUM_WORDS + i;
+    return -1;
+}
+
+static uint32_t check_word_in_dict(uint8_t *word_elements) {
+    for (size_t i = 0; i < WORDLE_LENGTH; i++) {
+        if (word_elements[i] >= WORDLE_NUM_VALID_LETTERS) return WORDLE_NUM_WORDS + WORDLE_NUM_POSSIBLE_WORDS;
     }
+    int32_t found = find_in_dict(_valid_dict, _valid_dict_start, word_elements);
+    if (found >= 0) return found;
+    found = find_in_dict(_possible_dict, _possible_dict_start, word_elements);
+    if (found >= 0) return WORDLE_NUM_WORDS + found;
     return WORDLE_NUM_WORDS + WORDLE_NUM_POSSIBLE_WORDS;
 }
 #endif
@@ -138,8 +162,10 @@ static bool check_word(wordle_state_t *state) {
     // Exact
     bool is_exact_match = true;
     bool answer_already_accounted[WORDLE_LENGTH] = { false };
+    uint8_t answer_elements[WORDLE_LENGTH];
+    get_answer(state->curr_answer, answer_elements);
     for (size_t i = 0; i < WORDLE_LENGTH; i++) {
-        if (_valid_letters[state->word_elements[i]] == _valid_words[state->curr_answer][i]) {
+        if (state->word_elements[i] == answer_elements[i]) {
             state->word_elements_result[i] = WORDLE_LETTER_CORRECT;
             answer_already_accounted[i] = true;
         }
@@ -154,7 +180,7 @@ static bool check_word(wordle_state_t *state) {
         if (state->word_elements_result[i] != WORDLE_LETTER_WRONG) continue;
         for (size_t j = 0; j < WORDLE_LENGTH; j++) {
             if (answer_already_accounted[j]) continue;
-            if (_valid_letters[state->word_elements[i]] == _valid_words[state->curr_answer][j]) {
+            if (state->word_elements[i] == answer_elements[j]) {
                 state->word_elements_result[i] = WORDLE_LETTER_WRONG_LOC;
                 answer_already_accounted[j] = true;
                 break;
@@ -173,25 +199,17 @@ static void show_skip_wrong_letter_indicator(bool skipping, WordleScreen curr_sc
 }
 
 static void update_known_wrong_letters(wordle_state_t *state) {
-    bool wrong_loc[WORDLE_NUM_VALID_LETTERS] = {false};
+    uint16_t wrong_loc = 0;
+    uint16_t wrong = 0;
     // To ignore letters that appear, but are in the wrong location, as letters that are guessed
     // more often than they appear in the word will display as WORDLE_LETTER_WRONG
     for (size_t i = 0; i < WORDLE_LENGTH; i++) {
-        if (state->word_elements_result[i] == WORDLE_LETTER_WRONG_LOC) {
-            for (size_t j = 0; j < WORDLE_NUM_VALID_LETTERS; j++) {
-                if (state->word_elements[i] == j)
-                    wrong_loc[j] = true;
-            }
-        }
-    }
-    for (size_t i = 0; i < WORDLE_LENGTH; i++) {
-        if (state->word_elements_result[i] == WORDLE_LETTER_WRONG) {
-            for (size_t j = 0; j < WORDLE_NUM_VALID_LETTERS; j++) {
-                if (state->word_elements[i] == j && !wrong_loc[j])
-                    state->known_wrong_letters[j] = true;
-            }
-        }
+        if (state->word_elements_result[i] == WORDLE_LETTER_WRONG_LOC)
+            wrong_loc |= 1 << state->word_elements[i];
+        else if (state->word_elements_result[i] == WORDLE_LETTER_WRONG)
+            wrong |= 1 << state->word_elements[i];
     }
+    state->known_wrong_letters |= wrong & ~wrong_loc;
 }
 
 static void display_attempt(uint8_t attempt) {
@@ -211,9 +229,7 @@ static void reset_all_elements(wordle_state_t *state) {
         state->word_elements[i] = WORDLE_NUM_VALID_LETTERS;
         state->word_elements_result[i] = WORDLE_LETTER_WRONG;
     }
-    for (size_t i = 0; i < WORDLE_NUM_VALID_LETTERS; i++){
-        state->known_wrong_letters[i] = false;
-    }
+    state->known_wrong_letters = 0;
 #if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
     for (size_t i = 0; i < WORDLE_MAX_ATTEMPTS; i++) {
         state->guessed_words[i] = WORDLE_NUM_WORDS + WORDLE_NUM_POSSIBLE_WORDS;
@@ -238,7 +254,9 @@ static void reset_board(wordle_state_t *state) {
     display_playing(state);
     watch_display_string(" -", 4);
 #if __EMSCRIPTEN__
-    printf("ANSWER: %s\r\n", _valid_words[state->curr_answer]);
+    char answer[WORDLE_LENGTH + 1];
+    get_answer_string(state->curr_answer, answer);
+    printf("ANSWER: %s\r\n", answer);
 #endif
 }
 
@@ -302,7 +320,9 @@ static uint32_t get_day_unix_time(void) {
 
 static void display_lose(wordle_state_t *state, uint8_t subsecond) {
     char buf[WORDLE_LENGTH + 6];
-    sprintf(buf," L   %s", subsecond % 2 ? _valid_words[state->curr_answer] : "     ");
+    char answer[WORDLE_LENGTH + 1];
+    get_answer_string(state->curr_answer, answer);
+    sprintf(buf," L   %s", subsecond % 2 ? answer : "     ");
     watch_display_string(buf, 0);
 }
 
@@ -463,13 +483,7 @@ static void insert_random_guess(wordle_state_t *state) {
     do {  // Don't allow the guess to be the same as the answer
         random_guess = get_random(_num_random_guess_words);
     } while (random_guess == state->curr_answer); 
-    for (size_t i = 0; i < WORDLE_LENGTH; i++) {
-        for (size_t j = 0; j < WORDLE_NUM_VALID_LETTERS; j++)
-        {
-            if (_valid_words[random_guess][i] == _valid_letters[j])
-                state->word_elements[i] = j;     
-        }
-    } 
+    get_answer(random_guess, state->word_elements);
     state->position = WORDLE_LENGTH - 1;
     display_all_letters(state);
     state->using_random_guess = true;
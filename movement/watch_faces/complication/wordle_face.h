@@ -31,8 +31,8 @@
  * Wordle Face
  * A port of NY Times' Wordle game (https://www.nytimes.com/games/wordle/index.html)
  * A random 5 letter word is chosen and you have WORDLE_MAX_ATTEMPTS attempts to guess it.
- * Each guess must be a valid 5-letter word found in _legal_words in the C file.
- * The only letters used are _valid_letters, also found in the C file.
+ * Each guess must be a valid 5-letter word found in the dictionaries in wordle_face_dict.h.
+ * The only letters used are _valid_letters, also found in that file.
  * After a guess, the letters in the correct spot will remain, 
  * and the letters found in the word, but in the incorrect spot will blink.
  * The screen after the title screen if a new game is started shows the streak of games won in a row.
@@ -76,7 +76,7 @@
  *      Starting a new game instead of continuing is not allowed in this state.
 */
 #define WORDLE_USE_DAILY_STREAK 1
-#define WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES false  // This allows non-words to be entered and repeat guesses to be made. It saves ~11.5KB of ROM.
+#define WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES false  // This allows non-words to be entered and repeat guesses to be made. It saves ~3.8KB of ROM.
 /*  WORDLE_USE_RANDOM_GUESS
  *  0 = Don't allow quickly choosing a random quess
  *  1 = Allow using a random guess of any value that can be an answer
@@ -87,7 +87,9 @@
 #include "wordle_face_dict.h"
 
 #define WORDLE_NUM_WORDS (sizeof(_valid_words) / sizeof(_valid_words[0]))
-#define WORDLE_NUM_POSSIBLE_WORDS (sizeof(_possible_words) / sizeof(_possible_words[0]))
+#if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
+#define WORDLE_NUM_POSSIBLE_WORDS (sizeof(_possible_dict) / sizeof(_possible_dict[0]))
+#endif
 #define WORDLE_NUM_VALID_LETTERS (sizeof(_valid_letters) / sizeof(_valid_letters[0]))
 
 typedef enum {
@@ -128,7 +130,7 @@ typedef struct {
     bool skip_wrong_letter : 1;
     uint8_t streak;
     WordleScreen curr_screen;
-    bool known_wrong_letters[WORDLE_NUM_VALID_LETTERS];
+    uint16_t known_wrong_letters;  // One bit per letter in _valid_letters
     uint32_t day_last_game_started;
 } wordle_state_t;
 
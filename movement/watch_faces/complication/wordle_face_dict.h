@@ -11,283 +11,261 @@
 
 static const char _valid_letters[] = {'A', 'C', 'E', 'H', 'I', 'L', 'N', 'O', 'P', 'R', 'S', 'T'};
 
+// Each dictionary below is sorted alphabetically and grouped by first letter. A word is packed into 16 bits
+// as the index into _valid_letters of each of its last four letters, one per nibble, with the second letter
+// in the top nibble. The words starting with _valid_letters[i] are found from _<name>_dict_start[i] up to
+// (but not including) _<name>_dict_start[i + 1], so a lookup is a binary search within one group.
+
 // From: https://matthewminer.name/projects/calculators/wordle-words-left/
 // Number of words found: 432
-static const char _valid_words[][WORDLE_LENGTH + 1] = {
-    "SLATE", "STARE", "SNARE", "SANER", "CRANE", "STALE", "CRATE", "RAISE", "TRACE", 
-    "SHARE", "ARISE", "SCARE", "SPARE", "CHAOS", "TAPIR", "CAIRN", "TENOR", "CLEAN", 
-    "HEART", "SCOPE", "SNARL", "SLEPT", "SINCE", "EPOCH", "SPACE", "RELIC", "SPOIL", 
-    "LITER", "LEAPT", "LANCE", "RANCH", "HORSE", "LEACH", "LATER", "STEAL", "CHEAP", 
-    "SHORT", "ETHIC", "CHANT", "ACTOR", "REACH", "SEPIA", "ONSET", "SPLAT", "LEANT", 
-    "REACT", "OCTAL", "SPORE", "IRATE", "CORAL", "NICER", "SPILT", "SCENT", "PANIC", 
-    "SHIRT", "PECAN", "SLAIN", "SPLIT", "ROACH", "ASCOT", "PHONE", "LITHE", "STOIC", 
-    "STRIP", "RENAL", "POISE", "ENACT", "CHEAT", "PITCH", "NOISE", "INLET", "PEARL", 
-    "POLAR", "PEACH", "STOLE", "CASTE", "CREST", "CRONE", "ETHOS", "THEIR", "STONE", 
-    "SHIRE", "LATCH", "HASTE", "CLOSE", "SPINE", "SLANT", "SPEAR", "SCALE", "CAPER", 
-    "RETCH", "PESTO", "CHIRP", "SPORT", "OPTIC", "SNAIL", "PRICE", "PLANE", "TORCH", 
-    "PASTE", "RECAP", "SOLAR", "CRASH", "LINER", "OPINE", "ASHEN", "PALER", "ECLAT", 
-    "SPELT", "TRIAL", "PERIL", "SLICE", "SCANT", "SAINT", "POSIT", "ATONE", "SPIRE", 
-    "COAST", "INEPT", "SHOAL", "CLASH", "THORN", "PHASE", "SCORE", "TRICE", "PERCH", 
-    "PORCH", "SHEAR", "CHOIR", "RHINO", "PLANT", "SHONE", "CHORE", "LEARN", "ALTER", 
-    "CHAIN", "PANEL", "PLIER", "STEIN", "COPSE", "SONIC", "ALIEN", "CHOSE", "ACORN", 
-    "ANTIC", "CHEST", "OTHER", "CHINA", "TALON", "SCORN", "PLAIN", "PILOT", "RIPEN", 
-    "PATCH", "SPICE", "CLONE", "SCION", "SCONE", "STRAP", "PARSE", "SHALE", "RISEN", 
-    "CANOE", "INTER", "LEASH", "ISLET", "PRINT", "SHINE", "NORTH", "CLEAT", "PLAIT", 
-    "SCRAP", "CLEAR", "SLOTH", "LAPSE", "CHAIR", "SNORT", "SHARP", "OPERA", "STAIN", 
-    "TEACH", "TRAIL", "TRAIN", "LATHE", "PIANO", "PINCH", "PETAL", "STERN", "PRONE", 
-    "PROSE", "PLEAT", "TROPE", "PLACE", "POSER", "INERT", "CHASE", "CAROL", "STAIR", 
-    "SATIN", "SPITE", "LOATH", "ROAST", "ARSON", "SHAPE", "CLASP", "LOSER", "SALON", 
-    "CATER", "SHALT", "INTRO", "ALERT", "PENAL", "SHORE", "RINSE", "CREPT", "APRON", 
-    "SONAR", "AISLE", "AROSE", "HATER", "NICHE", "POINT", "EARTH", "PINTO", "THOSE", 
-    "CLOTH", "NOTCH", "TOPIC", "RESIN", "SCALP", "HEIST", "HERON", "TRIPE", "TONAL", 
-    "TAPER", "SHORN", "TONIC", "HOIST", "SNORE", "STORE", "SLOPE", "OCEAN", "CHART", 
-    "PAINT", "SPENT", "SNIPE", "CRISP", "TRASH", "PATIO", "PLATE", "HOTEL", "LEAST", 
-    "ALONE", "RALPH", "SPIEL", "SIREN", "RATIO", "STOOP", "TROLL", "ATOLL", "SLASH", 
-    "RETRO", "CREEP", "STILT", "SPREE", "TASTE", "CACHE", "CANON", "EATEN", "TEPEE", 
-    "SHEET", "SNEER", "ERROR", "NATAL", "SLEEP", "STINT", "TROOP", "SHALL", "STALL", 
-    "PIPER", "TOAST", "NASAL", "CORER", "THERE", "POOCH", "SCREE", "ELITE", "ALTAR", 
-    "PENCE", "EATER", "ALPHA", "TENTH", "LINEN", "SHEER", "TAINT", "HEATH", "CRIER", 
-    "TENSE", "CARAT", "CANAL", "APNEA", "THESE", "HATCH", "SHELL", "CIRCA", "APART", 
-    "SPILL", "STEEL", "LOCAL", "STOOL", "SHEEN", "RESET", "STEEP", "ELATE", "PRESS", 
-    "SLEET", "CROSS", "TOTAL", "TREAT", "ONION", "STATE", "CINCH", "ASSET", "THREE", 
-    "TORSO", "SNOOP", "PENNE", "SPOON", "SHEEP", "PAPAL", "STILL", "CHILL", "THETA", 
-    "LEECH", "INNER", "HONOR", "LOOSE", "CONIC", "SCENE", "COACH", "CONCH", "LATTE", 
-    "ERASE", "ESTER", "PEACE", "PASTA", "INANE", "SPOOL", "TEASE", "HARSH", "PIECE", 
-    "STEER", "SCOOP", "NINTH", "OTTER", "OCTET", "EERIE", "RISER", "LAPEL", "HIPPO", 
-    "PREEN", "ETHER", "AORTA", "SENSE", "TRACT", "SHOOT", "SLOOP", "REPEL", "TITHE", 
-    "IONIC", "CELLO", "CHESS", "SOOTH", "COCOA", "TITAN", "TOOTH", "TIARA", "CRESS", 
-    "SLOSH", "RARER", "TERSE", "ERECT", "HELLO", "PARER", "RIPER", "NOOSE", "CREPE", 
-    "CACAO", "ILIAC", "POSSE", "CACTI", "EASEL", "LASSO", "ROOST", "ALLOT", "COLON", 
-    "LEPER", "TEETH", "TITLE", "HENCE", "NIECE", "PAPER", "TRITE", "SPELL", "RACER", 
-    "ATTIC", "CRASS", "HITCH", "LEASE", "CEASE", "ROTOR", "ELOPE", "APPLE", "CHILI", 
-    "START", "PHOTO", "SALSA", "STASH", "PRIOR", "TAROT", "COLOR", "CHEER", "CLASS", 
-    "ARENA", "ELECT", "ENTER", "CATCH", "TENET", "TACIT", "TRAIT", "TERRA", "LILAC", 
+static const uint16_t _valid_dict[] = {
+    0x1796, 0x1B79, 0x4A52, 0x529B, 0x5426, 0x557B, 0x5762, 0x5830, 0x5B09, 0x5B29, 0x6B41, 0x79B0,
+    0x809B, 0x8620, 0x8852, 0x8976, 0x9260, 0x94A2, 0x97A2, 0x9A76, 0xA17B, 0xA326, 0xAA2B, 0xB755,
+    0xB762, 0xBB41, 0x0107, 0x0132, 0x01B4, 0x0496, 0x0605, 0x0672, 0x0676, 0x0829, 0x090B, 0x0975,
+    0x0AB2, 0x0B13, 0x0B29, 0x20A2, 0x2557, 0x3046, 0x3049, 0x306B, 0x307A, 0x309B, 0x30A2, 0x3208,
+    0x320B, 0x3229, 0x32AA, 0x32AB, 0x3454, 0x3455, 0x3460, 0x3498, 0x3749, 0x3792, 0x37A2, 0x4613,
+    0x4910, 0x50A3, 0x50A8, 0x50AA, 0x5206, 0x5209, 0x520B, 0x5762, 0x57A2, 0x57B3, 0x7013, 0x70AB,
+    0x7170, 0x7576, 0x7579, 0x7613, 0x7641, 0x78A2, 0x7905, 0x7929, 0x9062, 0x90A3, 0x90AA, 0x90B2,
+    0x9228, 0x9282, 0x928B, 0x92AA, 0x92AB, 0x9429, 0x94A8, 0x9762, 0x97AA, 0x09B3, 0x0A25, 0x0B26,
+    0x0B29, 0x150B, 0x2942, 0x50B2, 0x521B, 0x54B2, 0x5782, 0x601B, 0x6B29, 0x8713, 0x90A2, 0x921B,
+    0x9979, 0xAB29, 0xB329, 0xB341, 0xB37A, 0x09A3, 0x0AB2, 0x0B13, 0x0B29, 0x209B, 0x20B3, 0x24AB,
+    0x2557, 0x2612, 0x2976, 0x4887, 0x4B13, 0x74AB, 0x7679, 0x79A2, 0x7B25, 0x5401, 0x6062, 0x628B,
+    0x629B, 0x652B, 0x6629, 0x6B29, 0x6B97, 0x7641, 0x90B2, 0xA52B, 0x0612, 0x0825, 0x08A2, 0x0AA7,
+    0x0B13, 0x0B29, 0x0B32, 0x0BB2, 0x2013, 0x206B, 0x208B, 0x2096, 0x20A2, 0x20A3, 0x20AB, 0x2213,
+    0x2829, 0x4501, 0x4626, 0x4629, 0x4B29, 0x4B32, 0x70B3, 0x7105, 0x77A2, 0x7A29, 0x0A05, 0x0B05,
+    0x4129, 0x4132, 0x4212, 0x46B3, 0x74A2, 0x77A2, 0x79B3, 0x7B13, 0x1206, 0x1B05, 0x1B2B, 0x6476,
+    0x6A2B, 0x8290, 0x8462, 0x8B41, 0xB329, 0xBB29, 0x046B, 0x0529, 0x0625, 0x0641, 0x0805, 0x0829,
+    0x0929, 0x09A2, 0x0AB0, 0x0AB2, 0x0B13, 0x0B47, 0x2012, 0x2013, 0x2095, 0x2106, 0x2605, 0x2612,
+    0x2662, 0x2913, 0x2945, 0x2AB7, 0x2B05, 0x30A2, 0x3762, 0x37B7, 0x4067, 0x4212, 0x457B, 0x4613,
+    0x46B7, 0x4829, 0x4B13, 0x5012, 0x5046, 0x504B, 0x5062, 0x506B, 0x50B2, 0x520B, 0x5429, 0x746B,
+    0x74A2, 0x7509, 0x7713, 0x7913, 0x7A29, 0x7A4B, 0x7AA2, 0x9226, 0x92AA, 0x9412, 0x946B, 0x9479,
+    0x9762, 0x97A2, 0x0129, 0x04A2, 0x0583, 0x0613, 0x0929, 0x0B47, 0x2013, 0x201B, 0x2108, 0x2541,
+    0x2605, 0x2825, 0x2A2B, 0x2A46, 0x2B13, 0x2B97, 0x3467, 0x46A2, 0x4826, 0x4829, 0x4A26, 0x4A29,
+    0x7013, 0x70AB, 0x77AB, 0x7B79, 0x046B, 0x0576, 0x05A0, 0x0629, 0x0B46, 0x1052, 0x1058, 0x106B,
+    0x1092, 0x1262, 0x126B, 0x1476, 0x1762, 0x1778, 0x1782, 0x1792, 0x1796, 0x1908, 0x1922, 0x26A2,
+    0x2840, 0x3052, 0x3055, 0x305B, 0x3082, 0x3092, 0x3098, 0x3209, 0x3226, 0x3228, 0x3229, 0x322B,
+    0x3255, 0x3462, 0x3492, 0x349B, 0x3705, 0x3762, 0x377B, 0x3792, 0x3796, 0x379B, 0x4612, 0x4926,
+    0x5046, 0x506B, 0x50A3, 0x50B2, 0x5228, 0x522B, 0x528B, 0x5412, 0x5778, 0x5782, 0x57A3, 0x57B3,
+    0x6045, 0x6092, 0x6095, 0x6229, 0x6482, 0x6778, 0x6792, 0x679B, 0x7509, 0x7609, 0x7641, 0x77B3,
+    0x8012, 0x8092, 0x8209, 0x8255, 0x825B, 0x826B, 0x8412, 0x8425, 0x8455, 0x845B, 0x8462, 0x8492,
+    0x84B2, 0x850B, 0x854B, 0x8745, 0x8775, 0x8776, 0x8792, 0x879B, 0x8922, 0xB046, 0xB049, 0xB052,
+    0xB055, 0xB092, 0xB09B, 0xB0A3, 0xB0B2, 0xB205, 0xB225, 0xB228, 0xB229, 0xB246, 0xB296, 0xB455,
+    0xB45B, 0xB46B, 0xB741, 0xB752, 0xB762, 0xB775, 0xB778, 0xB792, 0xB908, 0xB948, 0x014B, 0x046B,
+    0x0576, 0x0829, 0x0849, 0x097B, 0x0AB2, 0x2013, 0x20A2, 0x22B3, 0x262B, 0x2679, 0x26A2, 0x26B3,
+    0x2822, 0x2990, 0x29A2, 0x3249, 0x3292, 0x32A2, 0x32B0, 0x3796, 0x37A2, 0x3922, 0x4090, 0x4B06,
+    0x4B32, 0x4B52, 0x70AB, 0x7605, 0x7641, 0x77B3, 0x7841, 0x7913, 0x79A7, 0x7B05, 0x9012, 0x901B,
+    0x9045, 0x9046, 0x904B, 0x90A3, 0x920B, 0x9405, 0x9412, 0x9482, 0x94B2, 0x9755, 0x9778, 0x9782,
+};
+static const uint16_t _valid_dict_start[] = {
+    0, 26, 93, 113, 129, 140, 166, 176, 186, 242, 268, 382, 432,
 };
 
+// The words that can be the answer, as indices into _valid_dict, in the order they're offered.
+static const uint16_t _valid_words[] = {
+    315, 361, 325, 271, 80, 359, 83, 243, 418, 293, 17, 276, 337, 44, 386, 29,
+    393, 64, 117, 282, 326, 318, 310, 105, 336, 251, 351, 160, 150, 140, 245, 127,
+    148, 145, 365, 47, 309, 111, 43, 1, 248, 288, 180, 349, 149, 249, 177, 354,
+    138, 78, 168, 345, 278, 189, 303, 201, 312, 350, 264, 20, 210, 161, 374, 381,
+    252, 228, 103, 48, 218, 172, 133, 200, 229, 199, 375, 36, 88, 91, 112, 399,
+    376, 302, 144, 114, 68, 346, 313, 338, 273, 33, 256, 207, 55, 355, 183, 324,
+    237, 222, 415, 195, 250, 332, 81, 159, 182, 21, 187, 97, 340, 425, 206, 319,
+    275, 268, 233, 24, 347, 71, 131, 304, 61, 403, 209, 283, 426, 205, 231, 295,
+    56, 258, 223, 305, 57, 151, 9, 41, 188, 226, 369, 77, 334, 4, 58, 0,
+    10, 51, 184, 54, 384, 284, 220, 214, 260, 196, 342, 67, 279, 280, 380, 193,
+    289, 262, 31, 135, 153, 139, 238, 301, 174, 66, 221, 285, 65, 323, 142, 42,
+    331, 294, 181, 357, 389, 420, 421, 146, 212, 215, 208, 370, 240, 241, 225, 431,
+    219, 232, 132, 46, 35, 358, 272, 348, 162, 265, 19, 292, 62, 165, 269, 38,
+    291, 136, 3, 202, 307, 259, 86, 15, 333, 2, 18, 116, 169, 227, 93, 216,
+    404, 69, 175, 414, 255, 274, 119, 122, 427, 411, 385, 308, 412, 125, 330, 379,
+    321, 176, 45, 186, 341, 328, 90, 423, 197, 224, 128, 154, 6, 244, 343, 311,
+    247, 378, 429, 23, 314, 257, 84, 372, 356, 388, 27, 32, 95, 396, 299, 327,
+    108, 167, 316, 373, 430, 290, 360, 217, 410, 166, 79, 400, 230, 286, 101, 8,
+    203, 96, 7, 395, 158, 298, 383, 118, 89, 394, 34, 30, 13, 401, 115, 300,
+    60, 12, 344, 366, 163, 377, 296, 254, 367, 99, 236, 317, 92, 417, 424, 179,
+    364, 59, 22, 405, 416, 329, 204, 353, 297, 190, 371, 53, 402, 155, 134, 126,
+    164, 76, 277, 70, 75, 147, 106, 109, 198, 194, 130, 352, 390, 113, 213, 368,
+    281, 171, 185, 178, 98, 263, 141, 123, 235, 110, 11, 287, 419, 306, 320, 253,
+    408, 137, 40, 50, 335, 72, 407, 413, 406, 87, 322, 246, 398, 107, 120, 192,
+    261, 173, 85, 26, 129, 234, 28, 94, 143, 266, 5, 73, 156, 391, 409, 121,
+    170, 191, 428, 339, 242, 25, 82, 124, 152, 39, 267, 102, 14, 52, 362, 211,
+    270, 363, 239, 387, 74, 49, 63, 16, 100, 104, 37, 392, 382, 422, 397, 157,
+};
+
+#if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
 // These are words that'll never be used, but still need to be in the dictionary for guesses.
 // Number of words found: 1898
-static const char _possible_words[][WORDLE_LENGTH + 1] = {
-#if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES
-    "AALII", "AARTI", "ACAIS", "ACARI", "ACCAS", "ACERS", "ACETA", "ACHAR", "ACHES", 
-    "ACHOO", "ACINI", "ACNES", "ACRES", "ACROS", "ACTIN", "ACTON", "AECIA", "AEONS", 
-    "AERIE", "AEROS", "AESIR", "AHEAP", "AHENT", "AHINT", "AINEE", "AIOLI", "AIRER", 
-    "AIRNS", "AIRTH", "AIRTS", "AITCH", "ALAAP", "ALANE", "ALANS", "ALANT", "ALAPA", 
-    "ALAPS", "ALATE", "ALCOS", "ALECS", "ALEPH", "ALIAS", "ALINE", "ALIST", "ALLEE", 
-    "ALLEL", "ALLIS", "ALOES", "ALOHA", "ALOIN", "ALOOS", "ALTHO", "ALTOS", "ANANA", 
-    "ANATA", "ANCHO", "ANCLE", "ANCON", "ANEAR", "ANELE", "ANENT", "ANILE", "ANILS", 
-    "ANION", "ANISE", "ANLAS", "ANNAL", "ANNAS", "ANNAT", "ANOAS", "ANOLE", "ANSAE", 
-    "ANTAE", "ANTAR", "ANTAS", "ANTES", "ANTIS", "ANTRA", "ANTRE", "APACE", "APERS", 
-    "APERT", "APHIS", "APIAN", "APIOL", "APISH", "APOOP", "APORT", "APPAL", "APPEL", 
-    "APPRO", "APRES", "APSES", "APSIS", "APSOS", "APTER", "ARARS", "ARCHI", "ARCOS", 
-    "AREAE", "AREAL", "AREAR", "AREAS", "ARECA", "AREIC", "ARENE", "AREPA", "ARERE", 
-    "ARETE", "ARETS", "ARETT", "ARHAT", "ARIAS", "ARIEL", "ARILS", "ARIOT", "ARISH", 
-    "ARLES", "ARNAS", "AROHA", "ARPAS", "ARPEN", "ARRAH", "ARRAS", "ARRET", "ARRIS", 
-    "ARSES", "ARSIS", "ARTAL", "ARTEL", "ARTIC", "ARTIS", "ASANA", "ASCON", "ASHES", 
-    "ASHET", "ASPEN", "ASPER", "ASPIC", "ASPIE", "ASPIS", "ASPRO", "ASSAI", "ASSES", 
-    "ASSOT", "ASTER", "ASTIR", "ATAPS", "ATILT", "ATLAS", "ATOCS", "ATRIA", "ATRIP", 
-    "ATTAP", "ATTAR", "CACAS", "CAECA", "CAESE", "CAINS", "CALLA", "CALLS", "CALOS", 
-    "CALPA", "CALPS", "CANEH", "CANER", "CANES", "CANNA", "CANNS", "CANSO", "CANST", 
-    "CANTO", "CANTS", "CAPAS", "CAPES", "CAPHS", "CAPLE", "CAPON", "CAPOS", "CAPOT", 
-    "CAPRI", "CARAP", "CARER", "CARES", "CARET", "CARLE", "CARLS", "CARNS", "CARON", 
-    "CARPI", "CARPS", "CARRS", "CARSE", "CARTA", "CARTE", "CARTS", "CASAS", "CASCO", 
-    "CASES", "CASTS", "CATES", "CECAL", "CEILI", "CEILS", "CELLA", "CELLI", "CELLS", 
-    "CELTS", "CENSE", "CENTO", "CENTS", "CEORL", "CEPES", "CERCI", "CERES", "CERIA", 
-    "CERIC", "CERNE", "CEROC", "CEROS", "CERTS", "CESSE", "CESTA", "CESTI", "CETES", 
-    "CHACE", "CHACO", "CHAIS", "CHALS", "CHANA", "CHAPE", "CHAPS", "CHAPT", "CHARA", 
-    "CHARE", "CHARR", "CHARS", "CHATS", "CHEEP", "CHELA", "CHELP", "CHERE", "CHERT", 
-    "CHETH", "CHIAO", "CHIAS", "CHICA", "CHICH", "CHICO", "CHICS", "CHIEL", "CHILE", 
-    "CHINE", "CHINO", "CHINS", "CHIPS", "CHIRL", "CHIRO", "CHIRR", "CHIRT", "CHITS", 
-    "CHOCO", "CHOCS", "CHOIL", "CHOLA", "CHOLI", "CHOLO", "CHONS", "CHOON", "CHOPS", 
-    "CHOTA", "CHOTT", "CIELS", "CILIA", "CILLS", "CINCT", "CINES", "CIONS", "CIPPI", 
-    "CIRCS", "CIRES", "CIRLS", "CIRRI", "CISCO", "CISTS", "CITAL", "CITER", "CITES", 
-    "CLACH", "CLAES", "CLANS", "CLAPS", "CLAPT", "CLARO", "CLART", "CLAST", "CLATS", 
-    "CLEEP", "CLEPE", "CLEPT", "CLIES", "CLINE", "CLINT", "CLIPE", "CLIPS", "CLIPT", 
-    "CLITS", "CLONS", "CLOOP", "CLOOT", "CLOPS", "CLOTE", "CLOTS", "COACT", "COALA", 
-    "COALS", "COAPT", "COATE", "COATI", "COATS", "COCAS", "COCCI", "COCCO", "COCOS", 
-    "COHEN", "COHOE", "COHOS", "COILS", "COINS", "COIRS", "COITS", "COLAS", "COLES", 
-    "COLIC", "COLIN", "COLLS", "COLTS", "CONES", "CONIA", "CONIN", "CONNE", "CONNS", 
-    "CONTE", "CONTO", "COOCH", "COOEE", "COOER", "COOLS", "COONS", "COOPS", "COOPT", 
-    "COOST", "COOTS", "COPAL", "COPEN", "COPER", "COPES", "COPRA", "CORES", "CORIA", 
-    "CORNI", "CORNO", "CORNS", "CORPS", "CORSE", "CORSO", "COSEC", "COSES", "COSET", 
-    "COSIE", "COSTA", "COSTE", "COSTS", "COTAN", "COTES", "COTHS", "COTTA", "COTTS", 
-    "CRAAL", "CRAIC", "CRANS", "CRAPE", "CRAPS", "CRARE", "CREEL", "CREES", "CRENA", 
-    "CREPS", "CRIAS", "CRIES", "CRINE", "CRIOS", "CRIPE", "CRIPS", "CRISE", "CRITH", 
-    "CRITS", "CROCI", "CROCS", "CRONS", "CROOL", "CROON", "CROPS", "CRORE", "CROST", 
-    "CTENE", "EALES", "EARLS", "EARNS", "EARNT", "EARST", "EASER", "EASES", "EASLE", 
-    "EASTS", "EATHE", "ECHES", "ECHOS", "EISEL", "ELAIN", "ELANS", "ELCHI", "ELINT", 
-    "ELOIN", "ELOPS", "ELPEE", "ELSIN", "ENATE", "ENIAC", "ENLIT", "ENOLS", "ENROL", 
-    "ENTIA", "EORLS", "EOSIN", "EPACT", "EPEES", "EPHAH", "EPHAS", "EPHOR", "EPICS", 
-    "EPOPT", "EPRIS", "ERICA", "ERICS", "ERNES", "EROSE", "ERSES", "ESCAR", "ESCOT", 
-    "ESILE", "ESNES", "ESSES", "ESTOC", "ESTOP", "ESTRO", "ETAPE", "ETATS", "ETENS", 
-    "ETHAL", "ETHNE", "ETICS", "ETNAS", "ETTIN", "ETTLE", "HAARS", "HAETS", "HAHAS", 
-    "HAILS", "HAINS", "HAINT", "HAIRS", "HAITH", "HALAL", "HALER", "HALES", "HALLO", 
-    "HALLS", "HALON", "HALOS", "HALSE", "HALTS", "HANAP", "HANCE", "HANCH", "HANSA", 
-    "HANSE", "HANTS", "HAOLE", "HAPPI", "HARES", "HARLS", "HARNS", "HAROS", "HARPS", 
-    "HARTS", "HASPS", "HASTA", "HATES", "HATHA", "HEALS", "HEAPS", "HEARE", "HEARS", 
-    "HEAST", "HEATS", "HECHT", "HEELS", "HEILS", "HEIRS", "HELES", "HELIO", "HELLS", 
-    "HELOS", "HELOT", "HELPS", "HENCH", "HENNA", "HENTS", "HEPAR", "HERES", "HERLS", 
-    "HERNS", "HEROS", "HERSE", "HESPS", "HESTS", "HETES", "HETHS", "HIANT", "HILAR", 
-    "HILCH", "HILLO", "HILLS", "HILTS", "HINTS", "HIOIS", "HIREE", "HIRER", "HIRES", 
-    "HISTS", "HITHE", "HOARS", "HOAST", "HOERS", "HOISE", "HOLES", "HOLLA", "HOLLO", 
-    "HOLON", "HOLOS", "HOLTS", "HONAN", "HONER", "HONES", "HOOCH", "HOONS", "HOOPS", 
-    "HOORS", "HOOSH", "HOOTS", "HOPER", "HOPES", "HORAH", "HORAL", "HORAS", "HORIS", 
-    "HORNS", "HORST", "HOSEL", "HOSEN", "HOSER", "HOSES", "HOSTA", "HOSTS", "HOTCH", 
-    "HOTEN", "ICERS", "ICHES", "ICHOR", "ICIER", "ICONS", "ICTAL", "ICTIC", "ILEAC", 
-    "ILEAL", "ILIAL", "ILLER", "ILLTH", "INAPT", "INCEL", "INCLE", "INION", "INNIT", 
-    "INSET", "INSPO", "INTEL", "INTIL", "INTIS", "INTRA", "IOTAS", "IPPON", "IRONE", 
-    "IRONS", "ISHES", "ISLES", "ISNAE", "ISSEI", "ISTLE", "ITHER", "LAARI", "LACER", 
-    "LACES", "LACET", "LAERS", "LAHAL", "LAHAR", "LAICH", "LAICS", "LAIRS", "LAITH", 
-    "LALLS", "LANAI", "LANAS", "LANCH", "LANES", "LANTS", "LAPIN", "LAPIS", "LARCH", 
-    "LAREE", "LARES", "LARIS", "LARNS", "LARNT", "LASER", "LASES", "LASSI", "LASTS", 
-    "LATAH", "LATEN", "LATHI", "LATHS", "LEANS", "LEAPS", "LEARE", "LEARS", "LEATS", 
-    "LEEAR", "LEEPS", "LEERS", "LEESE", "LEETS", "LEHRS", "LEIRS", "LEISH", "LENES", 
-    "LENIS", "LENOS", "LENSE", "LENTI", "LENTO", "LEONE", "LEPRA", "LEPTA", "LERES", 
-    "LERPS", "LESES", "LESTS", "LETCH", "LETHE", "LIANA", "LIANE", "LIARS", "LIART", 
-    "LICHI", "LICHT", "LICIT", "LIENS", "LIERS", "LILLS", "LILOS", "LILTS", "LINAC", 
-    "LINCH", "LINES", "LININ", "LINNS", "LINOS", "LINTS", "LIONS", "LIPAS", "LIPES", 
-    "LIPIN", "LIPOS", "LIRAS", "LIROT", "LISLE", "LISPS", "LISTS", "LITAI", "LITAS", 
-    "LITES", "LITHO", "LITHS", "LITRE", "LLANO", "LOACH", "LOANS", "LOAST", "LOCHE", 
-    "LOCHS", "LOCIE", "LOCIS", "LOCOS", "LOESS", "LOHAN", "LOINS", "LOIPE", "LOIRS", 
-    "LOLLS", "LONER", "LOOIE", "LOONS", "LOOPS", "LOOTS", "LOPER", "LOPES", "LORAL", 
-    "LORAN", "LOREL", "LORES", "LORIC", "LORIS", "LOSEL", "LOSEN", "LOSES", "LOTAH", 
-    "LOTAS", "LOTES", "LOTIC", "LOTOS", "LOTSA", "LOTTA", "LOTTE", "LOTTO", "NAANS", 
-    "NACHE", "NACHO", "NACRE", "NAHAL", "NAILS", "NAIRA", "NALAS", "NALLA", "NANAS", 
-    "NANCE", "NANNA", "NANOS", "NAPAS", "NAPES", "NAPOO", "NAPPA", "NAPPE", "NARAS", 
-    "NARCO", "NARCS", "NARES", "NARIC", "NARIS", "NARRE", "NASHI", "NATCH", "NATES", 
-    "NATIS", "NEALS", "NEAPS", "NEARS", "NEATH", "NEATS", "NEELE", "NEEPS", "NEESE", 
-    "NEIST", "NELIS", "NENES", "NEONS", "NEPER", "NEPIT", "NERAL", "NEROL", "NERTS", 
-    "NESTS", "NETES", "NETOP", "NETTS", "NICHT", "NICOL", "NIHIL", "NILLS", "NINER", 
-    "NINES", "NINON", "NIPAS", "NIRLS", "NISEI", "NISSE", "NITER", "NITES", "NITON", 
-    "NITRE", "NITRO", "NOAHS", "NOELS", "NOILS", "NOINT", "NOIRS", "NOLES", "NOLLS", 
-    "NOLOS", "NONAS", "NONCE", "NONES", "NONET", "NONIS", "NOOIT", "NOONS", "NOOPS", 
-    "NOPAL", "NORIA", "NORIS", "NOSER", "NOSES", "NOTAL", "NOTER", "NOTES", "OASES", 
-    "OASIS", "OASTS", "OATEN", "OATER", "OATHS", "OCHER", "OCHES", "OCHRE", "OCREA", 
-    "OCTAN", "OCTAS", "OHIAS", "OHONE", "OILER", "OINTS", "OLEIC", "OLEIN", "OLENT", 
-    "OLEOS", "OLIOS", "OLLAS", "OLLER", "OLLIE", "OLPAE", "OLPES", "ONCER", "ONCES", 
-    "ONCET", "ONERS", "ONTIC", "OONTS", "OORIE", "OOSES", "OPAHS", "OPALS", "OPENS", 
-    "OPEPE", "OPPOS", "OPSIN", "OPTER", "ORACH", "ORALS", "ORANT", "ORATE", "ORCAS", 
-    "ORCIN", "ORIEL", "ORLES", "ORLON", "ORLOP", "ORNIS", "ORPIN", "ORRIS", "ORTHO", 
-    "OSCAR", "OSHAC", "OSIER", "OSSIA", "OSTIA", "OTTAR", "OTTOS", "PAALS", "PAANS", 
-    "PACAS", "PACER", "PACES", "PACHA", "PACOS", "PACTA", "PACTS", "PAEAN", "PAEON", 
-    "PAILS", "PAINS", "PAIRE", "PAIRS", "PAISA", "PAISE", "PALAS", "PALEA", "PALES", 
-    "PALET", "PALIS", "PALLA", "PALLS", "PALPI", "PALPS", "PALSA", "PANCE", "PANES", 
-    "PANNE", "PANNI", "PANTO", "PANTS", "PAOLI", "PAOLO", "PAPAS", "PAPES", "PAPPI", 
-    "PARAE", "PARAS", "PARCH", "PAREN", "PAREO", "PARES", "PARIS", "PARLE", "PAROL", 
-    "PARPS", "PARRA", "PARRS", "PARTI", "PARTS", "PASEO", "PASES", "PASHA", "PASSE", 
-    "PASTS", "PATEN", "PATER", "PATES", "PATHS", "PATIN", "PATTE", "PEALS", "PEANS", 
-    "PEARE", "PEARS", "PEART", "PEASE", "PEATS", "PECHS", "PEECE", "PEELS", "PEENS", 
-    "PEEPE", "PEEPS", "PEERS", "PEINS", "PEISE", "PELAS", "PELES", "PELLS", "PELON", 
-    "PELTA", "PELTS", "PENES", "PENIE", "PENIS", "PENNA", "PENNI", "PENTS", "PEONS", 
-    "PEPLA", "PEPOS", "PEPSI", "PERAI", "PERCE", "PERCS", "PEREA", "PERES", "PERIS", 
-    "PERNS", "PERPS", "PERSE", "PERST", "PERTS", "PESOS", "PESTS", "PETAR", "PETER", 
-    "PETIT", "PETRE", "PETRI", "PETTI", "PETTO", "PHARE", "PHEER", "PHENE", "PHEON", 
-    "PHESE", "PHIAL", "PHISH", "PHOCA", "PHONO", "PHONS", "PHOTS", "PHPHT", "PIANI", 
-    "PIANS", "PICAL", "PICAS", "PICOT", "PICRA", "PIERS", "PIERT", "PIETA", "PIETS", 
-    "PILAE", "PILAO", "PILAR", "PILCH", "PILEA", "PILEI", "PILER", "PILES", "PILIS", 
-    "PILLS", "PINAS", "PINES", "PINNA", "PINON", "PINOT", "PINTA", "PINTS", "PIONS", 
-    "PIPAL", "PIPAS", "PIPES", "PIPET", "PIPIS", "PIPIT", "PIRAI", "PIRLS", "PIRNS", 
-    "PISCO", "PISES", "PISOS", "PISTE", "PITAS", "PITHS", "PITON", "PITOT", "PITTA", 
-    "PLAAS", "PLANS", "PLAPS", "PLASH", "PLAST", "PLATS", "PLATT", "PLEAS", "PLENA", 
-    "PLEON", "PLESH", "PLICA", "PLIES", "PLOAT", "PLOPS", "PLOTS", "POACH", "POEPS", 
-    "POETS", "POLER", "POLES", "POLIO", "POLIS", "POLLS", "POLOS", "POLTS", "PONCE", 
-    "PONES", "PONTS", "POOHS", "POOLS", "POONS", "POOPS", "POORI", "POORT", "POOTS", 
-    "POPES", "POPPA", "PORAE", "PORAL", "PORER", "PORES", "PORIN", "PORNO", "PORNS", 
-    "PORTA", "PORTS", "POSES", "POSHO", "POSTS", "POTAE", "POTCH", "POTES", "POTIN", 
-    "POTOO", "POTTO", "POTTS", "PRANA", "PRAOS", "PRASE", "PRATE", "PRATS", "PRATT", 
-    "PREES", "PRENT", "PREON", "PREOP", "PREPS", "PRESA", "PRESE", "PREST", "PRIAL", 
-    "PRIER", "PRIES", "PRILL", "PRION", "PRISE", "PRISS", "PROAS", "PROIN", "PROLE", 
-    "PROLL", "PROPS", "PRORE", "PROSO", "PROSS", "PROST", "PROTO", "PSION", "PSOAE", 
-    "PSOAI", "PSOAS", "PSORA", "RACES", "RACHE", "RACON", "RAIAS", "RAILE", "RAILS", 
-    "RAINE", "RAINS", "RAITA", "RAITS", "RALES", "RANAS", "RANCE", "RANEE", "RANIS", 
-    "RANTS", "RAPER", "RAPES", "RAPHE", "RAPPE", "RAREE", "RARES", "RASER", "RASES", 
-    "RASPS", "RASSE", "RASTA", "RATAL", "RATAN", "RATAS", "RATCH", "RATEL", "RATER", 
-    "RATES", "RATHA", "RATHE", "RATHS", "RATOO", "RATOS", "REAIS", "REALO", "REALS", 
-    "REANS", "REAPS", "REARS", "REAST", "REATA", "REATE", "RECAL", "RECCE", "RECCO", 
-    "RECIT", "RECON", "RECTA", "RECTI", "RECTO", "REECH", "REELS", "REENS", "REEST", 
-    "REINS", "REIST", "RELET", "RELIE", "RELIT", "RELLO", "RENIN", "RENNE", "RENOS", 
-    "RENTE", "RENTS", "REOIL", "REPIN", "REPLA", "REPOS", "REPOT", "REPPS", "REPRO", 
-    "RERAN", "RESAT", "RESEE", "RESES", "RESIT", "RESTO", "RESTS", "RETIA", "RETIE", 
-    "RHEAS", "RHIES", "RHINE", "RHONE", "RIALS", "RIANT", "RIATA", "RICER", "RICES", 
-    "RICHT", "RICIN", "RIELS", "RILES", "RILLE", "RILLS", "RINES", "RIOTS", "RIPES", 
-    "RIPPS", "RISES", "RISHI", "RISPS", "RITES", "RITTS", "ROANS", "ROARS", "ROATE", 
-    "ROHES", "ROILS", "ROINS", "ROIST", "ROLES", "ROLLS", "RONEO", "RONES", "RONIN", 
-    "RONNE", "RONTE", "RONTS", "ROONS", "ROOPS", "ROOSA", "ROOSE", "ROOTS", "ROPER", 
-    "ROPES", "RORAL", "RORES", "RORIC", "RORIE", "RORTS", "ROSES", "ROSET", "ROSHI", 
-    "ROSIN", "ROSIT", "ROSTI", "ROSTS", "ROTAL", "ROTAN", "ROTAS", "ROTCH", "ROTES", 
-    "ROTIS", "ROTLS", "ROTON", "ROTOS", "ROTTE", "SACRA", "SAICE", "SAICS", "SAILS", 
-    "SAINE", "SAINS", "SAIRS", "SAIST", "SAITH", "SALAL", "SALAT", "SALEP", "SALES", 
-    "SALET", "SALIC", "SALLE", "SALOL", "SALOP", "SALPA", "SALPS", "SALSE", "SALTO", 
-    "SALTS", "SANES", "SANSA", "SANTO", "SANTS", "SAOLA", "SAPAN", "SAPOR", "SARAN", 
-    "SAREE", "SARIN", "SARIS", "SAROS", "SASER", "SASIN", "SASSE", "SATAI", "SATES", 
-    "SATIS", "SCAIL", "SCALA", "SCALL", "SCANS", "SCAPA", "SCAPE", "SCAPI", "SCARP", 
-    "SCARS", "SCART", "SCATH", "SCATS", "SCATT", "SCEAT", "SCENA", "SCOOT", "SCOPA", 
-    "SCOPS", "SCOTS", "SCRAE", "SCRAN", "SCRAT", "SCRIP", "SEALS", "SEANS", "SEARE", 
-    "SEARS", "SEASE", "SEATS", "SECCO", "SECHS", "SECTS", "SEELS", "SEEPS", "SEERS", 
-    "SEHRI", "SEILS", "SEINE", "SEIRS", "SEISE", "SELAH", "SELES", "SELLA", "SELLE", 
-    "SELLS", "SENAS", "SENES", "SENNA", "SENOR", "SENSA", "SENSI", "SENTE", "SENTI", 
-    "SENTS", "SEPAL", "SEPIC", "SEPTA", "SEPTS", "SERAC", "SERAI", "SERAL", "SERER", 
-    "SERES", "SERIC", "SERIN", "SERON", "SERRA", "SERRE", "SERRS", "SESSA", "SETAE", 
-    "SETAL", "SETON", "SETTS", "SHAHS", "SHANS", "SHAPS", "SHARN", "SHASH", "SHCHI", 
-    "SHEAL", "SHEAS", "SHEEL", "SHENT", "SHEOL", "SHERE", "SHERO", "SHETS", "SHIAI", 
-    "SHIEL", "SHIER", "SHIES", "SHILL", "SHINS", "SHIPS", "SHIRR", "SHIRS", "SHISH", 
-    "SHISO", "SHIST", "SHITE", "SHITS", "SHLEP", "SHOAT", "SHOER", "SHOES", "SHOLA", 
-    "SHOOL", "SHOON", "SHOOS", "SHOPE", "SHOPS", "SHORL", "SHOTE", "SHOTS", "SHOTT", 
-    "SHRIS", "SIALS", "SICES", "SICHT", "SIENS", "SIENT", "SIETH", "SILEN", "SILER", 
-    "SILES", "SILLS", "SILOS", "SILTS", "SINES", "SINHS", "SIPES", "SIREE", "SIRES", 
-    "SIRIH", "SIRIS", "SIROC", "SIRRA", "SISAL", "SISES", "SISTA", "SISTS", "SITAR", 
-    "SITES", "SITHE", "SLAES", "SLANE", "SLAPS", "SLART", "SLATS", "SLEER", "SLIER", 
-    "SLIPE", "SLIPS", "SLIPT", "SLISH", "SLITS", "SLOAN", "SLOES", "SLOOT", "SLOPS", 
-    "SLOTS", "SNAPS", "SNARS", "SNASH", "SNATH", "SNEAP", "SNEES", "SNELL", "SNIES", 
-    "SNIPS", "SNIRT", "SNITS", "SNOEP", "SNOOL", "SNOOT", "SNOTS", "SOAPS", "SOARE", 
-    "SOARS", "SOCAS", "SOCES", "SOCLE", "SOILS", "SOLAH", "SOLAN", "SOLAS", "SOLEI", 
-    "SOLER", "SOLES", "SOLON", "SOLOS", "SONCE", "SONES", "SONNE", "SONSE", "SOOLE", 
-    "SOOLS", "SOOPS", "SOOTE", "SOOTS", "SOPHS", "SOPOR", "SOPRA", "SORAL", "SORAS", 
-    "SOREE", "SOREL", "SORER", "SORES", "SORNS", "SORRA", "SORTA", "SORTS", "SOTHS", 
-    "SOTOL", "SPAER", "SPAES", "SPAHI", "SPAIL", "SPAIN", "SPAIT", "SPALE", "SPALL", 
-    "SPALT", "SPANE", "SPANS", "SPARS", "SPART", "SPATE", "SPATS", "SPEAL", "SPEAN", 
-    "SPEAT", "SPECS", "SPECT", "SPEEL", "SPEER", "SPEIL", "SPEIR", "SPEOS", "SPETS", 
-    "SPIAL", "SPICA", "SPICS", "SPIER", "SPIES", "SPILE", "SPINA", "SPINS", "SPIRT", 
-    "SPITS", "SPOOR", "SPOOT", "SPOSH", "SPOTS", "SPRAT", "SPRIT", "STANE", "STAPH", 
-    "STAPS", "STARN", "STARR", "STARS", "STATS", "STEAN", "STEAR", "STEEN", "STEIL", 
-    "STELA", "STELE", "STELL", "STENO", "STENS", "STENT", "STEPS", "STEPT", "STERE", 
-    "STETS", "STICH", "STIES", "STILE", "STIPA", "STIPE", "STIRE", "STIRP", "STIRS", 
-    "STOAE", "STOAI", "STOAS", "STOAT", "STOEP", "STOIT", "STOLN", "STONN", "STOOR", 
-    "STOPE", "STOPS", "STOPT", "STOSS", "STOTS", "STOTT", "STRAE", "STREP", "STRIA", 
-    "STROP", "TAALS", "TAATA", "TACAN", "TACES", "TACET", "TACHE", "TACHO", "TACHS", 
-    "TACOS", "TACTS", "TAELS", "TAHAS", "TAHRS", "TAILS", "TAINS", "TAIRA", "TAISH", 
-    "TAITS", "TALAR", "TALAS", "TALCS", "TALEA", "TALER", "TALES", "TALLS", "TALPA", 
-    "TANAS", "TANHS", "TANNA", "TANTI", "TANTO", "TAPAS", "TAPEN", "TAPES", "TAPET", 
-    "TAPIS", "TAPPA", "TARAS", "TARES", "TARNS", "TAROC", "TAROS", "TARPS", "TARRE", 
-    "TARSI", "TARTS", "TASAR", "TASER", "TASES", "TASSA", "TASSE", "TASSO", "TATAR", 
-    "TATER", "TATES", "TATHS", "TATIE", "TATTS", "TEALS", "TEARS", "TEATS", "TECHS", 
-    "TECTA", "TEELS", "TEENE", "TEENS", "TEERS", "TEHRS", "TEILS", "TEINS", "TELAE", 
-    "TELCO", "TELES", "TELIA", "TELIC", "TELLS", "TELOI", "TELOS", "TENCH", "TENES", 
-    "TENIA", "TENNE", "TENNO", "TENON", "TENTS", "TEPAL", "TEPAS", "TERAI", "TERAS", 
-    "TERCE", "TERES", "TERNE", "TERNS", "TERTS", "TESLA", "TESTA", "TESTE", "TESTS", 
-    "TETES", "TETHS", "TETRA", "TETRI", "THALE", "THALI", "THANA", "THANE", "THANS", 
-    "THARS", "THECA", "THEES", "THEIC", "THEIN", "THENS", "THESP", "THETE", "THILL", 
-    "THINE", "THINS", "THIOL", "THIRL", "THOLE", "THOLI", "THORO", "THORP", "THRAE", 
-    "THRIP", "THROE", "TIANS", "TIARS", "TICAL", "TICCA", "TICES", "TIERS", "TILER", 
-    "TILES", "TILLS", "TILTH", "TILTS", "TINAS", "TINCT", "TINEA", "TINES", "TINTS", 
-    "TIPIS", "TIRES", "TIRLS", "TIROS", "TIRRS", "TITCH", "TITER", "TITIS", "TITRE", 
-    "TOCOS", "TOEAS", "TOHOS", "TOILE", "TOILS", "TOISE", "TOITS", "TOLAN", "TOLAR", 
-    "TOLAS", "TOLES", "TOLLS", "TOLTS", "TONER", "TONES", "TONNE", "TOOLS", "TOONS", 
-    "TOOTS", "TOPEE", "TOPER", "TOPES", "TOPHE", "TOPHI", "TOPHS", "TOPIS", "TOPOI", 
-    "TOPOS", "TORAH", "TORAN", "TORAS", "TORCS", "TORES", "TORIC", "TORII", "TOROS", 
-    "TOROT", "TORRS", "TORSE", "TORSI", "TORTA", "TORTE", "TORTS", "TOSAS", "TOSES", 
-    "TOTER", "TOTES", "TRANS", "TRANT", "TRAPE", "TRAPS", "TRAPT", "TRASS", "TRATS", 
-    "TRATT", "TREEN", "TREES", "TRESS", "TREST", "TRETS", "TRIAC", "TRIER", "TRIES", 
-    "TRILL", "TRINE", "TRINS", "TRIOL", "TRIOR", "TRIOS", "TRIPS", "TRIST", "TROAT", 
-    "TROIS", "TRONA", "TRONC", "TRONE", "TRONS", "TROTH", "TROTS", "TSARS", 
-#endif
+static const uint16_t _possible_dict[] = {
+    0x0544, 0x09B4, 0x104A, 0x1094, 0x110A, 0x129A, 0x12B0, 0x1309, 0x132A, 0x1377, 0x1464, 0x162A,
+    0x192A, 0x197A, 0x1B46, 0x1B76, 0x2140, 0x276A, 0x2942, 0x297A, 0x2A49, 0x3208, 0x326B, 0x346B,
+    0x4622, 0x4754, 0x4929, 0x496A, 0x49B3, 0x49BA, 0x4B13, 0x5008, 0x5062, 0x506A, 0x506B, 0x5080,
+    0x508A, 0x50B2, 0x517A, 0x521A, 0x5283, 0x540A, 0x5462, 0x54AB, 0x5522, 0x5525, 0x554A, 0x572A,
+    0x5730, 0x5746, 0x577A, 0x5B37, 0x5B7A, 0x6060, 0x60B0, 0x6137, 0x6152, 0x6176, 0x6209, 0x6252,
+    0x626B, 0x6452, 0x645A, 0x6476, 0x64A2, 0x650A, 0x6605, 0x660A, 0x660B, 0x670A, 0x6752, 0x6A02,
+    0x6B02, 0x6B09, 0x6B0A, 0x6B2A, 0x6B4A, 0x6B90, 0x6B92, 0x8012, 0x829A, 0x829B, 0x834A, 0x8406,
+    0x8475, 0x84A3, 0x8778, 0x879B, 0x8805, 0x8825, 0x8897, 0x892A, 0x8A2A, 0x8A4A, 0x8A7A, 0x8B29,
+    0x909A, 0x9134, 0x917A, 0x9202, 0x9205, 0x9209, 0x920A, 0x9210, 0x9241, 0x9262, 0x9280, 0x9292,
+    0x92B2, 0x92BA, 0x92BB, 0x930B, 0x940A, 0x9425, 0x945A, 0x947B, 0x94A3, 0x952A, 0x960A, 0x9730,
+    0x980A, 0x9826, 0x9903, 0x990A, 0x992B, 0x994A, 0x9A2A, 0x9A4A, 0x9B05, 0x9B25, 0x9B41, 0x9B4A,
+    0xA060, 0xA176, 0xA32A, 0xA32B, 0xA826, 0xA829, 0xA841, 0xA842, 0xA84A, 0xA897, 0xAA04, 0xAA2A,
+    0xAA7B, 0xAB29, 0xAB49, 0xB08A, 0xB45B, 0xB50A, 0xB71A, 0xB940, 0xB948, 0xBB08, 0xBB09, 0x010A,
+    0x0210, 0x02A2, 0x046A, 0x0550, 0x055A, 0x057A, 0x0580, 0x058A, 0x0623, 0x0629, 0x062A, 0x0660,
+    0x066A, 0x06A7, 0x06AB, 0x06B7, 0x06BA, 0x080A, 0x082A, 0x083A, 0x0852, 0x0876, 0x087A, 0x087B,
+    0x0894, 0x0908, 0x0929, 0x092A, 0x092B, 0x0952, 0x095A, 0x096A, 0x0976, 0x0984, 0x098A, 0x099A,
+    0x09A2, 0x09B0, 0x09B2, 0x09BA, 0x0A0A, 0x0A17, 0x0A2A, 0x0ABA, 0x0B2A, 0x2105, 0x2454, 0x245A,
+    0x2550, 0x2554, 0x255A, 0x25BA, 0x26A2, 0x26B7, 0x26BA, 0x2795, 0x282A, 0x2914, 0x292A, 0x2940,
+    0x2941, 0x2962, 0x2971, 0x297A, 0x29BA, 0x2AA2, 0x2AB0, 0x2AB4, 0x2B2A, 0x3012, 0x3017, 0x304A,
+    0x305A, 0x3060, 0x3082, 0x308A, 0x308B, 0x3090, 0x3092, 0x3099, 0x309A, 0x30BA, 0x3228, 0x3250,
+    0x3258, 0x3292, 0x329B, 0x32B3, 0x3407, 0x340A, 0x3410, 0x3413, 0x3417, 0x341A, 0x3425, 0x3452,
+    0x3462, 0x3467, 0x346A, 0x348A, 0x3495, 0x3497, 0x3499, 0x349B, 0x34BA, 0x3717, 0x371A, 0x3745,
+    0x3750, 0x3754, 0x3757, 0x376A, 0x3776, 0x378A, 0x37B0, 0x37BB, 0x425A, 0x4540, 0x455A, 0x461B,
+    0x462A, 0x476A, 0x4884, 0x491A, 0x492A, 0x495A, 0x4994, 0x4A17, 0x4ABA, 0x4B05, 0x4B29, 0x4B2A,
+    0x5013, 0x502A, 0x506A, 0x508A, 0x508B, 0x5097, 0x509B, 0x50AB, 0x50BA, 0x5228, 0x5282, 0x528B,
+    0x542A, 0x5462, 0x546B, 0x5482, 0x548A, 0x548B, 0x54BA, 0x576A, 0x5778, 0x577B, 0x578A, 0x57B2,
+    0x57BA, 0x701B, 0x7050, 0x705A, 0x708B, 0x70B2, 0x70B4, 0x70BA, 0x710A, 0x7114, 0x7117, 0x717A,
+    0x7326, 0x7372, 0x737A, 0x745A, 0x746A, 0x749A, 0x74BA, 0x750A, 0x752A, 0x7541, 0x7546, 0x755A,
+    0x75BA, 0x762A, 0x7640, 0x7646, 0x7662, 0x766A, 0x76B2, 0x76B7, 0x7713, 0x7722, 0x7729, 0x775A,
+    0x776A, 0x778A, 0x778B, 0x77AB, 0x77BA, 0x7805, 0x7826, 0x7829, 0x782A, 0x7890, 0x792A, 0x7940,
+    0x7964, 0x7967, 0x796A, 0x798A, 0x79A2, 0x79A7, 0x7A21, 0x7A2A, 0x7A2B, 0x7A42, 0x7AB0, 0x7AB2,
+    0x7ABA, 0x7B06, 0x7B2A, 0x7B3A, 0x7BB0, 0x7BBA, 0x9005, 0x9041, 0x906A, 0x9082, 0x908A, 0x9092,
+    0x9225, 0x922A, 0x9260, 0x928A, 0x940A, 0x942A, 0x9462, 0x947A, 0x9482, 0x948A, 0x94A2, 0x94B3,
+    0x94BA, 0x9714, 0x971A, 0x976A, 0x9775, 0x9776, 0x978A, 0x9792, 0x97AB, 0xB262, 0x052A, 0x095A,
+    0x096A, 0x096B, 0x09AB, 0x0A29, 0x0A2A, 0x0A52, 0x0ABA, 0x0B32, 0x132A, 0x137A, 0x4A25, 0x5046,
+    0x506A, 0x5134, 0x546B, 0x5746, 0x578A, 0x5822, 0x5A46, 0x60B2, 0x6401, 0x654B, 0x675A, 0x6975,
+    0x6B40, 0x795A, 0x7A46, 0x801B, 0x822A, 0x8303, 0x830A, 0x8379, 0x841A, 0x878B, 0x894A, 0x9410,
+    0x941A, 0x962A, 0x97A2, 0x9A2A, 0xA109, 0xA17B, 0xA452, 0xA62A, 0xAA2A, 0xAB71, 0xAB78, 0xAB97,
+    0xB082, 0xB0BA, 0xB26A, 0xB305, 0xB362, 0xB41A, 0xB60A, 0xBB46, 0xBB52, 0x009A, 0x02BA, 0x030A,
+    0x045A, 0x046A, 0x046B, 0x049A, 0x04B3, 0x0505, 0x0529, 0x052A, 0x0557, 0x055A, 0x0576, 0x057A,
+    0x05A2, 0x05BA, 0x0608, 0x0612, 0x0613, 0x06A0, 0x06A2, 0x06BA, 0x0752, 0x0884, 0x092A, 0x095A,
+    0x096A, 0x097A, 0x098A, 0x09BA, 0x0A8A, 0x0AB0, 0x0B2A, 0x0B30, 0x205A, 0x208A, 0x2092, 0x209A,
+    0x20AB, 0x20BA, 0x213B, 0x225A, 0x245A, 0x249A, 0x252A, 0x2547, 0x255A, 0x257A, 0x257B, 0x258A,
+    0x2613, 0x2660, 0x26BA, 0x2809, 0x292A, 0x295A, 0x296A, 0x297A, 0x29A2, 0x2A8A, 0x2ABA, 0x2B2A,
+    0x2B3A, 0x406B, 0x4509, 0x4513, 0x4557, 0x455A, 0x45BA, 0x46BA, 0x474A, 0x4922, 0x4929, 0x492A,
+    0x4ABA, 0x4B32, 0x709A, 0x70AB, 0x729A, 0x74A2, 0x752A, 0x7550, 0x7557, 0x7576, 0x757A, 0x75BA,
+    0x7606, 0x7629, 0x762A, 0x7713, 0x776A, 0x778A, 0x779A, 0x77A3, 0x77BA, 0x7829, 0x782A, 0x7903,
+    0x7905, 0x790A, 0x794A, 0x796A, 0x79AB, 0x7A25, 0x7A26, 0x7A29, 0x7A2A, 0x7AB0, 0x7ABA, 0x7B13,
+    0x7B26, 0x129A, 0x132A, 0x1379, 0x1429, 0x176A, 0x1B05, 0x1B41, 0x5201, 0x5205, 0x5405, 0x5529,
+    0x55B3, 0x608B, 0x6125, 0x6152, 0x6476, 0x664B, 0x6A2B, 0x6A87, 0x6B25, 0x6B45, 0x6B4A, 0x6B90,
+    0x7B0A, 0x8876, 0x9762, 0x976A, 0xA32A, 0xA52A, 0xA602, 0xAA24, 0xAB52, 0xB329, 0x0094, 0x0129,
+    0x012A, 0x012B, 0x029A, 0x0305, 0x0309, 0x0413, 0x041A, 0x049A, 0x04B3, 0x055A, 0x0604, 0x060A,
+    0x0613, 0x062A, 0x06BA, 0x0846, 0x084A, 0x0913, 0x0922, 0x092A, 0x094A, 0x096A, 0x096B, 0x0A29,
+    0x0A2A, 0x0AA4, 0x0ABA, 0x0B03, 0x0B26, 0x0B34, 0x0B3A, 0x206A, 0x208A, 0x2092, 0x209A, 0x20BA,
+    0x2209, 0x228A, 0x229A, 0x22A2, 0x22BA, 0x239A, 0x249A, 0x24A3, 0x262A, 0x264A, 0x267A, 0x26A2,
+    0x26B4, 0x26B7, 0x2762, 0x2890, 0x28B0, 0x292A, 0x298A, 0x2A2A, 0x2ABA, 0x2B13, 0x2B32, 0x4060,
+    0x4062, 0x409A, 0x409B, 0x4134, 0x413B, 0x414B, 0x426A, 0x429A, 0x455A, 0x457A, 0x45BA, 0x4601,
+    0x4613, 0x462A, 0x4646, 0x466A, 0x467A, 0x46BA, 0x476A, 0x480A, 0x482A, 0x4846, 0x487A, 0x490A,
+    0x497B, 0x4A52, 0x4A8A, 0x4ABA, 0x4B04, 0x4B0A, 0x4B2A, 0x4B37, 0x4B3A, 0x4B92, 0x5067, 0x7013,
+    0x706A, 0x70AB, 0x7132, 0x713A, 0x7142, 0x714A, 0x717A, 0x72AA, 0x7306, 0x746A, 0x7482, 0x749A,
+    0x755A, 0x7629, 0x7742, 0x776A, 0x778A, 0x77BA, 0x7829, 0x782A, 0x7905, 0x7906, 0x7925, 0x792A,
+    0x7941, 0x794A, 0x7A25, 0x7A26, 0x7A2A, 0x7B03, 0x7B0A, 0x7B2A, 0x7B41, 0x7B7A, 0x7BA0, 0x7BB0,
+    0x7BB2, 0x7BB7, 0x006A, 0x0132, 0x0137, 0x0192, 0x0305, 0x045A, 0x0490, 0x050A, 0x0550, 0x060A,
+    0x0612, 0x0660, 0x067A, 0x080A, 0x082A, 0x0877, 0x0880, 0x0882, 0x090A, 0x0917, 0x091A, 0x092A,
+    0x0941, 0x094A, 0x0992, 0x0A34, 0x0B13, 0x0B2A, 0x0B4A, 0x205A, 0x208A, 0x209A, 0x20B3, 0x20BA,
+    0x2252, 0x228A, 0x22A2, 0x24AB, 0x254A, 0x262A, 0x276A, 0x2829, 0x284B, 0x2905, 0x2975, 0x29BA,
+    0x2ABA, 0x2B2A, 0x2B78, 0x2BBA, 0x413B, 0x4175, 0x4345, 0x455A, 0x4629, 0x462A, 0x4676, 0x480A,
+    0x495A, 0x4A24, 0x4AA2, 0x4B29, 0x4B2A, 0x4B76, 0x4B92, 0x4B97, 0x703A, 0x725A, 0x745A, 0x746B,
+    0x749A, 0x752A, 0x755A, 0x757A, 0x760A, 0x7612, 0x762A, 0x762B, 0x764A, 0x774B, 0x776A, 0x778A,
+    0x7805, 0x7940, 0x794A, 0x7A29, 0x7A2A, 0x7B05, 0x7B29, 0x7B2A, 0x0A2A, 0x0A4A, 0x0ABA, 0x0B26,
+    0x0B29, 0x0B3A, 0x1329, 0x132A, 0x1392, 0x1920, 0x1B06, 0x1B0A, 0x340A, 0x3762, 0x4529, 0x46BA,
+    0x5241, 0x5246, 0x526B, 0x527A, 0x547A, 0x550A, 0x5529, 0x5542, 0x5802, 0x582A, 0x6129, 0x612A,
+    0x612B, 0x629A, 0x6B41, 0x76BA, 0x7942, 0x7A2A, 0x803A, 0x805A, 0x826A, 0x8282, 0x887A, 0x8A46,
+    0x8B29, 0x9013, 0x905A, 0x906B, 0x90B2, 0x910A, 0x9146, 0x9425, 0x952A, 0x9576, 0x9578, 0x964A,
+    0x9846, 0x994A, 0x9B37, 0xA109, 0xA301, 0xA429, 0xAA40, 0xAB40, 0xBB09, 0xBB7A, 0x005A, 0x006A,
+    0x010A, 0x0129, 0x012A, 0x0130, 0x017A, 0x01B0, 0x01BA, 0x0206, 0x0276, 0x045A, 0x046A, 0x0492,
+    0x049A, 0x04A0, 0x04A2, 0x050A, 0x0520, 0x052A, 0x052B, 0x054A, 0x0550, 0x055A, 0x0584, 0x058A,
+    0x05A0, 0x0612, 0x062A, 0x0662, 0x0664, 0x06B7, 0x06BA, 0x0754, 0x0757, 0x080A, 0x082A, 0x0884,
+    0x0902, 0x090A, 0x0913, 0x0926, 0x0927, 0x092A, 0x094A, 0x0952, 0x0975, 0x098A, 0x0990, 0x099A,
+    0x09B4, 0x09BA, 0x0A27, 0x0A2A, 0x0A30, 0x0AA2, 0x0ABA, 0x0B26, 0x0B29, 0x0B2A, 0x0B3A, 0x0B46,
+    0x0BB2, 0x205A, 0x206A, 0x2092, 0x209A, 0x209B, 0x20A2, 0x20BA, 0x213A, 0x2212, 0x225A, 0x226A,
+    0x2282, 0x228A, 0x229A, 0x246A, 0x24A2, 0x250A, 0x252A, 0x255A, 0x2576, 0x25B0, 0x25BA, 0x262A,
+    0x2642, 0x264A, 0x2660, 0x2664, 0x26BA, 0x276A, 0x2850, 0x287A, 0x28A4, 0x2904, 0x2912, 0x291A,
+    0x2920, 0x292A, 0x294A, 0x296A, 0x298A, 0x29A2, 0x29AB, 0x29BA, 0x2A7A, 0x2ABA, 0x2B09, 0x2B29,
+    0x2B4B, 0x2B92, 0x2B94, 0x2BB4, 0x2BB7, 0x3092, 0x3229, 0x3262, 0x3276, 0x32A2, 0x3405, 0x34A3,
+    0x3710, 0x3767, 0x376A, 0x37BA, 0x383B, 0x4064, 0x406A, 0x4105, 0x410A, 0x417B, 0x4190, 0x429A,
+    0x429B, 0x42B0, 0x42BA, 0x4502, 0x4507, 0x4509, 0x4513, 0x4520, 0x4524, 0x4529, 0x452A, 0x454A,
+    0x455A, 0x460A, 0x462A, 0x4660, 0x4676, 0x467B, 0x46B0, 0x46BA, 0x476A, 0x4805, 0x480A, 0x482A,
+    0x482B, 0x484A, 0x484B, 0x4904, 0x495A, 0x496A, 0x4A17, 0x4A2A, 0x4A7A, 0x4AB2, 0x4B0A, 0x4B3A,
+    0x4B76, 0x4B7B, 0x4BB0, 0x500A, 0x506A, 0x508A, 0x50A3, 0x50AB, 0x50BA, 0x50BB, 0x520A, 0x5260,
+    0x5276, 0x52A3, 0x5410, 0x542A, 0x570B, 0x578A, 0x57BA, 0x7013, 0x728A, 0x72BA, 0x7529, 0x752A,
+    0x7547, 0x754A, 0x755A, 0x757A, 0x75BA, 0x7612, 0x762A, 0x76BA, 0x773A, 0x775A, 0x776A, 0x778A,
+    0x7794, 0x779B, 0x77BA, 0x782A, 0x7880, 0x7902, 0x7905, 0x7929, 0x792A, 0x7946, 0x7967, 0x796A,
+    0x79B0, 0x79BA, 0x7A2A, 0x7A37, 0x7ABA, 0x7B02, 0x7B13, 0x7B2A, 0x7B46, 0x7B77, 0x7BB7, 0x7BBA,
+    0x9060, 0x907A, 0x90A2, 0x90B2, 0x90BA, 0x90BB, 0x922A, 0x926B, 0x9276, 0x9278, 0x928A, 0x92A0,
+    0x92A2, 0x92AB, 0x9405, 0x9429, 0x942A, 0x9455, 0x9476, 0x94A2, 0x94AA, 0x970A, 0x9746, 0x9752,
+    0x9755, 0x978A, 0x9792, 0x97A7, 0x97AA, 0x97AB, 0x97B7, 0xA476, 0xA702, 0xA704, 0xA70A, 0xA790,
+    0x012A, 0x0132, 0x0176, 0x040A, 0x0452, 0x045A, 0x0462, 0x046A, 0x04B0, 0x04BA, 0x052A, 0x060A,
+    0x0612, 0x0622, 0x064A, 0x06BA, 0x0829, 0x082A, 0x0832, 0x0882, 0x0922, 0x092A, 0x0A29, 0x0A2A,
+    0x0A8A, 0x0AA2, 0x0AB0, 0x0B05, 0x0B06, 0x0B0A, 0x0B13, 0x0B25, 0x0B29, 0x0B2A, 0x0B30, 0x0B32,
+    0x0B3A, 0x0B77, 0x0B7A, 0x204A, 0x2057, 0x205A, 0x206A, 0x208A, 0x209A, 0x20AB, 0x20B0, 0x20B2,
+    0x2105, 0x2112, 0x2117, 0x214B, 0x2176, 0x21B0, 0x21B4, 0x21B7, 0x2213, 0x225A, 0x226A, 0x22AB,
+    0x246A, 0x24AB, 0x252B, 0x2542, 0x254B, 0x2557, 0x2646, 0x2662, 0x267A, 0x26B2, 0x26BA, 0x2745,
+    0x2846, 0x2850, 0x287A, 0x287B, 0x288A, 0x2897, 0x2906, 0x2A0B, 0x2A22, 0x2A2A, 0x2A4B, 0x2AB7,
+    0x2ABA, 0x2B40, 0x2B42, 0x320A, 0x342A, 0x3462, 0x3762, 0x405A, 0x406B, 0x40B0, 0x4129, 0x412A,
+    0x413B, 0x4146, 0x425A, 0x452A, 0x4552, 0x455A, 0x462A, 0x47BA, 0x482A, 0x488A, 0x4A2A, 0x4A34,
+    0x4A8A, 0x4B2A, 0x4BBA, 0x706A, 0x709A, 0x70B2, 0x732A, 0x745A, 0x746A, 0x74AB, 0x752A, 0x755A,
+    0x7627, 0x762A, 0x7646, 0x7662, 0x76B2, 0x76BA, 0x776A, 0x778A, 0x77A0, 0x77A2, 0x77BA, 0x7829,
+    0x782A, 0x7905, 0x792A, 0x7941, 0x7942, 0x79BA, 0x7A2A, 0x7A2B, 0x7A34, 0x7A46, 0x7A4B, 0x7AB4,
+    0x7ABA, 0x7B05, 0x7B06, 0x7B0A, 0x7B13, 0x7B2A, 0x7B4A, 0x7B5A, 0x7B76, 0x7B7A, 0x7BB2, 0x0190,
+    0x0412, 0x041A, 0x045A, 0x0462, 0x046A, 0x049A, 0x04AB, 0x04B3, 0x0505, 0x050B, 0x0528, 0x052A,
+    0x052B, 0x0541, 0x0552, 0x0575, 0x0578, 0x0580, 0x058A, 0x05A2, 0x05B7, 0x05BA, 0x062A, 0x06A0,
+    0x06B7, 0x06BA, 0x0750, 0x0806, 0x0879, 0x0906, 0x0922, 0x0946, 0x094A, 0x097A, 0x0A29, 0x0A46,
+    0x0AA2, 0x0B04, 0x0B2A, 0x0B4A, 0x1045, 0x1050, 0x1055, 0x106A, 0x1080, 0x1082, 0x1084, 0x1098,
+    0x109A, 0x109B, 0x10B3, 0x10BA, 0x10BB, 0x120B, 0x1260, 0x177B, 0x1780, 0x178A, 0x17BA, 0x1902,
+    0x1906, 0x190B, 0x1948, 0x205A, 0x206A, 0x2092, 0x209A, 0x20A2, 0x20BA, 0x2117, 0x213A, 0x21BA,
+    0x225A, 0x228A, 0x229A, 0x2394, 0x245A, 0x2462, 0x249A, 0x24A2, 0x2503, 0x252A, 0x2550, 0x2552,
+    0x255A, 0x260A, 0x262A, 0x2660, 0x2679, 0x26A0, 0x26A4, 0x26B2, 0x26B4, 0x26BA, 0x2805, 0x2841,
+    0x28B0, 0x28BA, 0x2901, 0x2904, 0x2905, 0x2929, 0x292A, 0x2941, 0x2946, 0x2976, 0x2990, 0x2992,
+    0x299A, 0x2AA0, 0x2B02, 0x2B05, 0x2B76, 0x2BBA, 0x303A, 0x306A, 0x308A, 0x3096, 0x30A3, 0x3134,
+    0x3205, 0x320A, 0x3225, 0x326B, 0x3275, 0x3292, 0x3297, 0x32BA, 0x3404, 0x3425, 0x3429, 0x342A,
+    0x3455, 0x346A, 0x348A, 0x3499, 0x349A, 0x34A3, 0x34A7, 0x34AB, 0x34B2, 0x34BA, 0x3528, 0x370B,
+    0x3729, 0x372A, 0x3750, 0x3775, 0x3776, 0x377A, 0x3782, 0x378A, 0x3795, 0x37B2, 0x37BA, 0x37BB,
+    0x394A, 0x405A, 0x412A, 0x413B, 0x426A, 0x426B, 0x42B3, 0x4526, 0x4529, 0x452A, 0x455A, 0x457A,
+    0x45BA, 0x462A, 0x463A, 0x482A, 0x4922, 0x492A, 0x4943, 0x494A, 0x4971, 0x4990, 0x4A05, 0x4A2A,
+    0x4AB0, 0x4ABA, 0x4B09, 0x4B2A, 0x4B32, 0x502A, 0x5062, 0x508A, 0x509B, 0x50BA, 0x5229, 0x5429,
+    0x5482, 0x548A, 0x548B, 0x54A3, 0x54BA, 0x5706, 0x572A, 0x577B, 0x578A, 0x57BA, 0x608A, 0x609A,
+    0x60A3, 0x60B3, 0x6208, 0x622A, 0x6255, 0x642A, 0x648A, 0x649B, 0x64BA, 0x6728, 0x6775, 0x677B,
+    0x67BA, 0x708A, 0x7092, 0x709A, 0x710A, 0x712A, 0x7152, 0x745A, 0x7503, 0x7506, 0x750A, 0x7524,
+    0x7529, 0x752A, 0x7576, 0x757A, 0x7612, 0x762A, 0x7662, 0x76A2, 0x7752, 0x775A, 0x778A, 0x77B2,
+    0x77BA, 0x783A, 0x7879, 0x7890, 0x7905, 0x790A, 0x7922, 0x7925, 0x7929, 0x792A, 0x796A, 0x7990,
+    0x79B0, 0x79BA, 0x7B3A, 0x7B75, 0x8029, 0x802A, 0x8034, 0x8045, 0x8046, 0x804B, 0x8052, 0x8055,
+    0x805B, 0x8062, 0x806A, 0x809A, 0x809B, 0x80B2, 0x80BA, 0x8205, 0x8206, 0x820B, 0x821A, 0x821B,
+    0x8225, 0x8229, 0x8245, 0x8249, 0x827A, 0x82BA, 0x8405, 0x8410, 0x841A, 0x8429, 0x842A, 0x8452,
+    0x8460, 0x846A, 0x849B, 0x84BA, 0x8779, 0x877B, 0x87A3, 0x87BA, 0x890B, 0x894B, 0xB062, 0xB083,
+    0xB08A, 0xB096, 0xB099, 0xB09A, 0xB0BA, 0xB206, 0xB209, 0xB226, 0xB245, 0xB250, 0xB252, 0xB255,
+    0xB267, 0xB26A, 0xB26B, 0xB28A, 0xB28B, 0xB292, 0xB2BA, 0xB413, 0xB42A, 0xB452, 0xB480, 0xB482,
+    0xB492, 0xB498, 0xB49A, 0xB702, 0xB704, 0xB70A, 0xB70B, 0xB728, 0xB74B, 0xB756, 0xB766, 0xB779,
+    0xB782, 0xB78A, 0xB78B, 0xB7AA, 0xB7BA, 0xB7BB, 0xB902, 0xB928, 0xB940, 0xB978, 0x005A, 0x00B0,
+    0x0106, 0x012A, 0x012B, 0x0132, 0x0137, 0x013A, 0x017A, 0x01BA, 0x025A, 0x030A, 0x039A, 0x045A,
+    0x046A, 0x0490, 0x04A3, 0x04BA, 0x0509, 0x050A, 0x051A, 0x0520, 0x0529, 0x052A, 0x055A, 0x0580,
+    0x060A, 0x063A, 0x0660, 0x06B4, 0x06B7, 0x080A, 0x0826, 0x082A, 0x082B, 0x084A, 0x0880, 0x090A,
+    0x092A, 0x096A, 0x0971, 0x097A, 0x098A, 0x0992, 0x09A4, 0x09BA, 0x0A09, 0x0A29, 0x0A2A, 0x0AA0,
+    0x0AA2, 0x0AA7, 0x0B09, 0x0B29, 0x0B2A, 0x0B3A, 0x0B42, 0x0BBA, 0x205A, 0x209A, 0x20BA, 0x213A,
+    0x21B0, 0x225A, 0x2262, 0x226A, 0x229A, 0x239A, 0x245A, 0x246A, 0x2502, 0x2517, 0x252A, 0x2540,
+    0x2541, 0x255A, 0x2574, 0x257A, 0x2613, 0x262A, 0x2640, 0x2662, 0x2667, 0x2676, 0x26BA, 0x2805,
+    0x280A, 0x2904, 0x290A, 0x2912, 0x292A, 0x2962, 0x296A, 0x29BA, 0x2A50, 0x2AB0, 0x2AB2, 0x2ABA,
+    0x2B2A, 0x2B3A, 0x2B90, 0x2B94, 0x3052, 0x3054, 0x3060, 0x3062, 0x306A, 0x309A, 0x3210, 0x322A,
+    0x3241, 0x3246, 0x326A, 0x32A8, 0x32B2, 0x3455, 0x3462, 0x346A, 0x3475, 0x3495, 0x3752, 0x3754,
+    0x3797, 0x3798, 0x3902, 0x3948, 0x3972, 0x406A, 0x409A, 0x4105, 0x4110, 0x412A, 0x429A, 0x4529,
+    0x452A, 0x455A, 0x45B3, 0x45BA, 0x460A, 0x461B, 0x4620, 0x462A, 0x46BA, 0x484A, 0x492A, 0x495A,
+    0x497A, 0x499A, 0x4B13, 0x4B29, 0x4B4A, 0x4B92, 0x717A, 0x720A, 0x737A, 0x7452, 0x745A, 0x74A2,
+    0x74BA, 0x7506, 0x7509, 0x750A, 0x752A, 0x755A, 0x75BA, 0x7629, 0x762A, 0x7662, 0x775A, 0x776A,
+    0x77BA, 0x7822, 0x7829, 0x782A, 0x7832, 0x7834, 0x783A, 0x784A, 0x7874, 0x787A, 0x7903, 0x7906,
+    0x790A, 0x791A, 0x792A, 0x7941, 0x7944, 0x797A, 0x797B, 0x799A, 0x79A2, 0x79A4, 0x79B0, 0x79B2,
+    0x79BA, 0x7A0A, 0x7A2A, 0x7B29, 0x7B2A, 0x906A, 0x906B, 0x9082, 0x908A, 0x908B, 0x90AA, 0x90BA,
+    0x90BB, 0x9226, 0x922A, 0x92AA, 0x92AB, 0x92BA, 0x9401, 0x9429, 0x942A, 0x9455, 0x9462, 0x946A,
+    0x9475, 0x9479, 0x947A, 0x948A, 0x94AB, 0x970B, 0x974A, 0x9760, 0x9761, 0x9762, 0x976A, 0x97B3,
+    0x97BA, 0xA09A,
 };
+static const uint16_t _possible_dict_start[] = {
+    0, 155, 406, 465, 577, 610, 746, 836, 898, 1164, 1319, 1666, 1898,
+};
+#endif
 
 #if (WORDLE_USE_RANDOM_GUESS == 3)
 static const uint16_t _num_random_guess_words = 13;  // The valid_words array begins with this many words that are considered the top 3% best options.
 #elif (WORDLE_USE_RANDOM_GUESS == 2)
 static const uint16_t _num_random_guess_words = 257;  // The valid_words array begins with this many words where each letter is different.
 #elif (WORDLE_USE_RANDOM_GUESS == 1)
-static const uint16_t _num_random_guess_words = _num_words;
+static const uint16_t _num_random_guess_words = sizeof(_valid_words) / sizeof(_valid_words[0]);
 #endif
 
-#endif // WORDLE_FACE_DICT_H_
\ No newline at end of file
+#endif // WORDLE_FACE_DICT_H_
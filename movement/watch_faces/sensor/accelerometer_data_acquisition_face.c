@@ -34,6 +34,15 @@
 #define ACCELEROMETER_FILTER LIS2DW_BANDWIDTH_FILTER_DIV2
 #define ACCELEROMETER_LOW_NOISE true
 #define SECONDS_TO_RECORD 15
+// at 25 Hz, one batch per second; each sample is 4 centiseconds after the last.
+#define ACCELEROMETER_FIFO_THRESHOLD 25
+#define ACCELEROMETER_CENTISECONDS_PER_SAMPLE 4
+
+// batches drained from the FIFO in the INT1 interrupt, waiting to be logged on the next tick. the interrupt
+// only writes the batch at _batches_written, and the tick only reads the one at _batches_read.
+static lis2dw_fifo_t _batches[2];
+static volatile uint8_t _batches_written;
+static volatile uint8_t _batches_read;
 
 static const char activity_types[][3] = {
     "TE",   // Testing
@@ -59,11 +68,10 @@ static void advance_current_setting(accelerometer_data_acquisition_state_t *stat
 static void start_reading(accelerometer_data_acquisition_state_t *state, movement_settings_t *settings);
 static void continue_reading(accelerometer_data_acquisition_state_t *state);
 static void finish_reading(accelerometer_data_acquisition_state_t *state);
-static bool wait_for_flash_ready(void);
 static int16_t get_next_available_page(void);
 static void write_buffer_to_page(uint8_t *buf, uint16_t page);
 static void write_page(accelerometer_data_acquisition_state_t *state);
-static void log_data_point(accelerometer_data_acquisition_state_t *state, lis2dw_reading_t reading, uint8_t centiseconds);
+static void log_data_point(accelerometer_data_acquisition_state_t *state, lis2dw_reading_t reading);
 
 void accelerometer_data_acquisition_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
@@ -77,16 +85,16 @@ void accelerometer_data_acquisition_face_setup(movement_settings_t *settings, ui
         state->countdown_length = 3;
     }
     spi_flash_init();
-    wait_for_flash_ready();
+    spi_flash_wait_until_ready();
     uint8_t buf[256] = {0xFF};
     spi_flash_read_data(0, buf, 256);
     if (buf[0] & 0xF0) {
         // mark first four pages as used
         buf[0] = 0x0F;
-        wait_for_flash_ready();
+        spi_flash_wait_until_ready();
         watch_set_pin_level(A3, false);
         spi_flash_command(CMD_ENABLE_WRITE);
-        wait_for_flash_ready();
+        spi_flash_wait_until_ready();
         spi_flash_write_data(0, buf, 256);
     }
 
@@ -334,7 +342,7 @@ static int16_t get_next_available_page(void) {
 
     uint16_t page = 0;
     for(int16_t i = 0; i < 4; i++) {
-        wait_for_flash_ready();
+        spi_flash_wait_until_ready();
         spi_flash_read_data(i * 256, buf, 256);
         for(int16_t j = 0; j < 256; j++) {
             if(buf[j] == 0) {
@@ -354,18 +362,18 @@ static int16_t get_next_available_page(void) {
 static void write_buffer_to_page(uint8_t *buf, uint16_t page) {
     uint32_t address = 256 * page;
 
-    wait_for_flash_ready();
+    spi_flash_wait_until_ready();
     watch_set_pin_level(A3, false);
     spi_flash_command(CMD_ENABLE_WRITE);
-    wait_for_flash_ready();
+    spi_flash_wait_until_ready();
     watch_set_pin_level(A3, false);
     spi_flash_write_data(address, buf, 256);
-    wait_for_flash_ready();
+    spi_flash_wait_until_ready();
 
     uint8_t buf2[256];
     watch_set_pin_level(A3, false);
     spi_flash_read_data(address, buf2, 256);
-    wait_for_flash_ready();
+    spi_flash_wait_until_ready();
 
     uint8_t used_pages[256] = {0xFF};
     uint16_t address_to_mark_used = page / 8;
@@ -385,35 +393,23 @@ static void write_buffer_to_page(uint8_t *buf, uint16_t page) {
     used_pages[offset_in_buf] = used_byte;
     watch_set_pin_level(A3, false);
     spi_flash_command(CMD_ENABLE_WRITE);
-    wait_for_flash_ready();
+    spi_flash_wait_until_ready();
     watch_set_pin_level(A3, false);
     spi_flash_write_data(header_page * 256, used_pages, 256);
-    wait_for_flash_ready();
-}
-
-static bool wait_for_flash_ready(void) {
-    watch_set_pin_level(A3, false);
-    bool ok = true;
-    uint8_t read_status_response[1] = {0x00};
-    do {
-        ok = spi_flash_read_command(CMD_READ_STATUS, read_status_response, 1);
-    } while ((read_status_response[0] & 0x3) != 0);
-    delay_ms(1); // why do i need this?
-    watch_set_pin_level(A3, true);
-    return ok;
+    spi_flash_wait_until_ready();
 }
 
 static void write_page(accelerometer_data_acquisition_state_t *state) {
     if (state->next_available_page > 0) {
         write_buffer_to_page((uint8_t *)(state->records), state->next_available_page);
-        wait_for_flash_ready();
+        spi_flash_wait_until_ready();
         state->next_available_page++;
     }
     state->pos = 0;
     memset(state->records, 0xFF, sizeof(state->records));
 }
 
-static void log_data_point(accelerometer_data_acquisition_state_t *state, lis2dw_reading_t reading, uint8_t centiseconds) {
+static void log_data_point(accelerometer_data_acquisition_state_t *state, lis2dw_reading_t reading) {
     accelerometer_data_acquisition_record_t record;
     record.data.x.record_type = ACCELEROMETER_DATA_ACQUISITION_DATA;
     record.data.y.lpmode = ACCELEROMETER_LPMODE;
@@ -421,7 +417,7 @@ static void log_data_point(accelerometer_data_acquisition_state_t *state, lis2dw
     record.data.x.accel = (reading.x >> 2) + 8192;
     record.data.y.accel = (reading.y >> 2) + 8192;
     record.data.z.accel = (reading.z >> 2) + 8192;
-    record.data.counter = 100 * (SECONDS_TO_RECORD - state->reading_ticks + 1) + centiseconds;
+    record.data.counter = state->samples_logged * ACCELEROMETER_CENTISECONDS_PER_SAMPLE;
     printf("logged data point for %d\n", record.data.counter);
     state->records[state->pos++] = record;
     if (state->pos >= 32) {
@@ -429,16 +425,41 @@ static void log_data_point(accelerometer_data_acquisition_state_t *state, lis2dw
     }
 }
 
+static void fifo_threshold_interrupt(void) {
+    if ((uint8_t)(_batches_written - _batches_read) < 2) {
+        lis2dw_read_fifo(&_batches[_batches_written % 2]);
+        _batches_written++;
+    } else {
+        // the tick has fallen behind; drop this batch so INT1 can fall and rise again.
+        lis2dw_fifo_t fifo;
+        lis2dw_read_fifo(&fifo);
+    }
+}
+
+static void log_batches(accelerometer_data_acquisition_state_t *state) {
+    while (_batches_read != _batches_written) {
+        lis2dw_fifo_t *fifo = &_batches[_batches_read % 2];
+        for(int i = 0; i < fifo->count; i++) {
+            state->samples_logged++;
+            log_data_point(state, fifo->readings[i]);
+        }
+        _batches_read++;
+    }
+}
+
 static void start_reading(accelerometer_data_acquisition_state_t *state, movement_settings_t *settings) {
     printf("Start reading\n");
     watch_enable_i2c();
     lis2dw_begin();
-    lis2dw_set_data_rate(LIS2DW_DATA_RATE_25_HZ);
-    lis2dw_set_range(ACCELEROMETER_RANGE);
-    lis2dw_set_low_power_mode(ACCELEROMETER_LPMODE);
-    lis2dw_set_bandwidth_filtering(ACCELEROMETER_FILTER);
-    if (ACCELEROMETER_LOW_NOISE) lis2dw_set_low_noise_mode(true);
-    lis2dw_enable_fifo();
+    lis2dw_configure(&(lis2dw_configuration_t) {
+        .data_rate = LIS2DW_DATA_RATE_25_HZ,
+        .mode = LIS2DW_MODE_LOW_POWER,
+        .low_power_mode = ACCELEROMETER_LPMODE,
+        .bandwidth_filtering = ACCELEROMETER_FILTER,
+        .range = ACCELEROMETER_RANGE,
+        .filter = LIS2DW_FILTER_LOW_PASS,
+        .low_noise = ACCELEROMETER_LOW_NOISE,
+    });
 
     accelerometer_data_acquisition_record_t record;
     watch_date_time date_time = watch_rtc_get_date_time();
@@ -451,26 +472,25 @@ static void start_reading(accelerometer_data_acquisition_state_t *state, movemen
     record.header.timestamp = state->starting_timestamp;
 
     state->records[state->pos++] = record;
-    lis2dw_fifo_t fifo;
-    lis2dw_read_fifo(&fifo); // dump the fifo, this starts a fresh round of data in continue_reading
+
+    // the sensor was just reset, so the FIFO starts out empty; from here, every sample is 40 ms after the last.
+    state->samples_logged = 0;
+    _batches_written = 0;
+    _batches_read = 0;
+    watch_register_interrupt_callback(A4, fifo_threshold_interrupt, INTERRUPT_TRIGGER_RISING);
+    lis2dw_enable_fifo_threshold_int1(ACCELEROMETER_FIFO_THRESHOLD);
 }
 
 static void continue_reading(accelerometer_data_acquisition_state_t *state) {
     printf("Continue reading\n");
-    lis2dw_fifo_t fifo;
-    lis2dw_read_fifo(&fifo);
-
-    fifo.count = min(fifo.count, 25); // hacky, but we need a consistent data rate; if we got a 26th data point, chuck it.
-    uint8_t offset = 4 * (25 - fifo.count); // also hacky: we're sometimes short at the start. align to beginning of next second.
-    // TODO: use the threshold interrupt for this, will mean we get consistent 25 Hz data as the accelerometer sees it.
-
-    for(int i = 0; i < fifo.count; i++) {
-        log_data_point(state, fifo.readings[i], i * 4 + offset);
-    }
+    log_batches(state);
 }
 
 static void finish_reading(accelerometer_data_acquisition_state_t *state) {
     printf("Finish reading\n");
+    watch_register_interrupt_callback(A4, NULL, INTERRUPT_TRIGGER_RISING);
+    log_batches(state);
+    lis2dw_disable_fifo_threshold_int1();
     if (state->pos != 0) {
         write_page(state);
     }
@@ -99,6 +99,7 @@ typedef struct {
     uint32_t starting_timestamp;
     accelerometer_data_acquisition_record_t records[32];
     uint16_t pos;
+    uint16_t samples_logged;
 } accelerometer_data_acquisition_state_t;
 
 void accelerometer_data_acquisition_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -0,0 +1,168 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "activity_face.h"
+#include "lis2dw.h"
+#include "filesystem.h"
+#include "watch.h"
+#include "watch_utility.h"
+
+#define ACTIVITY_FACE_FILENAME "activity.dat"
+
+// the FIFO interrupt has no context pointer, so it finds the state here.
+static activity_face_state_t *_state;
+
+static void _activity_face_fifo_threshold(void) {
+    lis2dw_fifo_t fifo;
+
+    lis2dw_read_fifo(&fifo);
+    activity_process(&_state->activity, fifo.readings, fifo.count);
+}
+
+static uint32_t _activity_face_minutes_today(activity_face_state_t *state, activity_type_t activity) {
+    return (state->activity.samples[activity] - state->day_start_samples[activity]) / (ACTIVITY_FACE_SAMPLE_RATE * 60);
+}
+
+static void _activity_face_update_display(activity_face_state_t *state) {
+    char buf[11];
+
+    watch_clear_indicator(WATCH_INDICATOR_LAP);
+    if (!state->sensor_found) {
+        watch_display_string("ST    ----", 0);
+    } else if (state->page == 0) {
+        sprintf(buf, "ST  %6lu", state->activity.steps - state->day_start_steps);
+        watch_display_string(buf, 0);
+    } else {
+        activity_type_t activity = state->page - 1;
+        sprintf(buf, "%s  %6lu", activity_type_codes[activity], _activity_face_minutes_today(state, activity));
+        watch_display_string(buf, 0);
+        if (state->activity.current == activity) watch_set_indicator(WATCH_INDICATOR_LAP);
+    }
+}
+
+static void _activity_face_end_day(activity_face_state_t *state) {
+    activity_face_summary_t summary;
+    // it's just past midnight, so the day that ended was yesterday.
+    watch_date_time date_time = watch_utility_date_time_from_unix_time(watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0) - 86400, 0);
+    uint32_t steps = state->activity.steps;
+
+    memset(&summary, 0, sizeof(summary));
+    summary.year = date_time.unit.year;
+    summary.month = date_time.unit.month;
+    summary.day = date_time.unit.day;
+    summary.steps = steps - state->day_start_steps;
+    state->day_start_steps = steps;
+    for(uint8_t i = 0; i < ACTIVITY_NUM_TYPES; i++) {
+        uint32_t samples = state->activity.samples[i];
+        summary.minutes[i] = (samples - state->day_start_samples[i]) / (ACTIVITY_FACE_SAMPLE_RATE * 60);
+        state->day_start_samples[i] = samples;
+    }
+
+    filesystem_append_file(ACTIVITY_FACE_FILENAME, (char *)&summary, sizeof(summary));
+}
+
+void activity_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
+    (void) watch_face_index;
+    if (*context_ptr == NULL) {
+        *context_ptr = malloc(sizeof(activity_face_state_t));
+        memset(*context_ptr, 0, sizeof(activity_face_state_t));
+        _state = (activity_face_state_t *)*context_ptr;
+        activity_init(&_state->activity, ACTIVITY_FACE_SAMPLE_RATE);
+
+        watch_enable_i2c();
+        _state->sensor_found = lis2dw_begin();
+        if (!_state->sensor_found) return;
+        lis2dw_configure(&(lis2dw_configuration_t) {
+            .data_rate = LIS2DW_DATA_RATE_25_HZ,
+            .mode = LIS2DW_MODE_LOW_POWER,
+            .low_power_mode = LIS2DW_LP_MODE_2, // lowest power 14-bit mode
+            .bandwidth_filtering = LIS2DW_BANDWIDTH_FILTER_DIV2,
+            .range = LIS2DW_RANGE_4_G,
+            .filter = LIS2DW_FILTER_LOW_PASS,
+            .low_noise = false,
+        });
+        lis2dw_enable_fifo_threshold_int1(ACTIVITY_FACE_SAMPLE_RATE);
+    } else {
+        if (!_state->sensor_found) return;
+        // setup runs again on the way out of low energy mode, which switched off I2C and the interrupt pins.
+        watch_enable_i2c();
+    }
+
+    // low energy mode would leave the FIFO to overflow for hours, so never enter it.
+    settings->bit.le_interval = 0;
+
+    // INT1 only rises when the FIFO level crosses the threshold. if the FIFO filled up while nobody was listening,
+    // INT1 would stay high and we'd never hear from it again, so drain it before arming the interrupt.
+    _activity_face_fifo_threshold();
+    watch_register_interrupt_callback(A4, _activity_face_fifo_threshold, INTERRUPT_TRIGGER_RISING);
+}
+
+void activity_face_activate(movement_settings_t *settings, void *context) {
+    (void) settings;
+    activity_face_state_t *state = (activity_face_state_t *)context;
+    state->page = 0;
+}
+
+bool activity_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
+    activity_face_state_t *state = (activity_face_state_t *)context;
+
+    switch (event.event_type) {
+        case EVENT_ACTIVATE:
+        case EVENT_TICK:
+        case EVENT_LOW_ENERGY_UPDATE:
+            _activity_face_update_display(state);
+            break;
+        case EVENT_ALARM_BUTTON_UP:
+            state->page = (state->page + 1) % (ACTIVITY_NUM_TYPES + 1);
+            _activity_face_update_display(state);
+            break;
+        case EVENT_BACKGROUND_TASK:
+            _activity_face_end_day(state);
+            break;
+        case EVENT_TIMEOUT:
+            movement_move_to_face(0);
+            break;
+        default:
+            return movement_default_loop_handler(event, settings);
+    }
+
+    return true;
+}
+
+void activity_face_resign(movement_settings_t *settings, void *context) {
+    (void) settings;
+    (void) context;
+    // the accelerometer keeps sampling in the background.
+}
+
+bool activity_face_wants_background_task(movement_settings_t *settings, void *context) {
+    (void) settings;
+    activity_face_state_t *state = (activity_face_state_t *)context;
+    if (!state->sensor_found) return false;
+
+    watch_date_time date_time = watch_rtc_get_date_time();
+    return date_time.unit.hour == 0 && date_time.unit.minute == 0;
+}
@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef ACTIVITY_FACE_H_
+#define ACTIVITY_FACE_H_
+
+#include "movement.h"
+#include "activity.h"
+
+/*
+ * ACTIVITY
+ *
+ * Counts steps and keeps track of time spent still, walking and running, using
+ * the accelerometer on the Sensor Watch Motion board. The accelerometer runs
+ * at 25 Hz all day, and wakes the watch once a second to hand over a batch of
+ * samples; see lib/activity for how they're processed.
+ *
+ * The main display shows today's steps (ST). Press the alarm button to see the
+ * minutes spent idle (ID), walking (WA) and running (RU) today; the LAP
+ * indicator marks the activity you're doing now.
+ *
+ * At midnight, the day's totals are appended to activity.dat, one 16-byte
+ * activity_face_summary_t per day, and the counts start over.
+ *
+ * This face takes over the accelerometer and its INT1 pin, so don't use it
+ * along with the other accelerometer faces. It also turns off low energy mode:
+ * in low energy mode the watch can't take samples from the accelerometer, and
+ * its FIFO only holds about a second of data, so any steps taken while the
+ * watch slept would be lost.
+ */
+
+#define ACTIVITY_FACE_SAMPLE_RATE 25
+
+typedef struct {
+    uint8_t year;       // years since 2020, as in watch_date_time
+    uint8_t month;
+    uint8_t day;
+    uint8_t reserved;
+    uint32_t steps;
+    uint16_t minutes[ACTIVITY_NUM_TYPES];
+    uint16_t reserved2;
+} activity_face_summary_t;
+
+typedef struct {
+    activity_state_t activity;
+    // totals as of midnight; today's counts are the difference from these.
+    uint32_t day_start_steps;
+    uint32_t day_start_samples[ACTIVITY_NUM_TYPES];
+    uint8_t page;
+    bool sensor_found;
+} activity_face_state_t;
+
+void activity_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
+void activity_face_activate(movement_settings_t *settings, void *context);
+bool activity_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
+void activity_face_resign(movement_settings_t *settings, void *context);
+bool activity_face_wants_background_task(movement_settings_t *settings, void *context);
+
+#define activity_face ((const watch_face_t){ \
+    activity_face_setup, \
+    activity_face_activate, \
+    activity_face_loop, \
+    activity_face_resign, \
+    activity_face_wants_background_task, \
+})
+
+#endif // ACTIVITY_FACE_H_
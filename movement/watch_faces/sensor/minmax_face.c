@@ -25,7 +25,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "minmax_face.h"
-#include "thermistor_driver.h"
+#include "movement_sensors.h"
 #include "watch.h"
 
 
@@ -46,9 +46,8 @@ static float _get_displayed_temperature_c(minmax_state_t *state){
 
 
 static void _minmax_face_log_data(minmax_state_t *logger_state) {
-    thermistor_driver_enable();
     size_t pos = (size_t) watch_rtc_get_date_time().unit.hour;
-    float temp_c = thermistor_driver_get_temperature();
+    float temp_c = movement_sensors_get_temperature(30);
     // If no data yet, initialise with current temperature
     if(!logger_state->have_logged){
       logger_state->have_logged = true;
@@ -69,7 +68,6 @@ static void _minmax_face_log_data(minmax_state_t *logger_state) {
     else if(logger_state->hourly_maxs[pos] < temp_c){
       logger_state->hourly_maxs[pos] = temp_c;
     }
-    thermistor_driver_disable();
 }
 
 static void _minmax_face_update_display(float temperature_c, bool in_fahrenheit) {
@@ -89,6 +87,7 @@ void minmax_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     if (*context_ptr == NULL) {
         *context_ptr = malloc(sizeof(minmax_state_t));
         memset(*context_ptr, 0, sizeof(minmax_state_t));
+        movement_sensors_subscribe(MOVEMENT_SENSOR_TEMPERATURE);
     }
 }
 
@@ -25,19 +25,16 @@
 #include <stdlib.h>
 #include <string.h>
 #include "thermistor_logging_face.h"
-#include "thermistor_driver.h"
+#include "movement_sensors.h"
 #include "watch.h"
 
 static void _thermistor_logging_face_log_data(thermistor_logger_state_t *logger_state) {
-    thermistor_driver_enable();
     watch_date_time date_time = watch_rtc_get_date_time();
     size_t pos = logger_state->data_points % THERMISTOR_LOGGING_NUM_DATA_POINTS;
 
     logger_state->data[pos].timestamp.reg = date_time.reg;
-    logger_state->data[pos].temperature_c = thermistor_driver_get_temperature();
+    logger_state->data[pos].temperature_c = movement_sensors_get_temperature(30);
     logger_state->data_points++;
-
-    thermistor_driver_disable();
 }
 
 static void _thermistor_logging_face_update_display(thermistor_logger_state_t *logger_state, bool in_fahrenheit, bool clock_mode_24h, bool clock_24h_leading_zero) {
@@ -83,6 +80,7 @@ void thermistor_logging_face_setup(movement_settings_t *settings, uint8_t watch_
     if (*context_ptr == NULL) {
         *context_ptr = malloc(sizeof(thermistor_logger_state_t));
         memset(*context_ptr, 0, sizeof(thermistor_logger_state_t));
+        movement_sensors_subscribe(MOVEMENT_SENSOR_TEMPERATURE);
     }
 }
 
@@ -25,12 +25,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include "thermistor_readout_face.h"
-#include "thermistor_driver.h"
+#include "movement_sensors.h"
 #include "watch.h"
 
 static void _thermistor_readout_face_update_display(bool in_fahrenheit) {
-    thermistor_driver_enable();
-    float temperature_c = thermistor_driver_get_temperature();
+    float temperature_c = movement_sensors_get_temperature(1);
     char buf[14];
     if (in_fahrenheit) {
         sprintf(buf, "%4.1f#F", temperature_c * 1.8 + 32.0);
@@ -38,7 +37,6 @@ static void _thermistor_readout_face_update_display(bool in_fahrenheit) {
         sprintf(buf, "%4.1f#C", temperature_c);
     }
     watch_display_string(buf, 4);
-    thermistor_driver_disable();
 }
 
 void thermistor_readout_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
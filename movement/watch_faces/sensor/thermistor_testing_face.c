@@ -30,7 +30,7 @@
 
 static void _thermistor_testing_face_update_display(bool in_fahrenheit) {
     thermistor_driver_enable();
-    float temperature_c = thermistor_driver_get_temperature();
+    float temperature_c = thermistor_driver_get_temperature() / 100.0f;
     char buf[14];
     if (in_fahrenheit) {
         sprintf(buf, "%4.1f#F", temperature_c * 1.8 + 32.0);
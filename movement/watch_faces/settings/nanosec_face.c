@@ -25,7 +25,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
-#include "thermistor_driver.h"
+#include "movement_sensors.h"
 #include "nanosec_face.h"
 #include "filesystem.h"
 #include "watch_utility.h"
@@ -150,6 +150,9 @@ void nanosec_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
     (void) watch_face_index;
     (void) settings;
 
+    movement_sensors_subscribe(MOVEMENT_SENSOR_TEMPERATURE);
+    movement_sensors_subscribe(MOVEMENT_SENSOR_VCC);
+
     if (*context_ptr == NULL) {
         if (filesystem_get_file_size("nanosec.ini") != sizeof(nanosec_state)) {
             // No previous ini or old version of ini file - create new config file
@@ -325,10 +328,8 @@ bool nanosec_face_loop(movement_event_t event, movement_settings_t *settings, vo
             break;
         case EVENT_BACKGROUND_TASK:
             // Here we measure temperature and do main frequency correction
-            thermistor_driver_enable();
-            float temperature_c = thermistor_driver_get_temperature();
-            float voltage = (float)watch_get_vcc_voltage() / 1000.0;
-            thermistor_driver_disable();
+            float temperature_c = movement_sensors_get_temperature(30);
+            float voltage = (float)movement_sensors_get_vcc_voltage(30) / 1000.0;
             // L22 correction scaling is 0.95367ppm per 1 in FREQCORR
             // At wrong temperature crystall starting to run slow, negative correction will speed up frequency to correct
             // Default 32kHz correciton factor is -0.034, centered around 25°C
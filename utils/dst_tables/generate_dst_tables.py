@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Generate Movement's daylight saving time tables.
+
+    generate_dst_tables.py [-o OUTPUT]
+
+Reads zones.txt, which maps indexes in movement_timezone_offsets to IANA zones.
+It then finds every change of UTC offset between 2020 and 2083, the years the
+watch's RTC can hold, and writes them to movement/movement_tz_tables.c.
+
+The rules come only from the tzdata snapshot in the tzdata directory next to
+this script (see tzdata/VERSION), never from the system or the network, so the
+output depends only on what's checked in. To update the snapshot, copy the
+compiled zone files for the zones in zones.txt from a newer tzdata release
+(i.e. /usr/share/zoneinfo) into tzdata, and update tzdata/VERSION.
+
+Each transition is packed into a uint32_t: the upper 24 bits hold the time of
+the change in quarter hours since 2020-01-01 00:00 UTC, and the lower 8 bits
+hold the new UTC offset in quarter hours, as a signed number. The first entry
+of each zone is at time 0 and gives the offset in effect at the start of 2020.
+"""
+
+import argparse
+import datetime
+import os
+import re
+import sys
+import zoneinfo
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.normpath(os.path.join(HERE, "..", ".."))
+TZDATA = os.path.join(HERE, "tzdata")
+
+EPOCH = datetime.datetime(2020, 1, 1, tzinfo=datetime.timezone.utc)
+END = datetime.datetime(2084, 1, 1, tzinfo=datetime.timezone.utc)
+QUARTER_HOUR = 900
+# transitions are at least a few weeks apart, so stepping a few hours at a time can't skip over one.
+STEP = datetime.timedelta(hours=6)
+
+
+def read_zones(path):
+    zones = []
+    with open(path) as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            index, name = line.split()
+            zones.append((int(index), name))
+    return zones
+
+
+def read_standard_offsets(path):
+    """Returns movement_timezone_offsets from movement.c, in minutes."""
+    with open(path) as f:
+        source = f.read()
+    table = re.search(r"movement_timezone_offsets\[\] = \{(.*?)\};", source, re.S).group(1)
+    return [int(value) for value in re.findall(r"^\s*(-?\d+),", table, re.M)]
+
+
+def load_zone(name):
+    path = os.path.join(TZDATA, name)
+    if not os.path.isfile(path):
+        sys.exit(f"{name} is not in the tzdata snapshot; copy it into {TZDATA}")
+    with open(path, "rb") as f:
+        return zoneinfo.ZoneInfo.from_file(f, key=name)
+
+
+def offset_at(zone, when):
+    return int(when.astimezone(zone).utcoffset().total_seconds())
+
+
+def find_transitions(zone):
+    """Returns a list of (seconds since EPOCH, new UTC offset in seconds), starting with the offset at EPOCH."""
+    transitions = [(0, offset_at(zone, EPOCH))]
+    when = EPOCH
+    while when < END:
+        following = min(when + STEP, END)
+        if offset_at(zone, following) != offset_at(zone, when):
+            # narrow it down to the second.
+            low, high = when, following
+            while high - low > datetime.timedelta(seconds=1):
+                middle = low + (high - low) / 2
+                if offset_at(zone, middle) == offset_at(zone, low):
+                    low = middle
+                else:
+                    high = middle
+            transitions.append((int((high - EPOCH).total_seconds()), offset_at(zone, high)))
+        when = following
+    return transitions
+
+
+def pack(seconds, offset, name):
+    if seconds % QUARTER_HOUR or offset % QUARTER_HOUR:
+        sys.exit(f"{name}: a transition or offset isn't on a quarter hour")
+    return ((seconds // QUARTER_HOUR) << 8) | ((offset // QUARTER_HOUR) & 0xFF)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("-o", "--output", default=os.path.join(ROOT, "movement", "movement_tz_tables.c"))
+    args = parser.parse_args()
+
+    with open(os.path.join(TZDATA, "VERSION")) as f:
+        version = f.read().strip()
+    offsets = read_standard_offsets(os.path.join(ROOT, "movement", "movement.c"))
+    zones = read_zones(os.path.join(HERE, "zones.txt"))
+
+    tables = []
+    for index, name in zones:
+        zone = load_zone(name)
+        standard = EPOCH.astimezone(zone)
+        standard = int((standard.utcoffset() - standard.dst()).total_seconds())
+        if index >= len(offsets) or offsets[index] * 60 != standard:
+            sys.exit(f"{name}: standard offset {standard // 60} doesn't match time zone {index}")
+        transitions = find_transitions(zone)
+        tables.append((index, name, [pack(seconds, offset, name) for seconds, offset in transitions]))
+
+    with open(args.output, "w") as out:
+        out.write("// Generated by utils/dst_tables/generate_dst_tables.py from tzdata %s; don't edit.\n" % version)
+        out.write("// See movement_tz.h for the format.\n\n")
+        out.write('#include "movement_tz.h"\n\n')
+        for index, name, packed in tables:
+            out.write("static const uint32_t _%s[] = {\n" % re.sub(r"\W", "_", name.lower()))
+            for i in range(0, len(packed), 6):
+                out.write("    " + ", ".join("0x%08x" % value for value in packed[i:i + 6]) + ",\n")
+            out.write("};\n\n")
+        out.write("const movement_tz_zone_t movement_tz_zones[MOVEMENT_TZ_NUM_ZONES] = {\n")
+        for index, name, packed in tables:
+            symbol = "_" + re.sub(r"\W", "_", name.lower())
+            out.write('    [%d] = { "%s", %s, %d },\n' % (index, name, symbol, len(packed)))
+        out.write("};\n")
+
+    print("Wrote %d zones from tzdata %s to %s" % (len(tables), version, os.path.relpath(args.output)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Generate the thermistor lookup table.
+
+    generate_thermistor_table.py [-o OUTPUT]
+
+Reads the thermistor's parameters (THERMISTOR_B_COEFFICIENT and friends) from
+watch-library/shared/driver/thermistor_driver.h and writes thermistor_table.h
+next to it. The table maps the ADC reading of the thermistor divider to the
+temperature in hundredths of a degree Celsius, so the driver can convert a
+reading with a lookup and a linear interpolation instead of a logarithm.
+
+The ADC accumulates 16 12-bit samples, so readings run from 0 to 65535. The
+table has an entry every 256 counts, plus one at the end for interpolating the
+last segment. Temperatures beyond what an int16_t can hold are clamped; they're
+far outside anything the sensor can read anyway.
+
+Run this again whenever the thermistor parameters change.
+"""
+
+import argparse
+import math
+import os
+import re
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.normpath(os.path.join(HERE, "..", ".."))
+DRIVER = os.path.join(ROOT, "watch-library", "shared", "driver")
+
+STEP = 256
+# the range the interpolation has to be good over, in degrees Celsius, and how good.
+CHECK_RANGE = (-40.0, 125.0)
+MAX_ERROR = 0.05
+
+
+def read_parameters(path):
+    with open(path) as f:
+        source = f.read()
+    parameters = {}
+    for name, value in re.findall(r"#define THERMISTOR_(\w+) \((.+)\)", source):
+        parameters[name] = {"true": True, "false": False}.get(value, value)
+    return {
+        "highside": parameters["HIGH_SIDE"],
+        "b_coefficient": float(parameters["B_COEFFICIENT"]),
+        "nominal_temperature": float(parameters["NOMINAL_TEMPERATURE"]),
+        "nominal_resistance": float(parameters["NOMINAL_RESISTANCE"]),
+        "series_resistance": float(parameters["SERIES_RESISTANCE"]),
+    }
+
+
+def temperature(value, p):
+    """Same as watch_utility_thermistor_temperature, in double precision."""
+    value = min(max(value, 1), 65534)
+    if p["highside"]:
+        resistance = (1023.0 * p["series_resistance"]) / (value / 64.0) - p["series_resistance"]
+    else:
+        resistance = p["series_resistance"] / (65535.0 / value - 1.0)
+    if resistance <= 0:
+        return math.inf if p["highside"] else -math.inf
+    reading = math.log(resistance / p["nominal_resistance"]) / p["b_coefficient"]
+    reading += 1.0 / (p["nominal_temperature"] + 273.15)
+    return 1.0 / reading - 273.15
+
+
+def centidegrees(value, p):
+    t = temperature(value, p)
+    if math.isinf(t) or t * 100 > 32767:
+        return 32767 if t > 0 else -32768
+    return max(-32768, min(32767, round(t * 100)))
+
+
+def interpolate(table, value):
+    # must match thermistor_driver.c.
+    index = value // STEP
+    fraction = value % STEP
+    return table[index] + (((table[index + 1] - table[index]) * fraction) >> 8)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("-o", "--output", default=os.path.join(DRIVER, "thermistor_table.h"))
+    args = parser.parse_args()
+
+    p = read_parameters(os.path.join(DRIVER, "thermistor_driver.h"))
+    table = [centidegrees(i * STEP, p) for i in range(65536 // STEP + 1)]
+
+    worst = 0.0
+    for value in range(65536):
+        t = temperature(value, p)
+        if CHECK_RANGE[0] <= t <= CHECK_RANGE[1]:
+            worst = max(worst, abs(interpolate(table, value) / 100.0 - t))
+    if worst > MAX_ERROR:
+        sys.exit("interpolation error of %.3f degrees is over %.3f; use a smaller step" % (worst, MAX_ERROR))
+
+    with open(args.output, "w") as out:
+        out.write("// Generated by utils/thermistor_table/generate_thermistor_table.py; don't edit.\n")
+        out.write("// B = %g, R0 = %g ohms at %g C, series resistor %g ohms, %s side.\n" % (
+            p["b_coefficient"], p["nominal_resistance"], p["nominal_temperature"], p["series_resistance"],
+            "high" if p["highside"] else "low"))
+        out.write("// Worst interpolation error from %g to %g C: %.4f C.\n\n" % (CHECK_RANGE[0], CHECK_RANGE[1], worst))
+        out.write("#ifndef THERMISTOR_TABLE_H_\n#define THERMISTOR_TABLE_H_\n\n")
+        out.write("#include <stdint.h>\n\n")
+        out.write("#define THERMISTOR_TABLE_SHIFT %d\n\n" % int(math.log2(STEP)))
+        out.write("// temperature in hundredths of a degree Celsius, for ADC readings of 0, %d, %d ... 65536.\n" % (STEP, 2 * STEP))
+        out.write("static const int16_t thermistor_table[%d] = {\n" % len(table))
+        for i in range(0, len(table), 8):
+            out.write("    " + ", ".join("%6d" % v for v in table[i:i + 8]) + ",\n")
+        out.write("};\n\n#endif // THERMISTOR_TABLE_H_\n")
+
+    print("Wrote %s (worst error %.4f C)" % (os.path.relpath(args.output), worst))
+
+
+if __name__ == "__main__":
+    main()
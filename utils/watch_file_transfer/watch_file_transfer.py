@@ -0,0 +1,210 @@
+#!/usr/bin/env python3
+"""Copy files to and from a Sensor Watch over the USB serial shell.
+
+    watch_file_transfer.py [-p PORT] get REMOTE [LOCAL]
+    watch_file_transfer.py [-p PORT] put LOCAL [REMOTE]
+    watch_file_transfer.py [-p PORT] ls
+
+This speaks the protocol implemented by the `get` and `put` shell commands in
+movement/filesystem.c: numbered base64 frames with a CRC-32 each, acknowledged
+in order, with a few frames in flight at a time. Requires pyserial.
+"""
+
+import argparse
+import base64
+import os
+import sys
+import time
+import zlib
+
+TIMEOUT = 1.0          # resend unacknowledged frames after this long
+MAX_RETRIES = 5
+
+
+class TransferError(Exception):
+    pass
+
+
+class Watch:
+    def __init__(self, port):
+        self.port = port
+        self.buffer = b""
+
+    def write_line(self, line):
+        self.port.write(line.encode("ascii") + b"\n")
+
+    def read_line(self, timeout):
+        """Returns the next non-empty line, or None if nothing arrives in time."""
+        deadline = time.monotonic() + timeout
+        while True:
+            while b"\n" in self.buffer:
+                line, self.buffer = self.buffer.split(b"\n", 1)
+                line = line.strip().decode("ascii", "replace")
+                if line:
+                    return line
+            if time.monotonic() > deadline:
+                return None
+            self.buffer += self.port.read(256)
+
+    def command(self, line):
+        """Runs a shell command that starts a transfer, returning (size, chunk, window)."""
+        self.port.reset_input_buffer()
+        self.port.write(line.encode("ascii") + b"\r")
+        while True:
+            reply = self.read_line(5)
+            if reply is None:
+                raise TransferError(f"no response to '{line}'")
+            # skip the shell's echo of our command
+            if reply.startswith("ERR"):
+                raise TransferError(reply[4:])
+            if reply.startswith("READY "):
+                size, chunk, window = (int(x) for x in reply.split()[1:4])
+                return size, chunk, window
+
+    def finish(self, size, crc):
+        while True:
+            reply = self.read_line(5)
+            if reply is None:
+                raise TransferError("no final status")
+            if reply.startswith("ERR"):
+                raise TransferError(reply[4:])
+            if reply.startswith("OK "):
+                fields = reply.split()
+                if int(fields[1]) != size or int(fields[2], 16) != crc:
+                    raise TransferError(f"verification failed: {reply}")
+                return
+
+    def get(self, remote):
+        size, chunk, window = self.command(f"get {remote}")
+        data = bytearray()
+        expected = 0
+        nak_sent = None
+        retries = 0
+        while len(data) < size:
+            line = self.read_line(TIMEOUT * 2)
+            if line is None:
+                retries += 1
+                if retries > MAX_RETRIES:
+                    self.write_line("X")
+                    raise TransferError("timeout")
+                self.write_line(f"N {expected:x}")
+                continue
+            if line.startswith("ERR"):
+                raise TransferError(line[4:])
+            fields = line.split(" ")
+            try:
+                seq = int(fields[1], 16)
+                payload = base64.b64decode(fields[3], validate=True)
+                valid = fields[0] == "D" and len(fields) == 4 and zlib.crc32(payload) == int(fields[2], 16)
+            except (IndexError, ValueError):
+                valid = False
+            if valid and seq < expected:
+                self.write_line(f"A {expected - 1:x}")
+            elif valid and seq == expected:
+                data += payload
+                self.write_line(f"A {seq:x}")
+                expected += 1
+                retries = 0
+                progress(len(data), size)
+            elif nak_sent != expected:
+                self.write_line(f"N {expected:x}")
+                nak_sent = expected
+        self.finish(size, zlib.crc32(data))
+        return bytes(data)
+
+    def put(self, remote, data):
+        size, chunk, window = self.command(f"put {remote} {len(data)}")
+        frames = [data[i:i + chunk] for i in range(0, len(data), chunk)]
+        base = 0
+        next_frame = 0
+        retries = 0
+        while base < len(frames):
+            while next_frame < len(frames) and next_frame < base + window:
+                frame = frames[next_frame]
+                encoded = base64.b64encode(frame).decode("ascii")
+                self.write_line(f"D {next_frame:x} {zlib.crc32(frame):08x} {encoded}")
+                next_frame += 1
+            line = self.read_line(TIMEOUT)
+            if line is None:
+                retries += 1
+                if retries > MAX_RETRIES:
+                    self.write_line("X")
+                    raise TransferError("timeout")
+                next_frame = base
+                continue
+            if line.startswith("ERR"):
+                raise TransferError(line[4:])
+            fields = line.split(" ")
+            if len(fields) != 2 or fields[0] not in ("A", "N"):
+                continue
+            seq = int(fields[1], 16)
+            if fields[0] == "A" and base <= seq < next_frame:
+                base = seq + 1
+                retries = 0
+                progress(min(base * chunk, len(data)), len(data))
+            elif fields[0] == "N" and base <= seq <= next_frame:
+                base = next_frame = seq
+        self.finish(len(data), zlib.crc32(data))
+
+    def ls(self):
+        self.port.reset_input_buffer()
+        self.port.write(b"ls\r")
+        while True:
+            line = self.read_line(1)
+            if line is None or line.startswith("swsh>"):
+                return
+            if line.startswith(("file ", "dir ")):
+                print(line)
+
+
+def progress(done, total):
+    if sys.stderr.isatty():
+        print(f"\r{done}/{total} bytes", end="" if done < total else "\n", file=sys.stderr)
+
+
+def default_port():
+    from serial.tools import list_ports
+    for port in list_ports.comports():
+        # USB IDs from the device descriptor in watch-library/hardware/watch/watch_private.c
+        if port.vid == 0x1209 and port.pid == 0x2151:
+            return port.device
+    raise TransferError("no watch found; pass the port with -p")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Copy files to and from a Sensor Watch.")
+    parser.add_argument("-p", "--port", help="serial port, i.e. /dev/ttyACM0 (default: autodetect)")
+    sub = parser.add_subparsers(dest="action", required=True)
+    get_parser = sub.add_parser("get", help="copy a file from the watch")
+    get_parser.add_argument("remote")
+    get_parser.add_argument("local", nargs="?")
+    put_parser = sub.add_parser("put", help="copy a file to the watch")
+    put_parser.add_argument("local")
+    put_parser.add_argument("remote", nargs="?")
+    sub.add_parser("ls", help="list files on the watch")
+    args = parser.parse_args()
+
+    import serial
+    try:
+        port = serial.Serial(args.port or default_port(), 115200, timeout=0.05)
+        watch = Watch(port)
+        start = time.monotonic()
+        if args.action == "get":
+            data = watch.get(args.remote)
+            with open(args.local or os.path.basename(args.remote), "wb") as f:
+                f.write(data)
+        elif args.action == "put":
+            with open(args.local, "rb") as f:
+                data = f.read()
+            watch.put(args.remote or os.path.basename(args.local), data)
+        else:
+            watch.ls()
+            return
+        elapsed = time.monotonic() - start
+        print(f"{len(data)} bytes in {elapsed:.1f} s", file=sys.stderr)
+    except TransferError as e:
+        sys.exit(f"error: {e}")
+
+
+if __name__ == "__main__":
+    main()
@@ -1153,10 +1153,46 @@ def clean_chars(string):
     return string
 
 
-def print_valid_words(letters=alphabet):
+def pack_word(word, letters):
     '''
-    Prints the array of valid words that the wordle_face.c can use
+    Packs the last four letters of a word into 16 bits, as one nibble per letter holding its index in letters.
+    The first letter isn't stored; it's implied by which group of the dictionary the word is in.
+    Since letters is sorted, sorting the packed values sorts the words alphabetically.
+    '''
+    packed = 0
+    for letter in word[1:]:
+        packed = (packed << 4) | letters.index(letter)
+    return packed
+
+
+def pack_dict(words, letters):
+    '''
+    Returns the packed dictionary for words, sorted and grouped by first letter,
+    along with the index where each letter's group starts (plus one past the end).
     '''
+    words = sorted(words)
+    packed = [pack_word(word, letters) for word in words]
+    starts = []
+    for letter in letters:
+        starts.append(next((i for i, word in enumerate(words) if word[0] >= letter), len(words)))
+    starts.append(len(words))
+    return words, packed, starts
+
+
+def print_array(ctype, name, values, items_per_row=12, fmt="0x{:04X}"):
+    print(f"static const {ctype} {name}[] = {{")
+    for i in range(0, len(values), items_per_row):
+        print("    " + ", ".join(fmt.format(value) for value in values[i:i + items_per_row]) + ",")
+    print("};")
+
+
+def print_packed_words(letters, valid_words, possible_words, num_best_words, num_uniq, top_words_percent):
+    '''
+    Prints the dictionary header that the wordle_face.c uses, given the words in the order they should be offered as answers.
+    '''
+    assert len(letters) <= 16, "Letters are packed one per nibble"
+    letters = sorted(letters)
+
     print("#ifndef WORDLE_FACE_DICT_H_")
     print("#define WORDLE_FACE_DICT_H_")
 
@@ -1167,8 +1203,45 @@ def print_valid_words(letters=alphabet):
     print("\n#ifndef WORDLE_USE_RANDOM_GUESS")
     print("#define WORDLE_USE_RANDOM_GUESS 2")
     print("#endif\n")
-    
-    items_per_row = 9
+
+    print("static const char _valid_letters[] = {" + ", ".join(f"'{clean_chars(letter)}'" for letter in letters) + "};")
+    print("")
+    print("// Each dictionary below is sorted alphabetically and grouped by first letter. A word is packed into 16 bits")
+    print("// as the index into _valid_letters of each of its last four letters, one per nibble, with the second letter")
+    print("// in the top nibble. The words starting with _valid_letters[i] are found from _<name>_dict_start[i] up to")
+    print("// (but not including) _<name>_dict_start[i + 1], so a lookup is a binary search within one group.")
+    print("")
+    print(f"// From: {source_link}")
+    print(f"// Number of words found: {len(valid_words)}")
+    sorted_valid, packed_valid, starts_valid = pack_dict(valid_words, letters)
+    print_array("uint16_t", "_valid_dict", packed_valid)
+    print_array("uint16_t", "_valid_dict_start", starts_valid, fmt="{}", items_per_row=13)
+    print("")
+    print("// The words that can be the answer, as indices into _valid_dict, in the order they're offered.")
+    print_array("uint16_t", "_valid_words", [sorted_valid.index(word) for word in valid_words], fmt="{}", items_per_row=16)
+
+    print("\n#if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES")
+    print("// These are words that'll never be used, but still need to be in the dictionary for guesses.")
+    print(f"// Number of words found: {len(possible_words)}")
+    _, packed_possible, starts_possible = pack_dict(possible_words, letters)
+    print_array("uint16_t", "_possible_dict", packed_possible)
+    print_array("uint16_t", "_possible_dict_start", starts_possible, fmt="{}", items_per_row=13)
+    print("#endif\n")
+
+    print("#if (WORDLE_USE_RANDOM_GUESS == 3)")
+    print(f"static const uint16_t _num_random_guess_words = {num_best_words};  // The valid_words array begins with this many words that are considered the top {top_words_percent}% best options.")
+    print("#elif (WORDLE_USE_RANDOM_GUESS == 2)")
+    print(f"static const uint16_t _num_random_guess_words = {num_uniq};  // The valid_words array begins with this many words where each letter is different.")
+    print("#elif (WORDLE_USE_RANDOM_GUESS == 1)")
+    print("static const uint16_t _num_random_guess_words = sizeof(_valid_words) / sizeof(_valid_words[0]);")
+    print("#endif")
+    print("\n#endif // WORDLE_FACE_DICT_H_")
+
+
+def print_valid_words(letters=alphabet):
+    '''
+    Prints the array of valid words that the wordle_face.c can use
+    '''
     top_words_percent = 3
     valid_words = list_of_valid_words(letters, valid_list)
     valid_words = capitalize_all_and_remove_duplicates(valid_words)
@@ -1179,49 +1252,12 @@ def print_valid_words(letters=alphabet):
     num_best_words = round(len(valid_words) * top_words_percent / 100)
     for i in range(num_best_words, 0, -1):
         valid_words.insert(0, valid_words.pop(valid_words.index(best_words[i-1])))
-            
-    print("static const char _valid_letters[] = {", end='')
-    letters = sorted(letters)
-    for letter in letters[:-1]:
-        print(f"'{clean_chars(letter)}', ", end='')
-    print(f"'{letters[-1]}'" + "};")
-    print("")
-    print(f"// From: {source_link}")
-    print(f"// Number of words found: {len(valid_words)}")
-    print("static const char _valid_words[][WORDLE_LENGTH + 1] = {")
-    i = 0
-    while i < len(valid_words):
-        print("    ", end='')
-        for _ in range(min(items_per_row, len(valid_words)-i)):
-            print(f'"{clean_chars(valid_words[i])}", ', end='')
-            i+=1
-        print('')
+
     possible_words = list_of_valid_words(letters, possible_list)
     possible_words = [word for word in possible_words if word not in valid_list]
     possible_words = capitalize_all_and_remove_duplicates(possible_words)
-    print("};")
-    print("\n// These are words that'll never be used, but still need to be in the dictionary for guesses.")
-    print(f"// Number of words found: {len(possible_words)}")
-    print("static const char _possible_words[][WORDLE_LENGTH + 1] = {")
-    print("#if !WORDLE_ALLOW_NON_WORD_AND_REPEAT_GUESSES")
-    i = 0
-    while i < len(possible_words):
-        print("    ", end='')
-        for j in range(min(items_per_row, len(possible_words)-i)):
-            print(f'"{clean_chars(possible_words[i])}", ', end='')
-            i+=1
-        print('')
-    print("#endif")
-    print("};\n")
-    
-    print("#if (WORDLE_USE_RANDOM_GUESS == 3)")
-    print(f"static const uint16_t _num_random_guess_words = {num_best_words};  // The valid_words array begins with this many words that are considered the top {top_words_percent}% best options.")
-    print("#elif (WORDLE_USE_RANDOM_GUESS == 2)")
-    print(f"static const uint16_t _num_random_guess_words = {num_uniq};  // The valid_words array begins with this many words where each letter is different.")
-    print("#elif (WORDLE_USE_RANDOM_GUESS == 1)")
-    print("static const uint16_t _num_random_guess_words = _num_words;")
-    print("#endif")
-    print("\n#endif // WORDLE_FACE_DICT_H_")
+
+    print_packed_words(letters, valid_words, possible_words, num_best_words, num_uniq, top_words_percent)
 
 
 def get_sec_val_and_units(seconds):
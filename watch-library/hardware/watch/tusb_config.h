@@ -72,18 +72,27 @@
 
 //------------- CLASS -------------//
 #define CFG_TUD_CDC               1
+// USB mass storage exposes a read-only FAT view of the filesystem; build with USB_MSC=1 to enable it.
+#ifdef WATCH_USB_MSC
+#define CFG_TUD_MSC               1
+#else
 #define CFG_TUD_MSC               0
+#endif
 #define CFG_TUD_HID               0
 #define CFG_TUD_MIDI              0
 #define CFG_TUD_VENDOR            0
 
 // CDC FIFO size of TX and RX
 #define CFG_TUD_CDC_RX_BUFSIZE   (64)
-#define CFG_TUD_CDC_TX_BUFSIZE   (64)
+// TX has room for several packets, so the next one can be queued as soon as one completes
+#define CFG_TUD_CDC_TX_BUFSIZE   (256)
 
 // CDC Endpoint transfer buffer size, more is faster
 #define CFG_TUD_CDC_EP_BUFSIZE   (64)
 
+// MSC buffer size; one full sector, so each read callback produces a whole sector
+#define CFG_TUD_MSC_EP_BUFSIZE   (512)
+
 #ifdef __cplusplus
  }
 #endif
@@ -24,11 +24,45 @@
 
 #include "watch_adc.h"
 #include "driver_init.h"
+#include "hpl_dma.h"
+
+// Background sampling: RTC periodic event -> event system channel -> ADC start conversion; ADC result ready ->
+// DMA channel -> buffer. The DMA channel is configured in hpl_dmac_config.h to move one half-word per result
+// and to interrupt at the end of each block. Its first descriptor lives in the hpl's descriptor section; we
+// link it to a second one for the other half of the buffer, and that one back to the first, making a ring.
+#define WATCH_ADC_DMA_CHANNEL 2
+#define WATCH_ADC_EVSYS_CHANNEL 0
+// the ADC needs a clock in standby, and GCLK0 (the CPU clock) stops there. generator 2 is otherwise unused.
+#define WATCH_ADC_GCLK_GENERATOR 2
+
+extern DmacDescriptor _descriptor_section[DMAC_CH_NUM];
+COMPILER_ALIGNED(16) static DmacDescriptor _second_half_descriptor;
+
+static struct {
+    uint16_t *buffer;
+    uint16_t half_length;
+    uint8_t next_half;
+    watch_adc_batch_callback_t callback;
+    bool running;
+} _background;
 
 static void _watch_sync_adc(void) {
     while (ADC->SYNCBUSY.reg);
 }
 
+static uint8_t _watch_get_adc_prescaler(void) {
+    // whatever the main clock is running at, divide it down to a 500kHz ADC clock.
+    switch (watch_get_cpu_frequency()) {
+        case 16000000:
+            return ADC_CTRLB_PRESCALER_DIV32_Val;
+        case 8000000:
+            // i.e. USB is enabled.
+            return ADC_CTRLB_PRESCALER_DIV16_Val;
+        default:
+            return ADC_CTRLB_PRESCALER_DIV8_Val;
+    }
+}
+
 static uint16_t _watch_get_analog_value(uint16_t channel) {
     if (ADC->INPUTCTRL.bit.MUXPOS != channel) {
         ADC->INPUTCTRL.bit.MUXPOS = channel;
@@ -58,14 +92,7 @@ void watch_enable_adc(void) {
     }
     _watch_sync_adc();
 
-    if (USB->DEVICE.CTRLA.bit.ENABLE) {
-        // if USB is enabled, we are running an 8 MHz clock.
-        // divide by 16 for a 500kHz ADC clock.
-        ADC->CTRLB.bit.PRESCALER = ADC_CTRLB_PRESCALER_DIV16_Val;
-    } else {
-        // otherwise it's 4 Mhz. divide by 8 for a 500kHz ADC clock.
-        ADC->CTRLB.bit.PRESCALER = ADC_CTRLB_PRESCALER_DIV8_Val;
-    }
+    ADC->CTRLB.bit.PRESCALER = _watch_get_adc_prescaler();
     ADC->CALIB.reg = calib_reg;
     ADC->REFCTRL.bit.REFSEL = ADC_REFCTRL_REFSEL_INTVCC2_Val;
     ADC->INPUTCTRL.bit.MUXNEG = ADC_INPUTCTRL_MUXNEG_GND_Val;
@@ -79,6 +106,30 @@ void watch_enable_adc(void) {
     _watch_get_analog_value(ADC_INPUTCTRL_MUXPOS_SCALEDCOREVCC);
 }
 
+static void _watch_adc_update_background_clock(void) {
+    // generator 2 divides OSC16M, whatever frequency it's at, down to 1 MHz; the ADC's prescaler halves that.
+    GCLK->GENCTRL[WATCH_ADC_GCLK_GENERATOR].reg = GCLK_GENCTRL_SRC_OSC16M | GCLK_GENCTRL_DIV(watch_get_cpu_frequency() / 1000000) |
+                                                  GCLK_GENCTRL_RUNSTDBY | GCLK_GENCTRL_GENEN;
+    while (GCLK->SYNCBUSY.reg & (GCLK_SYNCBUSY_GENCTRL0 << WATCH_ADC_GCLK_GENERATOR));
+}
+
+void _watch_adc_update_prescaler(void) {
+    if (!(MCLK->APBCMASK.reg & MCLK_APBCMASK_ADC) || !ADC->CTRLA.bit.ENABLE) return;
+
+    // in background sampling, the ADC doesn't run from the main clock, but its generator does run from the same oscillator.
+    if (_background.running) {
+        _watch_adc_update_background_clock();
+        return;
+    }
+
+    // the prescaler can only be changed while the ADC is disabled.
+    ADC->CTRLA.bit.ENABLE = 0;
+    _watch_sync_adc();
+    ADC->CTRLB.bit.PRESCALER = _watch_get_adc_prescaler();
+    ADC->CTRLA.bit.ENABLE = 1;
+    _watch_sync_adc();
+}
+
 void watch_enable_analog_input(const uint8_t pin) {
     gpio_set_pin_direction(pin, GPIO_DIRECTION_OFF);
     switch (pin) {
@@ -102,23 +153,29 @@ void watch_enable_analog_input(const uint8_t pin) {
     }
 }
 
-uint16_t watch_get_analog_pin_level(const uint8_t pin) {
+static int16_t _watch_get_adc_channel(const uint8_t pin) {
     switch (pin) {
         case A0:
-            return _watch_get_analog_value(ADC_INPUTCTRL_MUXPOS_AIN12_Val);
+            return ADC_INPUTCTRL_MUXPOS_AIN12_Val;
         case A1:
-            return _watch_get_analog_value(ADC_INPUTCTRL_MUXPOS_AIN9_Val);
+            return ADC_INPUTCTRL_MUXPOS_AIN9_Val;
         case A2:
-            return _watch_get_analog_value(ADC_INPUTCTRL_MUXPOS_AIN10_Val);
+            return ADC_INPUTCTRL_MUXPOS_AIN10_Val;
         case A3:
-            return _watch_get_analog_value(ADC_INPUTCTRL_MUXPOS_AIN11_Val);
+            return ADC_INPUTCTRL_MUXPOS_AIN11_Val;
         case A4:
-            return _watch_get_analog_value(ADC_INPUTCTRL_MUXPOS_AIN8_Val);
+            return ADC_INPUTCTRL_MUXPOS_AIN8_Val;
         default:
-            return 0;
+            return -1;
     }
 }
 
+uint16_t watch_get_analog_pin_level(const uint8_t pin) {
+    int16_t channel = _watch_get_adc_channel(pin);
+    if (channel < 0) return 0;
+    return _watch_get_analog_value(channel);
+}
+
 void watch_set_analog_num_samples(uint16_t samples) {
     // ignore any input that's not a power of 2 (i.e. only one bit set)
     if (__builtin_popcount(samples) != 1) return;
@@ -191,7 +248,119 @@ inline void watch_disable_analog_input(const uint8_t pin) {
     gpio_set_pin_function(pin, GPIO_PIN_FUNCTION_OFF);
 }
 
+static void _watch_adc_dma_done(struct _dma_resource *resource) {
+    (void) resource;
+    uint16_t *samples = _background.buffer + _background.next_half * _background.half_length;
+    _background.next_half ^= 1;
+    if (_background.callback) _background.callback(samples, _background.half_length);
+}
+
+static void _watch_adc_dma_error(struct _dma_resource *resource) {
+    (void) resource;
+    // the channel has already stopped; put everything else back the way it was.
+    watch_adc_stop_background_sampling();
+}
+
+bool watch_adc_start_background_sampling(const uint8_t pin, uint8_t frequency, uint16_t *buffer, uint16_t length, watch_adc_batch_callback_t callback) {
+    int16_t channel = _watch_get_adc_channel(pin);
+    if (_background.running || channel < 0 || buffer == NULL || length < 2 || (length & 1)) return false;
+    if (__builtin_popcount(frequency) != 1) return false;
+    if (!(MCLK->APBCMASK.reg & MCLK_APBCMASK_ADC)) return false;
+
+    // same mapping as watch_rtc_register_periodic_callback: 128 Hz is PER0 and 1 Hz is PER7.
+    uint8_t per_n = __builtin_clz((uint32_t)frequency << 24);
+
+    _background.buffer = buffer;
+    _background.half_length = length / 2;
+    _background.next_half = 0;
+    _background.callback = callback;
+    _background.running = true;
+
+    // the RTC's event control register can only be written while it's disabled; do that once, for every period,
+    // and leave them on. nothing listens to them unless the event system routes them somewhere.
+    if ((RTC->MODE2.EVCTRL.reg & RTC_MODE2_EVCTRL_PEREO_Msk) != RTC_MODE2_EVCTRL_PEREO_Msk) {
+        RTC->MODE2.CTRLA.bit.ENABLE = 0;
+        while (RTC->MODE2.SYNCBUSY.reg);
+        RTC->MODE2.EVCTRL.reg |= RTC_MODE2_EVCTRL_PEREO_Msk;
+        RTC->MODE2.CTRLA.bit.ENABLE = 1;
+        while (RTC->MODE2.SYNCBUSY.reg);
+    }
+
+    // switch the ADC over to a clock that can run on demand in standby: OSC16M only starts up for a conversion.
+    ADC->CTRLA.bit.ENABLE = 0;
+    _watch_sync_adc();
+    OSCCTRL->OSC16MCTRL.bit.RUNSTDBY = 1;
+    _watch_adc_update_background_clock();
+    GCLK->PCHCTRL[ADC_GCLK_ID].reg = GCLK_PCHCTRL_GEN(WATCH_ADC_GCLK_GENERATOR) | GCLK_PCHCTRL_CHEN;
+    ADC->CTRLB.bit.PRESCALER = ADC_CTRLB_PRESCALER_DIV2_Val;
+    ADC->CTRLA.reg |= ADC_CTRLA_RUNSTDBY | ADC_CTRLA_ONDEMAND;
+    ADC->INPUTCTRL.bit.MUXPOS = channel;
+    ADC->EVCTRL.reg = ADC_EVCTRL_STARTEI;
+    ADC->INTFLAG.reg = ADC_INTFLAG_RESRDY;
+    ADC->CTRLA.bit.ENABLE = 1;
+    _watch_sync_adc();
+    // the internal reference has to stay available in standby too, if it's in use.
+    if (ADC->REFCTRL.bit.REFSEL == ADC_REFCTRL_REFSEL_INTREF_Val) SUPC->VREF.reg |= SUPC_VREF_RUNSTDBY | SUPC_VREF_ONDEMAND;
+
+    // one block per half of the buffer. _dma_set_data_amount works with the first descriptor; the second is a copy
+    // of it, pointed at the other half.
+    struct _dma_resource *resource;
+    _dma_set_source_address(WATCH_ADC_DMA_CHANNEL, (const void *)&ADC->RESULT.reg);
+    _dma_set_destination_address(WATCH_ADC_DMA_CHANNEL, buffer);
+    _dma_set_data_amount(WATCH_ADC_DMA_CHANNEL, _background.half_length);
+    hri_dmacdescriptor_set_BTCTRL_VALID_bit(&_descriptor_section[WATCH_ADC_DMA_CHANNEL]);
+    _second_half_descriptor = _descriptor_section[WATCH_ADC_DMA_CHANNEL];
+    hri_dmacdescriptor_write_DSTADDR_reg(&_second_half_descriptor, (uint32_t)(buffer + length));
+    hri_dmacdescriptor_write_DESCADDR_reg(&_descriptor_section[WATCH_ADC_DMA_CHANNEL], (uint32_t)&_second_half_descriptor);
+    hri_dmacdescriptor_write_DESCADDR_reg(&_second_half_descriptor, (uint32_t)&_descriptor_section[WATCH_ADC_DMA_CHANNEL]);
+    _dma_get_channel_resource(&resource, WATCH_ADC_DMA_CHANNEL);
+    resource->dma_cb.transfer_done = _watch_adc_dma_done;
+    resource->dma_cb.error = _watch_adc_dma_error;
+    _dma_set_irq_state(WATCH_ADC_DMA_CHANNEL, DMA_TRANSFER_COMPLETE_CB, true);
+    _dma_set_irq_state(WATCH_ADC_DMA_CHANNEL, DMA_TRANSFER_ERROR_CB, true);
+    _dma_enable_transaction(WATCH_ADC_DMA_CHANNEL, false);
+
+    // finally, route the RTC's periodic event to the ADC. asynchronous, so it needs no clock of its own.
+    MCLK->APBCMASK.reg |= MCLK_APBCMASK_EVSYS;
+    EVSYS->CHANNEL[WATCH_ADC_EVSYS_CHANNEL].reg = EVSYS_CHANNEL_EVGEN(EVSYS_ID_GEN_RTC_PER_0 + per_n) | EVSYS_CHANNEL_PATH_ASYNCHRONOUS;
+    // user multiplexers count channels from 1; 0 means none.
+    EVSYS->USER[EVSYS_ID_USER_ADC_START].reg = EVSYS_USER_CHANNEL(WATCH_ADC_EVSYS_CHANNEL + 1);
+
+    return true;
+}
+
+void watch_adc_stop_background_sampling(void) {
+    if (!_background.running) return;
+
+    EVSYS->USER[EVSYS_ID_USER_ADC_START].reg = 0;
+    EVSYS->CHANNEL[WATCH_ADC_EVSYS_CHANNEL].reg = 0;
+
+    hri_dmac_write_CHID_reg(DMAC, WATCH_ADC_DMA_CHANNEL);
+    hri_dmac_clear_CHCTRLA_ENABLE_bit(DMAC);
+    while (hri_dmac_get_CHCTRLA_ENABLE_bit(DMAC));
+    hri_dmacdescriptor_write_DESCADDR_reg(&_descriptor_section[WATCH_ADC_DMA_CHANNEL], 0);
+
+    ADC->CTRLA.bit.ENABLE = 0;
+    _watch_sync_adc();
+    ADC->EVCTRL.reg = 0;
+    ADC->CTRLA.reg &= ~(ADC_CTRLA_RUNSTDBY | ADC_CTRLA_ONDEMAND);
+    SUPC->VREF.reg &= ~(SUPC_VREF_RUNSTDBY | SUPC_VREF_ONDEMAND);
+    GCLK->PCHCTRL[ADC_GCLK_ID].reg = GCLK_PCHCTRL_GEN_GCLK0 | GCLK_PCHCTRL_CHEN;
+    GCLK->GENCTRL[WATCH_ADC_GCLK_GENERATOR].reg = 0;
+    OSCCTRL->OSC16MCTRL.bit.RUNSTDBY = 0;
+    ADC->CTRLB.bit.PRESCALER = _watch_get_adc_prescaler();
+    _background.running = false;
+    ADC->CTRLA.bit.ENABLE = 1;
+    _watch_sync_adc();
+}
+
+bool watch_adc_is_background_sampling(void) {
+    return _background.running;
+}
+
 inline void watch_disable_adc(void) {
+    watch_adc_stop_background_sampling();
+
     ADC->CTRLA.bit.ENABLE = 0;
     _watch_sync_adc();
 
@@ -23,26 +23,184 @@
  */
 
 #include "watch_i2c.h"
+#include "hpl_sercom_config.h"
 
 struct io_descriptor *I2C_0_io;
 
+// Queued transactions run from the SERCOM's interrupt: each master-on-bus (MB) flag means the address or a byte
+// went out, each slave-on-bus (SB) flag means a byte came in. Smart mode is on, so reading DATA acknowledges the
+// byte and starts the next one. The head of the queue is the transaction on the bus.
+#define WATCH_I2C_INTERRUPTS (SERCOM_I2CM_INTENSET_MB | SERCOM_I2CM_INTENSET_SB | SERCOM_I2CM_INTENSET_ERROR)
+
+static watch_i2c_transaction_t *_queue_head;
+static watch_i2c_transaction_t *_queue_tail;
+static uint16_t _position;
+static bool _reading;
+
+static void _watch_i2c_send_address(void) {
+    watch_i2c_transaction_t *transaction = _queue_head;
+    uint32_t hs = hri_sercomi2cm_read_ADDR_reg(SERCOM1) & SERCOM_I2CM_ADDR_HS;
+
+    // same as the ASF driver: with SCL low time-out on (SCLSM), the NACK has to be set one byte early.
+    if (_reading && transaction->read_length == 1 && hri_sercomi2cm_get_CTRLA_SCLSM_bit(SERCOM1)) {
+        hri_sercomi2cm_set_CTRLB_ACKACT_bit(SERCOM1);
+    } else {
+        hri_sercomi2cm_clear_CTRLB_ACKACT_bit(SERCOM1);
+    }
+    // while we own the bus, this is a repeated start.
+    hri_sercomi2cm_write_ADDR_reg(SERCOM1, ((transaction->addr & 0x7F) << 1) | (_reading ? I2C_M_RD : 0) | hs);
+}
+
+static void _watch_i2c_start_next(void) {
+    watch_i2c_transaction_t *transaction = _queue_head;
+
+    if (transaction == NULL) {
+        hri_sercomi2cm_clear_INTEN_reg(SERCOM1, WATCH_I2C_INTERRUPTS);
+        return;
+    }
+
+    _position = 0;
+    _reading = transaction->write_length == 0 && transaction->read_length != 0;
+    hri_sercomi2cm_set_CTRLB_SMEN_bit(SERCOM1);
+    _watch_i2c_send_address();
+}
+
+static void _watch_i2c_finish(bool failed, bool stop) {
+    watch_i2c_transaction_t *transaction = _queue_head;
+
+    if (stop) hri_sercomi2cm_set_CTRLB_CMD_bf(SERCOM1, 3);
+
+    _queue_head = transaction->next;
+    if (_queue_head == NULL) _queue_tail = NULL;
+    transaction->next = NULL;
+    transaction->failed = failed;
+    transaction->busy = false;
+
+    // get the next one going first, in case the callback waits on the bus.
+    _watch_i2c_start_next();
+    if (transaction->callback) transaction->callback(transaction);
+}
+
+static void _watch_i2c_service(void) {
+    watch_i2c_transaction_t *transaction = _queue_head;
+    uint8_t flags = hri_sercomi2cm_read_INTFLAG_reg(SERCOM1);
+    uint16_t status = hri_sercomi2cm_read_STATUS_reg(SERCOM1);
+
+    if (transaction == NULL) {
+        hri_sercomi2cm_clear_INTFLAG_reg(SERCOM1, flags);
+        return;
+    }
+
+    if (flags & SERCOM_I2CM_INTFLAG_ERROR) {
+        hri_sercomi2cm_clear_INTFLAG_reg(SERCOM1, SERCOM_I2CM_INTFLAG_ERROR);
+        hri_sercomi2cm_clear_INTFLAG_reg(SERCOM1, SERCOM_I2CM_INTFLAG_MB | SERCOM_I2CM_INTFLAG_SB);
+        _watch_i2c_finish(true, !(status & SERCOM_I2CM_STATUS_ARBLOST));
+    } else if (flags & SERCOM_I2CM_INTFLAG_MB) {
+        if (status & SERCOM_I2CM_STATUS_ARBLOST) {
+            // someone else has the bus, or it's broken; either way, we don't get to send a stop.
+            hri_sercomi2cm_clear_INTFLAG_reg(SERCOM1, SERCOM_I2CM_INTFLAG_MB);
+            _watch_i2c_finish(true, false);
+        } else if (status & SERCOM_I2CM_STATUS_RXNACK) {
+            // the device didn't answer its address, or refused a byte.
+            _watch_i2c_finish(true, true);
+        } else if (!_reading && _position < transaction->write_length) {
+            hri_sercomi2cm_write_DATA_reg(SERCOM1, transaction->write_buf[_position++]);
+        } else if (!_reading && transaction->read_length != 0) {
+            _position = 0;
+            _reading = true;
+            _watch_i2c_send_address();
+        } else {
+            _watch_i2c_finish(false, true);
+        }
+    } else if (flags & SERCOM_I2CM_INTFLAG_SB) {
+        uint16_t remaining = transaction->read_length - _position - 1;
+        bool sclsm = hri_sercomi2cm_get_CTRLA_SCLSM_bit(SERCOM1);
+
+        // NACK the last byte, then stop; the read below is what makes it happen.
+        if ((remaining == 0 && !sclsm) || (remaining == 1 && sclsm)) hri_sercomi2cm_set_CTRLB_ACKACT_bit(SERCOM1);
+        if (remaining == 0) {
+            hri_sercomi2cm_clear_CTRLB_SMEN_bit(SERCOM1);
+            hri_sercomi2cm_set_CTRLB_CMD_bf(SERCOM1, 3);
+        }
+        transaction->read_buf[_position++] = hri_sercomi2cm_read_DATA_reg(SERCOM1);
+        hri_sercomi2cm_clear_INTFLAG_reg(SERCOM1, SERCOM_I2CM_INTFLAG_SB);
+        if (remaining == 0) _watch_i2c_finish(false, false);
+    }
+}
+
+void SERCOM1_Handler(void) {
+    _watch_i2c_service();
+}
+
+static void _watch_i2c_wait_until_idle(void) {
+    // from an interrupt handler, the SERCOM's own interrupt may not be able to preempt us, so run it by hand.
+    while (_queue_head != NULL) {
+        if (__get_IPSR()) {
+            if (hri_sercomi2cm_read_INTFLAG_reg(SERCOM1) & WATCH_I2C_INTERRUPTS) _watch_i2c_service();
+        } else {
+            __disable_irq();
+            if (_queue_head != NULL) _watch_sleep_idle();
+            __enable_irq();
+        }
+    }
+}
+
+static uint16_t _watch_i2c_get_baud(void) {
+    // the same calculation as CONF_SERCOM_1_I2CM_BAUD_RATE in hpl_sercom_config.h, but for the current main clock.
+    uint32_t freq = watch_get_cpu_frequency();
+    uint32_t baudlow = ((freq - (CONF_SERCOM_1_I2CM_BAUD * 10U)
+                         - (CONF_SERCOM_1_I2CM_TRISE * (CONF_SERCOM_1_I2CM_BAUD / 100U) * (freq / 10000U) / 1000U)) * 10U + 5U)
+                       / (CONF_SERCOM_1_I2CM_BAUD * 10U);
+    if (baudlow > 0xFF * 2) return 0xFF;
+    if (baudlow <= 1) return 1;
+    if (baudlow & 0x1) return (baudlow / 2) + ((baudlow / 2 + 1) << 8);
+    return baudlow / 2;
+}
+
+void _watch_i2c_update_baud(void) {
+    if (!hri_mclk_get_APBCMASK_SERCOM1_bit(MCLK) || !hri_sercomi2cm_get_CTRLA_ENABLE_bit(SERCOM1)) return;
+
+    // BAUD is enable-protected, so let any queued transactions finish before taking the bus down.
+    _watch_i2c_wait_until_idle();
+    i2c_m_sync_disable(&I2C_0);
+    hri_sercomi2cm_write_BAUD_reg(SERCOM1, _watch_i2c_get_baud());
+    i2c_m_sync_enable(&I2C_0);
+}
+
 void watch_enable_i2c(void) {
     I2C_0_init();
+    hri_sercomi2cm_write_BAUD_reg(SERCOM1, _watch_i2c_get_baud());
     i2c_m_sync_get_io_descriptor(&I2C_0, &I2C_0_io);
     i2c_m_sync_enable(&I2C_0);
+    NVIC_ClearPendingIRQ(SERCOM1_IRQn);
+    NVIC_EnableIRQ(SERCOM1_IRQn);
 }
 
 void watch_disable_i2c(void) {
+    _watch_i2c_wait_until_idle();
+    NVIC_DisableIRQ(SERCOM1_IRQn);
     i2c_m_sync_disable(&I2C_0);
 	hri_mclk_clear_APBCMASK_SERCOM1_bit(MCLK);
 }
 
 void watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length) {
+    _watch_i2c_wait_until_idle();
+    if (!__get_IPSR()) {
+        watch_i2c_transaction_t transaction = { .addr = addr, .write_buf = buf, .write_length = length };
+        if (watch_i2c_submit(&transaction)) watch_i2c_wait(&transaction);
+        return;
+    }
     i2c_m_sync_set_periphaddr(&I2C_0, addr, I2C_M_SEVEN);
     io_write(I2C_0_io, buf, length);
 }
 
 void watch_i2c_receive(int16_t addr, uint8_t *buf, uint16_t length) {
+    _watch_i2c_wait_until_idle();
+    if (!__get_IPSR()) {
+        watch_i2c_transaction_t transaction = { .addr = addr, .read_buf = buf, .read_length = length };
+        if (watch_i2c_submit(&transaction)) watch_i2c_wait(&transaction);
+        return;
+    }
     i2c_m_sync_set_periphaddr(&I2C_0, addr, I2C_M_SEVEN);
     io_read(I2C_0_io, buf, length);
 }
@@ -91,3 +249,44 @@ uint32_t watch_i2c_read32(int16_t addr, uint8_t reg) {
 
     return data;
 }
+
+bool watch_i2c_submit(watch_i2c_transaction_t *transaction) {
+    if (!hri_mclk_get_APBCMASK_SERCOM1_bit(MCLK) || !hri_sercomi2cm_get_CTRLA_ENABLE_bit(SERCOM1)) return false;
+    if (transaction->busy) return false;
+
+    transaction->busy = true;
+    transaction->failed = false;
+    transaction->next = NULL;
+
+    __disable_irq();
+    if (_queue_tail != NULL) {
+        _queue_tail->next = transaction;
+        _queue_tail = transaction;
+    } else {
+        _queue_head = _queue_tail = transaction;
+        hri_sercomi2cm_clear_INTFLAG_reg(SERCOM1, WATCH_I2C_INTERRUPTS);
+        hri_sercomi2cm_set_INTEN_reg(SERCOM1, WATCH_I2C_INTERRUPTS);
+        _watch_i2c_start_next();
+    }
+    __enable_irq();
+
+    return true;
+}
+
+bool watch_i2c_wait(watch_i2c_transaction_t *transaction) {
+    while (transaction->busy) {
+        if (__get_IPSR()) {
+            if (hri_sercomi2cm_read_INTFLAG_reg(SERCOM1) & WATCH_I2C_INTERRUPTS) _watch_i2c_service();
+        } else {
+            __disable_irq();
+            if (transaction->busy) _watch_sleep_idle();
+            __enable_irq();
+        }
+    }
+
+    return !transaction->failed;
+}
+
+bool watch_i2c_is_busy(void) {
+    return _queue_head != NULL;
+}
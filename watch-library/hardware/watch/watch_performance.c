@@ -0,0 +1,80 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_performance.h"
+#include "watch_private.h"
+
+static watch_performance_level_t _performance_level = WATCH_PERFORMANCE_LEVEL_LOW;
+
+static void _watch_set_main_clock(uint8_t fsel) {
+    hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, fsel);
+    while (!hri_oscctrl_get_STATUS_OSC16MRDY_bit(OSCCTRL));
+}
+
+void watch_set_performance_level(watch_performance_level_t level) {
+    if (level == _performance_level) return;
+
+    // the regulator stays at PL2, where _init_chip leaves it, at both levels: USB and the DFLL that clocks it
+    // need PL2, and it already covers 16 MHz. so only the clock and the flash wait states change here.
+    switch (level) {
+        case WATCH_PERFORMANCE_LEVEL_HIGH:
+            // going up: the flash wait states have to be ready before the clock speeds up.
+            // one wait state is enough for 16 MHz across the whole supply voltage range.
+            hri_nvmctrl_write_CTRLB_RWS_bf(NVMCTRL, 1);
+            _watch_set_main_clock(OSCCTRL_OSC16MCTRL_FSEL_16_Val);
+            break;
+        case WATCH_PERFORMANCE_LEVEL_LOW:
+            // going down: slow the clock first, then drop the wait state.
+            if (watch_is_usb_enabled()) _watch_set_main_clock(OSCCTRL_OSC16MCTRL_FSEL_8_Val);
+            else _watch_set_main_clock(OSCCTRL_OSC16MCTRL_FSEL_4_Val);
+            hri_nvmctrl_write_CTRLB_RWS_bf(NVMCTRL, 0);
+            break;
+    }
+    _performance_level = level;
+
+    // now correct the prescalers of everything that runs from the main clock.
+    _watch_adc_update_prescaler();
+    _watch_tcc_update_prescaler();
+    _watch_update_usb_task_timers();
+    _watch_i2c_update_baud();
+    _watch_spi_update_baud();
+    _watch_uart_update_baud();
+}
+
+watch_performance_level_t watch_get_performance_level(void) {
+    return _performance_level;
+}
+
+uint32_t watch_get_cpu_frequency(void) {
+    switch (hri_oscctrl_read_OSC16MCTRL_FSEL_bf(OSCCTRL)) {
+        case OSCCTRL_OSC16MCTRL_FSEL_8_Val:
+            return 8000000;
+        case OSCCTRL_OSC16MCTRL_FSEL_12_Val:
+            return 12000000;
+        case OSCCTRL_OSC16MCTRL_FSEL_16_Val:
+            return 16000000;
+        default:
+            return 4000000;
+    }
+}
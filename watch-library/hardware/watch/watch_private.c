@@ -94,11 +94,16 @@ static inline void _watch_wait_for_entropy() {
     while (!hri_trng_get_INTFLAG_reg(TRNG, TRNG_INTFLAG_DATARDY));
 }
 
-// this function is called by arc4random to get entropy for random number generation.
-int getentropy(void *buf, size_t buflen);
+// entropy collected in the background for watch_random.
+#define WATCH_ENTROPY_POOL_WORDS 8
+static volatile uint32_t _entropy_pool[WATCH_ENTROPY_POOL_WORDS];
+static volatile uint8_t _entropy_pool_count = 0;
+static volatile bool _entropy_pending = false;
 
 // let's use the SAM L22's true random number generator to seed the PRNG!
 int getentropy(void *buf, size_t buflen) {
+    // if a background request is in progress, the TRNG is already on; keep its interrupt from stealing our words.
+    NVIC_DisableIRQ(TRNG_IRQn);
     hri_mclk_set_APBCMASK_TRNG_bit(MCLK);
     hri_trng_set_CTRLA_ENABLE_bit(TRNG);
 
@@ -118,12 +123,52 @@ int getentropy(void *buf, size_t buflen) {
         }
     }
 
-    watch_disable_TRNG();
-    hri_mclk_clear_APBCMASK_TRNG_bit(MCLK);
+    if (_entropy_pending) {
+        NVIC_EnableIRQ(TRNG_IRQn);
+    } else {
+        watch_disable_TRNG();
+        hri_mclk_clear_APBCMASK_TRNG_bit(MCLK);
+    }
 
     return 0;
 }
 
+void _watch_request_entropy(void) {
+    if (_entropy_pending || _entropy_pool_count == WATCH_ENTROPY_POOL_WORDS) return;
+
+    _entropy_pending = true;
+    _entropy_pool_count = 0;
+    hri_mclk_set_APBCMASK_TRNG_bit(MCLK);
+    hri_trng_set_INTEN_DATARDY_bit(TRNG);
+    NVIC_ClearPendingIRQ(TRNG_IRQn);
+    NVIC_EnableIRQ(TRNG_IRQn);
+    hri_trng_set_CTRLA_ENABLE_bit(TRNG);
+}
+
+bool _watch_take_entropy(uint32_t buf[8]) {
+    if (_entropy_pending || _entropy_pool_count < WATCH_ENTROPY_POOL_WORDS) return false;
+
+    for(uint8_t i = 0; i < WATCH_ENTROPY_POOL_WORDS; i++) {
+        buf[i] = _entropy_pool[i];
+        _entropy_pool[i] = 0;
+    }
+    _entropy_pool_count = 0;
+
+    return true;
+}
+
+void TRNG_Handler(void) {
+    // reading DATA clears the DATARDY flag.
+    _entropy_pool[_entropy_pool_count++] = hri_trng_read_DATA_reg(TRNG);
+    if (_entropy_pool_count == WATCH_ENTROPY_POOL_WORDS) {
+        NVIC_DisableIRQ(TRNG_IRQn);
+        hri_trng_clear_INTEN_DATARDY_bit(TRNG);
+        watch_disable_TRNG();
+        hri_mclk_clear_APBCMASK_TRNG_bit(MCLK);
+        _entropy_pending = false;
+    }
+}
+
 void watch_disable_TRNG(void);
 void watch_disable_TRNG(void) {
     // per Microchip datasheet clarification DS80000782,
@@ -134,8 +179,34 @@ void watch_disable_TRNG(void) {
 }
 
 
+static uint8_t _watch_get_tcc_prescaler(void) {
+    switch (watch_get_cpu_frequency()) {
+        case 16000000:
+            return TCC_CTRLA_PRESCALER_DIV16_Val;
+        case 8000000:
+            // i.e. USB is enabled.
+            return TCC_CTRLA_PRESCALER_DIV8_Val;
+        default:
+            return TCC_CTRLA_PRESCALER_DIV4_Val;
+    }
+}
+
+void _watch_tcc_update_prescaler(void) {
+    if (!hri_mclk_get_APBCMASK_TCC0_bit(MCLK)) return;
+
+    // the prescaler is enable-protected; PER and CC survive the round trip, so the buzzer tone and LED color are kept.
+    bool was_enabled = hri_tcc_get_CTRLA_ENABLE_bit(TCC0);
+    hri_tcc_clear_CTRLA_ENABLE_bit(TCC0);
+    hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_ENABLE);
+    hri_tcc_write_CTRLA_PRESCALER_bf(TCC0, _watch_get_tcc_prescaler());
+    if (was_enabled) {
+        hri_tcc_set_CTRLA_ENABLE_bit(TCC0);
+        hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_ENABLE);
+    }
+}
+
 void _watch_enable_tcc(void) {
-    // clock TCC0 with the main clock (8 MHz) and enable the peripheral clock.
+    // clock TCC0 with the main clock and enable the peripheral clock.
     hri_gclk_write_PCHCTRL_reg(GCLK, TCC0_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK0_Val | GCLK_PCHCTRL_CHEN);
     hri_mclk_set_APBCMASK_TCC0_bit(MCLK);
     // disable and reset TCC0.
@@ -144,13 +215,7 @@ void _watch_enable_tcc(void) {
     hri_tcc_write_CTRLA_reg(TCC0, TCC_CTRLA_SWRST);
     hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_SWRST);
     // divide the clock down to 1 MHz
-    if (hri_usbdevice_get_CTRLA_ENABLE_bit(USB)) {
-        // if USB is enabled, we are running an 8 MHz clock.
-        hri_tcc_write_CTRLA_reg(TCC0, TCC_CTRLA_PRESCALER_DIV8);
-    } else {
-        // otherwise it's 4 Mhz.
-        hri_tcc_write_CTRLA_reg(TCC0, TCC_CTRLA_PRESCALER_DIV4);
-    }
+    hri_tcc_write_CTRLA_reg(TCC0, TCC_CTRLA_PRESCALER(_watch_get_tcc_prescaler()));
     // We're going to use normal PWM mode, which means period is controlled by PER, and duty cycle is controlled by
     // each compare channel's value:
     //  * Buzzer tones are set by setting PER to the desired period for a given frequency, and CC[1] to half of that
@@ -208,6 +273,18 @@ void _watch_disable_tcc(void) {
     hri_mclk_clear_APBCMASK_TCC0_bit(MCLK);
 }    
 
+static uint8_t _watch_get_usb_task_period(uint8_t period) {
+    // the task timer periods below assume the 8 MHz clock we run at with USB enabled; scale them if we're faster.
+    return ((uint32_t)period * watch_get_cpu_frequency()) / 8000000;
+}
+
+void _watch_update_usb_task_timers(void) {
+    if (!hri_usbdevice_get_CTRLA_ENABLE_bit(USB)) return;
+
+    hri_tccount8_write_PER_reg(TC0, _watch_get_usb_task_period(10));
+    hri_tccount8_write_PER_reg(TC1, _watch_get_usb_task_period(20));
+}
+
 void _watch_enable_tc0(void) {
     // before we init TinyUSB, we are going to need a periodic callback to handle TinyUSB tasks.
     // TC2 and TC3 are reserved for devices on the 9-pin connector, so let's use TC0.
@@ -223,7 +300,7 @@ void _watch_enable_tc0(void) {
     hri_tc_write_CTRLA_reg(TC0, TC_CTRLA_PRESCALER_DIV1024 | // divide the 8 MHz clock by 1024 to count at 7812.5 Hz
                                 TC_CTRLA_MODE_COUNT8 |       // count in 8-bit mode
                                 TC_CTRLA_RUNSTDBY);          // run in standby, just in case we figure that out
-    hri_tccount8_write_PER_reg(TC0, 10);                     // 7812.5 Hz / 10 = 781.125 Hz
+    hri_tccount8_write_PER_reg(TC0, _watch_get_usb_task_period(10)); // 7812.5 Hz / 10 = 781.125 Hz
     // set an interrupt on overflow; this will call TC0_Handler below.
     hri_tc_set_INTEN_OVF_bit(TC0);
 
@@ -257,7 +334,7 @@ void _watch_enable_tc1(void) {
     hri_tc_write_CTRLA_reg(TC1, TC_CTRLA_PRESCALER_DIV1024 | // divide the 8 MHz clock by 1024 to count at 7812.5 Hz
                                 TC_CTRLA_MODE_COUNT8 |       // count in 8-bit mode
                                 TC_CTRLA_RUNSTDBY);          // run in standby, just in case we figure that out
-    hri_tccount8_write_PER_reg(TC1, 20);                     // 7812.5 Hz / 50 = 156.25 Hz
+    hri_tccount8_write_PER_reg(TC1, _watch_get_usb_task_period(20)); // 7812.5 Hz / 50 = 156.25 Hz
     // set an interrupt on overflow; this will call TC1_Handler below.
     hri_tc_set_INTEN_OVF_bit(TC1);
 
@@ -412,15 +489,21 @@ uint8_t const * tud_descriptor_device_cb(void) {
 enum {
   ITF_NUM_CDC = 0,
   ITF_NUM_CDC_DATA,
+#if CFG_TUD_MSC
+  ITF_NUM_MSC,
+#endif
   ITF_NUM_TOTAL
 };
 
-#define CONFIG_TOTAL_LEN    (TUD_CONFIG_DESC_LEN + TUD_CDC_DESC_LEN)
+#define CONFIG_TOTAL_LEN    (TUD_CONFIG_DESC_LEN + TUD_CDC_DESC_LEN + CFG_TUD_MSC * TUD_MSC_DESC_LEN)
 
 #define EPNUM_CDC_NOTIF   0x81
 #define EPNUM_CDC_OUT     0x02
 #define EPNUM_CDC_IN      0x82
 
+#define EPNUM_MSC_OUT     0x03
+#define EPNUM_MSC_IN      0x83
+
 
 uint8_t const desc_fs_configuration[] = {
   // Config number, interface count, string index, total length, attribute, power in mA
@@ -428,6 +511,11 @@ uint8_t const desc_fs_configuration[] = {
 
   // Interface number, string index, EP notification address and size, EP data address (out, in) and size.
   TUD_CDC_DESCRIPTOR(ITF_NUM_CDC, 4, EPNUM_CDC_NOTIF, 8, EPNUM_CDC_OUT, EPNUM_CDC_IN, 64),
+
+#if CFG_TUD_MSC
+  // Interface number, string index, EP Out & EP In address, EP size
+  TUD_MSC_DESCRIPTOR(ITF_NUM_MSC, 5, EPNUM_MSC_OUT, EPNUM_MSC_IN, 64),
+#endif
 };
 
 // Invoked when received GET CONFIGURATION DESCRIPTOR
@@ -450,6 +538,7 @@ char const* string_desc_arr [] =
   "TinyUSB Device",              // 2: Product
   "123456",                      // 3: Serials, should use chip ID
   "TinyUSB CDC",                 // 4: CDC Interface
+  "TinyUSB MSC",                 // 5: MSC Interface
 };
 
 static uint16_t _desc_str[32];
@@ -489,3 +578,12 @@ uint16_t const* tud_descriptor_string_cb(uint8_t index, uint16_t langid)
 
     return _desc_str;
 }
+
+void _watch_sleep_idle(void) {
+    // hal_sleep's sleep() only takes the IDLE, STANDBY, BACKUP and OFF modes, so set IDLE0 directly.
+    PM->SLEEPCFG.reg = PM_SLEEPCFG_SLEEPMODE_IDLE0;
+    // the write has to land before the WFI, or we'd sleep in whatever mode was there before.
+    while (PM->SLEEPCFG.reg != PM_SLEEPCFG_SLEEPMODE_IDLE0);
+    __DSB();
+    __WFI();
+}
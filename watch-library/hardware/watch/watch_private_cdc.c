@@ -26,8 +26,10 @@
 #include "watch_private_cdc.h"
 
 #include <stddef.h>
+#include <string.h>
 
 #include "watch_utility.h"
+#include "hal_delay.h"
 #include "tusb.h"
 
 /*
@@ -45,6 +47,12 @@ static char s_write_buf[CDC_WRITE_BUF_SZ] = {0};
 static size_t s_write_buf_pos = 0;
 static size_t s_write_buf_len = 0;
 
+// Bytes are handed to TinyUSB in chunks of up to one full-speed bulk packet.
+#define CDC_WRITE_CHUNK_SZ  (64)
+// If the host has the port open but stops reading, give up on a blocked
+// write after this long without progress, rather than hang the watch.
+#define CDC_WRITE_TIMEOUT_MS  (500)
+
 #define CDC_READ_BUF_SZ  (256)
 #define CDC_READ_BUF_IDX(x)  ((x) & (CDC_READ_BUF_SZ - 1))
 static char s_read_buf[CDC_READ_BUF_SZ] = {0};
@@ -61,6 +69,29 @@ static inline void prv_critical_section_exit(void) {
     NVIC_EnableIRQ(TC1_IRQn);
 }
 
+// Copies as much of ptr as fits into the write buffer. Must be called with
+// TC1 interrupts masked.
+static size_t prv_buffer_write(const char *ptr, size_t len) {
+    size_t written = 0;
+
+    while (written < len && s_write_buf_len < CDC_WRITE_BUF_SZ) {
+        // copy the contiguous free space up to the end of the ring in one go
+        size_t chunk = CDC_WRITE_BUF_SZ - s_write_buf_pos;
+        if (chunk > CDC_WRITE_BUF_SZ - s_write_buf_len) {
+            chunk = CDC_WRITE_BUF_SZ - s_write_buf_len;
+        }
+        if (chunk > len - written) {
+            chunk = len - written;
+        }
+        memcpy(&s_write_buf[s_write_buf_pos], &ptr[written], chunk);
+        s_write_buf_pos = CDC_WRITE_BUF_IDX(s_write_buf_pos + chunk);
+        s_write_buf_len += chunk;
+        written += chunk;
+    }
+
+    return written;
+}
+
 int _write(int file, char *ptr, int len) {
     (void) file;
 
@@ -68,22 +99,37 @@ int _write(int file, char *ptr, int len) {
         return -1;
     }
 
-    int bytes_written = 0;
+    size_t bytes_written = 0;
+    uint16_t idle_ms = 0;
 
     prv_critical_section_enter();
-
-    for (int i = 0; i < len; i++) {
-        s_write_buf[s_write_buf_pos] = ptr[i];
-        s_write_buf_pos = CDC_WRITE_BUF_IDX(s_write_buf_pos + 1);
-        if (s_write_buf_len < CDC_WRITE_BUF_SZ) {
-            s_write_buf_len++;
+    bytes_written = prv_buffer_write(ptr, len);
+
+    // When the buffer is full, wait for the host to drain it instead of
+    // dropping data. We can only wait if a terminal is actually reading, and
+    // if we aren't in an interrupt handler; otherwise return a short write.
+    while (bytes_written < (size_t) len && __get_IPSR() == 0 && tud_cdc_connected()) {
+        const size_t buffered = s_write_buf_len;
+        // TC1 is masked, so pump the buffer ourselves rather than waiting
+        // for the next cdc_task() tick.
+        cdc_task();
+        if (s_write_buf_len == buffered) {
+            // The TX FIFO is full; give the host a moment to read it.
+            prv_critical_section_exit();
+            delay_ms(1);
+            prv_critical_section_enter();
+            if (++idle_ms >= CDC_WRITE_TIMEOUT_MS) {
+                break;
+            }
+        } else {
+            idle_ms = 0;
         }
-        bytes_written++;
+        bytes_written += prv_buffer_write(&ptr[bytes_written], len - bytes_written);
     }
 
     prv_critical_section_exit();
 
-    return bytes_written;
+    return bytes_written > 0 ? (int) bytes_written : -1;
 }
 
 int _read(int file, char *ptr, int len) {
@@ -133,23 +179,39 @@ static void prv_handle_reads(void) {
 }
 
 static void prv_handle_writes(void) {
-    if (s_write_buf_len > 0) {
+    bool wrote = false;
+
+    while (s_write_buf_len > 0) {
+        if (tud_cdc_available() > 0) {
+            // If we receive data while doing a large write, we need to
+            // fully service it before continuing to write, or the
+            // stack will crash.
+            prv_handle_reads();
+        }
+
+        // The oldest data runs from start_pos to either the newest data or
+        // the end of the ring, whichever comes first.
         const size_t start_pos =
             CDC_WRITE_BUF_IDX(s_write_buf_pos - s_write_buf_len);
-        for (size_t i = 0; i < (size_t) s_write_buf_len; i++) {
-            const size_t idx = CDC_WRITE_BUF_IDX(start_pos + i);
-            if (tud_cdc_available() > 0) {
-                // If we receive data while doing a large write, we need to
-                // fully service it before continuing to write, or the
-                // stack will crash.
-                prv_handle_reads();
-            }
-            if (tud_cdc_write_available()) {
-                tud_cdc_write(&s_write_buf[idx], 1);
-            }
-            s_write_buf[idx] = 0;
-            s_write_buf_len--;
+        size_t chunk = CDC_WRITE_BUF_SZ - start_pos;
+        if (chunk > s_write_buf_len) {
+            chunk = s_write_buf_len;
+        }
+        if (chunk > CDC_WRITE_CHUNK_SZ) {
+            chunk = CDC_WRITE_CHUNK_SZ;
         }
+
+        // Whatever doesn't fit in the TX FIFO stays in the buffer for the
+        // next call.
+        uint32_t sent = tud_cdc_write(&s_write_buf[start_pos], chunk);
+        if (sent == 0) {
+            break;
+        }
+        s_write_buf_len -= sent;
+        wrote = true;
+    }
+
+    if (wrote) {
         tud_cdc_write_flush();
     }
 }
@@ -23,11 +23,101 @@
  */
 
 #include "watch_spi.h"
+#include "hpl_dma.h"
+#include "hpl_sercom_config.h"
+
+// Longer transfers go through the DMA controller: channel 0 feeds the SERCOM's DATA register from memory, and
+// channel 1 empties it into memory, one byte per trigger. Both are configured in hpl_dmac_config.h. The receive
+// channel has the higher priority so the incoming byte is always taken before the next one goes out, and since it
+// finishes last, its completion interrupt marks the end of the whole transfer. For a few bytes, setting up the
+// channels costs more than the byte loop.
+#define WATCH_SPI_DMA_TX_CHANNEL 0
+#define WATCH_SPI_DMA_RX_CHANNEL 1
+#define WATCH_SPI_DMA_MIN_LENGTH 16
 
 struct io_descriptor *spi_io;
 
+static volatile bool _dma_busy;
+static volatile bool _dma_error;
+// the far end of the transfer when there's nothing to send (clock out 0xFF) or nothing to keep.
+static const uint8_t _dma_fill = 0xFF;
+static uint8_t _dma_sink;
+
+static void _watch_spi_dma_done(struct _dma_resource *resource) {
+    (void) resource;
+    _dma_busy = false;
+}
+
+static void _watch_spi_dma_error(struct _dma_resource *resource) {
+    (void) resource;
+    _dma_error = true;
+    _dma_busy = false;
+}
+
+static bool _watch_spi_dma_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t length) {
+    void *data_reg = (void *)&SERCOM3->SPI.DATA.reg;
+    struct _dma_resource *resource;
+
+    // with the SERCOM off, the triggers would never come.
+    if (spi_io == NULL) return false;
+
+    // anything left over from the byte loop would be taken as the first byte received.
+    while (SERCOM3->SPI.INTFLAG.bit.RXC) (void)SERCOM3->SPI.DATA.reg;
+    SERCOM3->SPI.STATUS.reg = SERCOM_SPI_STATUS_BUFOVF;
+
+    // the increment bits have to be set before the amount, which moves incrementing addresses to the end of the block.
+    _dma_set_source_address(WATCH_SPI_DMA_RX_CHANNEL, data_reg);
+    _dma_set_destination_address(WATCH_SPI_DMA_RX_CHANNEL, data_in ? data_in : &_dma_sink);
+    _dma_dstinc_enable(WATCH_SPI_DMA_RX_CHANNEL, data_in != NULL);
+    _dma_set_data_amount(WATCH_SPI_DMA_RX_CHANNEL, length);
+    _dma_get_channel_resource(&resource, WATCH_SPI_DMA_RX_CHANNEL);
+    resource->dma_cb.transfer_done = _watch_spi_dma_done;
+    resource->dma_cb.error = _watch_spi_dma_error;
+    _dma_set_irq_state(WATCH_SPI_DMA_RX_CHANNEL, DMA_TRANSFER_COMPLETE_CB, true);
+    _dma_set_irq_state(WATCH_SPI_DMA_RX_CHANNEL, DMA_TRANSFER_ERROR_CB, true);
+
+    _dma_set_source_address(WATCH_SPI_DMA_TX_CHANNEL, data_out ? data_out : &_dma_fill);
+    _dma_set_destination_address(WATCH_SPI_DMA_TX_CHANNEL, data_reg);
+    _dma_srcinc_enable(WATCH_SPI_DMA_TX_CHANNEL, data_out != NULL);
+    _dma_set_data_amount(WATCH_SPI_DMA_TX_CHANNEL, length);
+    // its interrupts stay off, but the handler calls whatever is there if one is ever pending.
+    _dma_get_channel_resource(&resource, WATCH_SPI_DMA_TX_CHANNEL);
+    resource->dma_cb.transfer_done = _watch_spi_dma_done;
+    resource->dma_cb.error = _watch_spi_dma_error;
+
+    _dma_error = false;
+    _dma_busy = true;
+    _dma_enable_transaction(WATCH_SPI_DMA_RX_CHANNEL, false);
+    _dma_enable_transaction(WATCH_SPI_DMA_TX_CHANNEL, false);
+
+    // the CPU has nothing to do until the last byte is in, so idle; the DMA controller and SERCOM keep running.
+    while (_dma_busy) {
+        __disable_irq();
+        if (_dma_busy) _watch_sleep_idle();
+        __enable_irq();
+    }
+
+    return !_dma_error;
+}
+
+static uint8_t _watch_spi_get_baud(void) {
+    // the same calculation as CONF_SERCOM_3_SPI_BAUD_RATE in hpl_sercom_config.h, but for the current main clock.
+    return watch_get_cpu_frequency() / (2 * CONF_SERCOM_3_SPI_BAUD) - 1;
+}
+
+void _watch_spi_update_baud(void) {
+    // SERCOM3 is shared with the UART; only touch it if it's running as our SPI master.
+    if (!hri_mclk_get_APBCMASK_SERCOM3_bit(MCLK) || !SERCOM3->SPI.CTRLA.bit.ENABLE) return;
+    if (SERCOM3->SPI.CTRLA.bit.MODE != 3) return;
+
+    spi_m_sync_disable(&SPI_0);
+    hri_sercomspi_write_BAUD_reg(SERCOM3, _watch_spi_get_baud());
+    spi_m_sync_enable(&SPI_0);
+}
+
 void watch_enable_spi(void) {
     SPI_0_init();
+    hri_sercomspi_write_BAUD_reg(SERCOM3, _watch_spi_get_baud());
     spi_m_sync_get_io_descriptor(&SPI_0, &spi_io);
     spi_m_sync_enable(&SPI_0);
 }
@@ -38,14 +128,17 @@ void watch_disable_spi(void) {
 }
 
 bool watch_spi_write(const uint8_t *buf, uint16_t length) {
+    if (length >= WATCH_SPI_DMA_MIN_LENGTH) return _watch_spi_dma_transfer(buf, NULL, length);
 	return !!io_write(spi_io, buf, length);
 }
 
 bool watch_spi_read(uint8_t *buf, uint16_t length) {
+    if (length >= WATCH_SPI_DMA_MIN_LENGTH) return _watch_spi_dma_transfer(NULL, buf, length);
 	return !!io_read(spi_io, buf, length);
 }
 
 bool watch_spi_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t length) {
+    if (length >= WATCH_SPI_DMA_MIN_LENGTH) return _watch_spi_dma_transfer(data_out, data_in, length);
     struct spi_xfer xfer;
     xfer.txbuf = (uint8_t *)data_out;
     xfer.rxbuf = data_in;
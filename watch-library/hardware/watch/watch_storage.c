@@ -7,6 +7,68 @@
 #define RWWEE_ADDR_END (NVMCTRL_RWW_EEPROM_ADDR + NVMCTRL_PAGE_SIZE * NVMCTRL_RWWEE_PAGES)
 #define NVM_MEMORY ((volatile uint16_t *)FLASH_ADDR)
 
+static volatile ext_irq_cb_t _callback;
+// set when a command is issued, and cleared once the controller is seen to be ready again. lets reads skip the
+// controller entirely in the common case where nothing has been written since the last one.
+static volatile bool _pending;
+// set when an operation fails, and cleared when watch_storage_sync reports it.
+static bool _failed;
+
+void NVMCTRL_Handler(void);
+void NVMCTRL_Handler(void) {
+    // READY stays set for as long as the controller is idle, so the interrupt has to be switched off once it fires.
+    hri_nvmctrl_clear_INTEN_READY_bit(NVMCTRL);
+    _pending = false;
+
+    ext_irq_cb_t callback = _callback;
+    _callback = NULL;
+    if (callback) callback();
+}
+
+static void _wait_for_ready(void) {
+    if (!_pending) return;
+
+    // from an interrupt handler, the NVMCTRL interrupt may not be able to wake us, so just spin.
+    if (__get_IPSR() != 0) {
+        while (!hri_nvmctrl_get_interrupt_READY_bit(NVMCTRL));
+        _pending = false;
+        return;
+    }
+
+    // otherwise, sleep until the controller is ready instead of spinning through a multi-millisecond erase.
+    // interrupts are masked so the READY interrupt can't slip in between the check and the WFI; a pending
+    // interrupt still wakes the core, and the handler runs as soon as they're unmasked. this is IDLE0 rather
+    // than STANDBY because the caller may be using peripherals that don't run in standby.
+    while (!hri_nvmctrl_get_interrupt_READY_bit(NVMCTRL)) {
+        __disable_irq();
+        NVIC_EnableIRQ(NVMCTRL_IRQn);
+        hri_nvmctrl_set_INTEN_READY_bit(NVMCTRL);
+        if (!hri_nvmctrl_get_interrupt_READY_bit(NVMCTRL)) _watch_sleep_idle();
+        __enable_irq();
+    }
+    _pending = false;
+}
+
+// waits for the last operation, and latches any error it left in STATUS before clearing it for the next one.
+// watch_storage_sync reports the latched error, so one async operation starting can't hide the last one failing.
+static void _finish_pending(void) {
+    _wait_for_ready();
+
+    if (hri_nvmctrl_read_STATUS_reg(NVMCTRL) & (NVMCTRL_STATUS_PROGE | NVMCTRL_STATUS_LOCKE | NVMCTRL_STATUS_NVME)) _failed = true;
+    hri_nvmctrl_clear_STATUS_reg(NVMCTRL, NVMCTRL_STATUS_MASK);
+}
+
+static void _start_command(uint32_t command, ext_irq_cb_t callback) {
+    _callback = callback;
+    _pending = true;
+    hri_nvmctrl_write_CTRLA_reg(NVMCTRL, command | NVMCTRL_CTRLA_CMDEX_KEY);
+    // the interrupt only needs to be on if someone is waiting for it.
+    if (callback) {
+        NVIC_EnableIRQ(NVMCTRL_IRQn);
+        hri_nvmctrl_set_INTEN_READY_bit(NVMCTRL);
+    }
+}
+
 static bool _is_valid_address(uint32_t addr, uint32_t size) {
     if ((addr < NVMCTRL_RWW_EEPROM_ADDR) || (addr > (NVMCTRL_RWW_EEPROM_ADDR + NVMCTRL_PAGE_SIZE * NVMCTRL_RWWEE_PAGES))) {
         return false;
@@ -22,12 +84,21 @@ bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t
     uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE + offset;
     if (!_is_valid_address(address, size)) return false;
 
+    // a read can't happen while the RWWEE section is busy, but it shouldn't clear an error from the last write either.
+    _wait_for_ready();
+
+    // the RWWEE section is memory mapped, so when everything is word aligned (as littlefs's reads are), just copy words.
+    if (((address | (uintptr_t)buffer | size) & 3) == 0) {
+        const volatile uint32_t *src = (const volatile uint32_t *)(uintptr_t)address;
+        uint32_t *dst = (uint32_t *)buffer;
+        for (uint32_t n = size / 4; n > 0; n--) *dst++ = *src++;
+        return true;
+    }
+
     uint32_t nvm_address = address / 2;
     uint32_t i;
     uint16_t data;
 
-    watch_storage_sync();
-
     if (address % 2) {
         data      = NVM_MEMORY[nvm_address++];
         buffer[0] = data >> 8;
@@ -48,16 +119,20 @@ bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t
 }
 
 bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
+    return watch_storage_write_async(row, offset, buffer, size, NULL);
+}
+
+bool watch_storage_write_async(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size, ext_irq_cb_t callback) {
     uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE + offset;
     if (!_is_valid_address(address, size)) return false;
 
-    watch_storage_sync();
+    _finish_pending();
 
     uint32_t nvm_address = address / 2;
     uint16_t i, data;
 
-    hri_nvmctrl_write_CTRLA_reg(NVMCTRL, NVMCTRL_CTRLA_CMD_PBC | NVMCTRL_CTRLA_CMDEX_KEY);
-    watch_storage_sync();
+    _start_command(NVMCTRL_CTRLA_CMD_PBC, NULL);
+    _wait_for_ready();
 
     for (i = 0; i < size; i += 2) {
         data = buffer[i];
@@ -67,28 +142,35 @@ bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, u
         NVM_MEMORY[nvm_address++] = data;
     }
     hri_nvmctrl_write_ADDR_reg(NVMCTRL, address / 2);
-    hri_nvmctrl_write_CTRLA_reg(NVMCTRL, NVMCTRL_CTRLA_CMD_RWWEEWP | NVMCTRL_CTRLA_CMDEX_KEY);
+    _start_command(NVMCTRL_CTRLA_CMD_RWWEEWP, callback);
 
     return true;
 }
 
 bool watch_storage_erase(uint32_t row) {
+    return watch_storage_erase_async(row, NULL);
+}
+
+bool watch_storage_erase_async(uint32_t row, ext_irq_cb_t callback) {
     uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE;
     if (!_is_valid_address(address, NVMCTRL_ROW_SIZE)) return false;
 
-    watch_storage_sync();
+    _finish_pending();
     hri_nvmctrl_write_ADDR_reg(NVMCTRL, address / 2);
-    hri_nvmctrl_write_CTRLA_reg(NVMCTRL, NVMCTRL_CTRLA_CMD_RWWEEER | NVMCTRL_CTRLA_CMDEX_KEY);
+    _start_command(NVMCTRL_CTRLA_CMD_RWWEEER, callback);
 
     return true;
 }
 
+bool watch_storage_is_busy(void) {
+    return _pending && !hri_nvmctrl_get_interrupt_READY_bit(NVMCTRL);
+}
+
 bool watch_storage_sync(void) {
-    while (!hri_nvmctrl_get_interrupt_READY_bit(NVMCTRL)) {
-        // wait for flash to become ready
-    }
+    _finish_pending();
 
-    hri_nvmctrl_clear_STATUS_reg(NVMCTRL, NVMCTRL_STATUS_MASK);
+    bool success = !_failed;
+    _failed = false;
 
-    return true;
+    return success;
 }
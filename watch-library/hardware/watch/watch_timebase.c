@@ -0,0 +1,249 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_timebase.h"
+#include "hal_atomic.h"
+
+#define WATCH_TIMEBASE_NO_COMPARE UINT64_MAX
+
+typedef struct {
+    bool registered;
+    uint64_t capture;
+    uint64_t compare;
+    ext_irq_cb_t callback;
+} watch_timebase_client_t;
+
+static watch_timebase_client_t _clients[WATCH_TIMEBASE_NUM_CLIENTS];
+static uint8_t _num_clients = 0;
+
+// the upper 48 bits of the timebase; incremented every time the 16-bit hardware counter overflows.
+static volatile uint64_t _overflows = 0;
+
+static inline bool _is_valid_client(int8_t client) {
+    return client >= 0 && client < WATCH_TIMEBASE_NUM_CLIENTS && _clients[client].registered;
+}
+
+static uint16_t _read_count(void) {
+    // the COUNT register has to be synchronized from the TC clock domain before we can read it.
+    TC2->COUNT16.CTRLBSET.reg = TC_CTRLBSET_CMD_READSYNC;
+    hri_tc_wait_for_sync(TC2, TC_SYNCBUSY_CTRLB);
+    while (TC2->COUNT16.CTRLBSET.bit.CMD);
+    return hri_tccount16_read_COUNT_reg(TC2);
+}
+
+// must be called with interrupts disabled.
+static uint64_t _now(void) {
+    uint64_t overflows = _overflows;
+    uint16_t count = _read_count();
+    if (hri_tc_get_interrupt_OVF_bit(TC2)) {
+        // the counter overflowed, but we haven't serviced the interrupt yet (either because we are in a critical
+        // section, or because we were called from a higher priority interrupt). account for it here, and read the
+        // count again in case we read it just before the overflow happened.
+        count = _read_count();
+        overflows++;
+    }
+
+    return (overflows << 16) | count;
+}
+
+// must be called with interrupts disabled.
+static void _update_compare(void) {
+    uint64_t next = WATCH_TIMEBASE_NO_COMPARE;
+
+    for(uint8_t i = 0; i < WATCH_TIMEBASE_NUM_CLIENTS; i++) {
+        if (_clients[i].registered && _clients[i].callback != NULL && _clients[i].compare < next) {
+            next = _clients[i].compare;
+        }
+    }
+
+    hri_tc_clear_INTEN_MC0_bit(TC2);
+    hri_tc_clear_interrupt_MC0_bit(TC2);
+    if (next == WATCH_TIMEBASE_NO_COMPARE) return;
+
+    uint64_t now = _now();
+    if (next <= now) {
+        // already expired; let the interrupt handler dispatch it.
+        NVIC_SetPendingIRQ(TC2_IRQn);
+    } else if ((next >> 16) == (now >> 16)) {
+        // expires before the next overflow, so we can let the hardware match it.
+        hri_tccount16_write_CC_reg(TC2, 0, next & 0xFFFF);
+        hri_tc_set_INTEN_MC0_bit(TC2);
+        // if the counter ran past the compare value while we were setting it up, we would miss the match.
+        if (_now() >= next) NVIC_SetPendingIRQ(TC2_IRQn);
+    }
+    // otherwise, the overflow handler will reevaluate at the start of each 2 second period.
+}
+
+static void _dispatch_expired(void) {
+    uint64_t now = _now();
+
+    for(uint8_t i = 0; i < WATCH_TIMEBASE_NUM_CLIENTS; i++) {
+        if (_clients[i].registered && _clients[i].callback != NULL && _clients[i].compare <= now) {
+            ext_irq_cb_t callback = _clients[i].callback;
+            _clients[i].callback = NULL;
+            _clients[i].compare = WATCH_TIMEBASE_NO_COMPARE;
+            callback();
+        }
+    }
+}
+
+static void _watch_timebase_enable(void) {
+    // clock TC2 with the 32.768 kHz clock on GCLK3, and enable the peripheral clock.
+    hri_mclk_set_APBCMASK_TC2_bit(MCLK);
+    hri_gclk_write_PCHCTRL_reg(GCLK, TC2_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK3 | GCLK_PCHCTRL_CHEN);
+    // disable and reset TC2.
+    hri_tc_clear_CTRLA_ENABLE_bit(TC2);
+    hri_tc_wait_for_sync(TC2, TC_SYNCBUSY_ENABLE);
+    hri_tc_write_CTRLA_reg(TC2, TC_CTRLA_SWRST);
+    hri_tc_wait_for_sync(TC2, TC_SYNCBUSY_SWRST);
+    hri_tc_write_CTRLA_reg(TC2, TC_CTRLA_PRESCALER_DIV1 | // count at the full 32.768 kHz
+                                TC_CTRLA_MODE_COUNT16 |   // count in 16-bit mode, overflowing every two seconds
+                                TC_CTRLA_RUNSTDBY);       // and keep counting in standby
+    // the overflow interrupt is the only one that fires periodically.
+    hri_tc_set_INTEN_OVF_bit(TC2);
+
+    _overflows = 0;
+
+    NVIC_ClearPendingIRQ(TC2_IRQn);
+    NVIC_EnableIRQ(TC2_IRQn);
+
+    hri_tc_set_CTRLA_ENABLE_bit(TC2);
+}
+
+static void _watch_timebase_disable(void) {
+    NVIC_DisableIRQ(TC2_IRQn);
+    NVIC_ClearPendingIRQ(TC2_IRQn);
+    hri_tc_clear_CTRLA_ENABLE_bit(TC2);
+    hri_tc_wait_for_sync(TC2, TC_SYNCBUSY_ENABLE);
+    hri_tc_write_CTRLA_reg(TC2, TC_CTRLA_SWRST);
+    hri_tc_wait_for_sync(TC2, TC_SYNCBUSY_SWRST);
+    hri_gclk_write_PCHCTRL_reg(GCLK, TC2_GCLK_ID, 0);
+    hri_mclk_clear_APBCMASK_TC2_bit(MCLK);
+}
+
+int8_t watch_timebase_register_client(void) {
+    for(int8_t i = 0; i < WATCH_TIMEBASE_NUM_CLIENTS; i++) {
+        if (!_clients[i].registered) {
+            if (_num_clients++ == 0) _watch_timebase_enable();
+            _clients[i].registered = true;
+            _clients[i].capture = 0;
+            _clients[i].compare = WATCH_TIMEBASE_NO_COMPARE;
+            _clients[i].callback = NULL;
+            return i;
+        }
+    }
+
+    return WATCH_TIMEBASE_INVALID_CLIENT;
+}
+
+void watch_timebase_unregister_client(int8_t client) {
+    if (!_is_valid_client(client)) return;
+
+    CRITICAL_SECTION_ENTER();
+    _clients[client].registered = false;
+    _clients[client].callback = NULL;
+    if (--_num_clients) _update_compare();
+    CRITICAL_SECTION_LEAVE();
+
+    if (_num_clients == 0) _watch_timebase_disable();
+}
+
+bool watch_timebase_is_running(void) {
+    return _num_clients > 0;
+}
+
+uint64_t watch_timebase_now(void) {
+    if (!_num_clients) return 0;
+
+    uint64_t retval;
+    CRITICAL_SECTION_ENTER();
+    retval = _now();
+    CRITICAL_SECTION_LEAVE();
+
+    return retval;
+}
+
+uint64_t watch_timebase_capture(int8_t client) {
+    if (!_is_valid_client(client)) return 0;
+
+    uint64_t now = watch_timebase_now();
+    _clients[client].capture = now;
+
+    return now;
+}
+
+uint64_t watch_timebase_get_capture(int8_t client) {
+    if (!_is_valid_client(client)) return 0;
+
+    return _clients[client].capture;
+}
+
+void watch_timebase_set_compare(int8_t client, uint64_t timestamp, ext_irq_cb_t callback) {
+    if (!_is_valid_client(client)) return;
+
+    CRITICAL_SECTION_ENTER();
+    _clients[client].compare = timestamp;
+    _clients[client].callback = callback;
+    _update_compare();
+    CRITICAL_SECTION_LEAVE();
+}
+
+void watch_timebase_clear_compare(int8_t client) {
+    if (!_is_valid_client(client)) return;
+
+    CRITICAL_SECTION_ENTER();
+    _clients[client].compare = WATCH_TIMEBASE_NO_COMPARE;
+    _clients[client].callback = NULL;
+    _update_compare();
+    CRITICAL_SECTION_LEAVE();
+}
+
+static void _watch_timebase_wake(void) {
+    // nothing to do; the interrupt itself wakes the CPU, and dispatching it cleared the client's callback.
+}
+
+void watch_timebase_sleep_until(int8_t client, uint64_t timestamp) {
+    if (!_is_valid_client(client)) return;
+
+    watch_timebase_set_compare(client, timestamp, _watch_timebase_wake);
+    // interrupts are masked so the match can't slip in between the check and the WFI; it still wakes the core.
+    while (true) {
+        __disable_irq();
+        bool pending = _clients[client].callback != NULL;
+        if (pending) _watch_sleep_idle();
+        __enable_irq();
+        if (!pending) break;
+    }
+}
+
+void TC2_Handler(void) {
+    if (hri_tc_get_interrupt_OVF_bit(TC2)) {
+        _overflows++;
+        hri_tc_clear_interrupt_OVF_bit(TC2);
+    }
+    hri_tc_clear_interrupt_MC0_bit(TC2);
+
+    _dispatch_expired();
+    _update_compare();
+}
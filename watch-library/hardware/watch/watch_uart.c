@@ -27,6 +27,11 @@
 
 struct usart_sync_descriptor USART_0;
 struct io_descriptor *uart_io;
+static uint32_t _uart_baud;
+
+static uint16_t _watch_uart_get_baud(void) {
+    return 65536 - ((65536 * 16.0f * _uart_baud) / watch_get_cpu_frequency());
+}
 
 void watch_enable_uart(const uint8_t tx_pin, const uint8_t rx_pin, uint32_t baud) {
     SERCOM_USART_CTRLA_Type ctrla;
@@ -93,13 +98,8 @@ void watch_enable_uart(const uint8_t tx_pin, const uint8_t rx_pin, uint32_t baud
     SERCOM3->USART.CTRLA.reg = ctrla.reg;
     SERCOM3->USART.CTRLB.reg = ctrlb.reg;
 
-    if (hri_usbdevice_get_CTRLA_ENABLE_bit(USB)) {
-        uint64_t br = 65536 - ((65536 * 16.0f * baud) / 8000000);
-        SERCOM3->USART.BAUD.reg = (uint16_t)br;
-    } else {
-        uint64_t br = 65536 - ((65536 * 16.0f * baud) / 4000000);
-        SERCOM3->USART.BAUD.reg = (uint16_t)br;
-    }
+    _uart_baud = baud;
+    SERCOM3->USART.BAUD.reg = _watch_uart_get_baud();
 
     SERCOM3->USART.CTRLA.reg |= SERCOM_USART_CTRLA_ENABLE;
 
@@ -107,6 +107,17 @@ void watch_enable_uart(const uint8_t tx_pin, const uint8_t rx_pin, uint32_t baud
     usart_sync_get_io_descriptor(&USART_0, &uart_io);
 }
 
+void _watch_uart_update_baud(void) {
+    // SERCOM3 is shared with SPI; only touch it if it's running as our UART.
+    if (!hri_mclk_get_APBCMASK_SERCOM3_bit(MCLK) || !SERCOM3->USART.CTRLA.bit.ENABLE) return;
+    if (SERCOM3->USART.CTRLA.bit.MODE != 1) return;
+
+    // BAUD is enable-protected.
+    usart_sync_disable(&USART_0);
+    SERCOM3->USART.BAUD.reg = _watch_uart_get_baud();
+    usart_sync_enable(&USART_0);
+}
+
 void watch_uart_puts(char *s) {
 	io_write(uart_io, (uint8_t *)s, strlen(s));
 }
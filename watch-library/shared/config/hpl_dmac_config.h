@@ -8,14 +8,14 @@
 // <i> Indicates whether dmac is enabled or not
 // <id> dmac_enable
 #ifndef CONF_DMAC_ENABLE
-#define CONF_DMAC_ENABLE 0
+#define CONF_DMAC_ENABLE 1
 #endif
 
 // <q> Priority Level 0
 // <i> Indicates whether Priority Level 0 is enabled or not
 // <id> dmac_lvlen0
 #ifndef CONF_DMAC_LVLEN0
-#define CONF_DMAC_LVLEN0 0
+#define CONF_DMAC_LVLEN0 1
 #endif
 
 // <o> Level 0 Round-Robin Arbitration
@@ -37,7 +37,7 @@
 // <i> Indicates whether Priority Level 1 is enabled or not
 // <id> dmac_lvlen1
 #ifndef CONF_DMAC_LVLEN1
-#define CONF_DMAC_LVLEN1 0
+#define CONF_DMAC_LVLEN1 1
 #endif
 
 // <o> Level 1 Round-Robin Arbitration
@@ -142,7 +142,7 @@
 // <e> Channel 0 settings
 // <id> dmac_channel_0_settings
 #ifndef CONF_DMAC_CHANNEL_0_SETTINGS
-#define CONF_DMAC_CHANNEL_0_SETTINGS 0
+#define CONF_DMAC_CHANNEL_0_SETTINGS 1
 #endif
 
 // <q> Channel Enable
@@ -166,7 +166,7 @@
 // <i> Defines the trigger action used for a transfer
 // <id> dmac_trigact_0
 #ifndef CONF_DMAC_TRIGACT_0
-#define CONF_DMAC_TRIGACT_0 0
+#define CONF_DMAC_TRIGACT_0 2
 #endif
 
 // <o> Trigger source
@@ -213,7 +213,7 @@
 // <i> Defines the peripheral trigger which is source of the transfer
 // <id> dmac_trifsrc_0
 #ifndef CONF_DMAC_TRIGSRC_0
-#define CONF_DMAC_TRIGSRC_0 0
+#define CONF_DMAC_TRIGSRC_0 0x09
 #endif
 
 // <o> Channel Arbitration Level
@@ -283,7 +283,7 @@
 // <i> Indicates whether the source address incrementation is enabled or not
 // <id> dmac_srcinc_0
 #ifndef CONF_DMAC_SRCINC_0
-#define CONF_DMAC_SRCINC_0 0
+#define CONF_DMAC_SRCINC_0 1
 #endif
 
 // <q> Destination Address Increment
@@ -328,7 +328,7 @@
 // <e> Channel 1 settings
 // <id> dmac_channel_1_settings
 #ifndef CONF_DMAC_CHANNEL_1_SETTINGS
-#define CONF_DMAC_CHANNEL_1_SETTINGS 0
+#define CONF_DMAC_CHANNEL_1_SETTINGS 1
 #endif
 
 // <q> Channel Enable
@@ -352,7 +352,7 @@
 // <i> Defines the trigger action used for a transfer
 // <id> dmac_trigact_1
 #ifndef CONF_DMAC_TRIGACT_1
-#define CONF_DMAC_TRIGACT_1 0
+#define CONF_DMAC_TRIGACT_1 2
 #endif
 
 // <o> Trigger source
@@ -399,7 +399,7 @@
 // <i> Defines the peripheral trigger which is source of the transfer
 // <id> dmac_trifsrc_1
 #ifndef CONF_DMAC_TRIGSRC_1
-#define CONF_DMAC_TRIGSRC_1 0
+#define CONF_DMAC_TRIGSRC_1 0x08
 #endif
 
 // <o> Channel Arbitration Level
@@ -410,7 +410,7 @@
 // <i> Defines the arbitration level for this channel
 // <id> dmac_lvl_1
 #ifndef CONF_DMAC_LVL_1
-#define CONF_DMAC_LVL_1 0
+#define CONF_DMAC_LVL_1 1
 #endif
 
 // <q> Channel Event Output
@@ -476,7 +476,7 @@
 // <i> Indicates whether the destination address incrementation is enabled or not
 // <id> dmac_dstinc_1
 #ifndef CONF_DMAC_DSTINC_1
-#define CONF_DMAC_DSTINC_1 0
+#define CONF_DMAC_DSTINC_1 1
 #endif
 
 // <o> Beat Size
@@ -514,7 +514,7 @@
 // <e> Channel 2 settings
 // <id> dmac_channel_2_settings
 #ifndef CONF_DMAC_CHANNEL_2_SETTINGS
-#define CONF_DMAC_CHANNEL_2_SETTINGS 0
+#define CONF_DMAC_CHANNEL_2_SETTINGS 1
 #endif
 
 // <q> Channel Enable
@@ -528,7 +528,7 @@
 // <i> Indicates whether channel 2 is running in standby mode or not
 // <id> dmac_runstdby_2
 #ifndef CONF_DMAC_RUNSTDBY_2
-#define CONF_DMAC_RUNSTDBY_2 0
+#define CONF_DMAC_RUNSTDBY_2 1
 #endif
 
 // <o> Trigger action
@@ -538,7 +538,7 @@
 // <i> Defines the trigger action used for a transfer
 // <id> dmac_trigact_2
 #ifndef CONF_DMAC_TRIGACT_2
-#define CONF_DMAC_TRIGACT_2 0
+#define CONF_DMAC_TRIGACT_2 2
 #endif
 
 // <o> Trigger source
@@ -585,7 +585,7 @@
 // <i> Defines the peripheral trigger which is source of the transfer
 // <id> dmac_trifsrc_2
 #ifndef CONF_DMAC_TRIGSRC_2
-#define CONF_DMAC_TRIGSRC_2 0
+#define CONF_DMAC_TRIGSRC_2 0x1F
 #endif
 
 // <o> Channel Arbitration Level
@@ -662,7 +662,7 @@
 // <i> Indicates whether the destination address incrementation is enabled or not
 // <id> dmac_dstinc_2
 #ifndef CONF_DMAC_DSTINC_2
-#define CONF_DMAC_DSTINC_2 0
+#define CONF_DMAC_DSTINC_2 1
 #endif
 
 // <o> Beat Size
@@ -672,7 +672,7 @@
 // <i> Defines the size of one beat
 // <id> dmac_beatsize_2
 #ifndef CONF_DMAC_BEATSIZE_2
-#define CONF_DMAC_BEATSIZE_2 0
+#define CONF_DMAC_BEATSIZE_2 1
 #endif
 
 // <o> Block Action
@@ -683,7 +683,7 @@
 // <i> Defines the the DMAC should take after a block transfer has completed
 // <id> dmac_blockact_2
 #ifndef CONF_DMAC_BLOCKACT_2
-#define CONF_DMAC_BLOCKACT_2 0
+#define CONF_DMAC_BLOCKACT_2 1
 #endif
 
 // <o> Event Output Selection
@@ -172,7 +172,7 @@
 // <i> The SPI data transfer rate
 // <id> spi_master_baud_rate
 #ifndef CONF_SERCOM_3_SPI_BAUD
-#define CONF_SERCOM_3_SPI_BAUD 1000000
+#define CONF_SERCOM_3_SPI_BAUD 2000000
 #endif
 
 // </h>
@@ -22,17 +22,43 @@
  * SOFTWARE.
  */
 
+#include <string.h>
 #include "lis2dw.h"
 #include "watch.h"
 
+// RAM copies of CTRL1 through CTRL6 (0x20 through 0x25) and CTRL7 (0x3F), which isn't next to them.
+// zeroes are the sensor's reset values, except for CTRL2, which lis2dw_begin sets.
+enum {
+    _LIS2DW_CTRL1 = 0,
+    _LIS2DW_CTRL2,
+    _LIS2DW_CTRL3,
+    _LIS2DW_CTRL4_INT1,
+    _LIS2DW_CTRL5_INT2,
+    _LIS2DW_CTRL6,
+    _LIS2DW_CTRL7,
+    _LIS2DW_NUM_CTRL_REGISTERS
+};
+static uint8_t _lis2dw_ctrl[_LIS2DW_NUM_CTRL_REGISTERS];
+
+static void _lis2dw_write_ctrl(uint8_t index, uint8_t value) {
+    _lis2dw_ctrl[index] = value;
+    watch_i2c_write8(LIS2DW_ADDRESS, index == _LIS2DW_CTRL7 ? LIS2DW_REG_CTRL7 : LIS2DW_REG_CTRL1 + index, value);
+}
+
+static void _lis2dw_update_ctrl(uint8_t index, uint8_t mask, uint8_t bits) {
+    uint8_t value = (_lis2dw_ctrl[index] & ~mask) | (bits & mask);
+    if (value != _lis2dw_ctrl[index]) _lis2dw_write_ctrl(index, value);
+}
+
 bool lis2dw_begin(void) {
     if (lis2dw_get_device_id() != LIS2DW_WHO_AM_I_VAL) {
         return false;
     }
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL2, LIS2DW_CTRL2_VAL_BOOT);
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL2, LIS2DW_CTRL2_VAL_SOFT_RESET);
+    memset(_lis2dw_ctrl, 0, sizeof(_lis2dw_ctrl));
     // Enable block data update (output registers not updated until MSB and LSB have been read) and address autoincrement
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL2, LIS2DW_CTRL2_VAL_BDU | LIS2DW_CTRL2_VAL_IF_ADD_INC);
+    _lis2dw_write_ctrl(_LIS2DW_CTRL2, LIS2DW_CTRL2_VAL_BDU | LIS2DW_CTRL2_VAL_IF_ADD_INC);
 
     // Parameters at startup: 
     //  * Data rate 0 (powered down)
@@ -47,6 +73,19 @@ bool lis2dw_begin(void) {
     return true;
 }
 
+void lis2dw_configure(const lis2dw_configuration_t *configuration) {
+    uint8_t buffer[1 + _LIS2DW_CTRL6 + 1];
+
+    _lis2dw_ctrl[_LIS2DW_CTRL1] = (configuration->data_rate << 4) | ((configuration->mode << 2) & 0b1100) | (configuration->low_power_mode & 0b11);
+    _lis2dw_ctrl[_LIS2DW_CTRL6] = (configuration->bandwidth_filtering << 6) | (configuration->range << 4) | (configuration->filter << 3) |
+                                  (configuration->low_noise ? LIS2DW_CTRL6_VAL_LOW_NOISE : 0);
+
+    // CTRL2 has address autoincrement on, so this is one transaction. CTRL3 through CTRL5 get written back as they were.
+    buffer[0] = LIS2DW_REG_CTRL1;
+    memcpy(buffer + 1, _lis2dw_ctrl, _LIS2DW_CTRL6 + 1);
+    watch_i2c_send(LIS2DW_ADDRESS, buffer, sizeof(buffer));
+}
+
 uint8_t lis2dw_get_device_id(void) {
     return watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WHO_AM_I);
 }
@@ -102,84 +141,65 @@ uint16_t lis2dw_get_temperature(void) {
 }
 
 void lis2dw_set_range(lis2dw_range_t range) {
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & ~(LIS2DW_RANGE_16_G << 4);
-    uint8_t bits = range << 4;
-
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6, val | bits);
+    _lis2dw_update_ctrl(_LIS2DW_CTRL6, LIS2DW_RANGE_16_G << 4, range << 4);
 }
 
 lis2dw_range_t lis2dw_get_range(void) {
-    uint8_t retval = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & (LIS2DW_RANGE_16_G << 4);
+    uint8_t retval = _lis2dw_ctrl[_LIS2DW_CTRL6] & (LIS2DW_RANGE_16_G << 4);
     retval >>= 4;
     return (lis2dw_range_t)retval;
 }
 
 void lis2dw_set_data_rate(lis2dw_data_rate_t dataRate) {
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & ~(0b1111 << 4);
-    uint8_t bits = dataRate << 4;
-
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val | bits);
+    _lis2dw_update_ctrl(_LIS2DW_CTRL1, 0b1111 << 4, dataRate << 4);
 }
 
 lis2dw_data_rate_t lis2dw_get_data_rate(void) {
-    return watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) >> 4;
+    return _lis2dw_ctrl[_LIS2DW_CTRL1] >> 4;
 }
 
 void lis2dw_set_filter_type(lis2dw_filter_t bwfilter) {
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & ~(LIS2DW_CTRL6_VAL_FDS_HIGH);
-    uint8_t bits = bwfilter << 3;
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6, val | bits);
+    _lis2dw_update_ctrl(_LIS2DW_CTRL6, LIS2DW_CTRL6_VAL_FDS_HIGH, bwfilter << 3);
 }
 
 lis2dw_filter_t lis2dw_get_filter_type(void) {
-    uint8_t retval = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & (LIS2DW_CTRL6_VAL_FDS_HIGH);
+    uint8_t retval = _lis2dw_ctrl[_LIS2DW_CTRL6] & (LIS2DW_CTRL6_VAL_FDS_HIGH);
     retval >>= 3;
     return (lis2dw_filter_t)retval;
 }
 
 void lis2dw_set_bandwidth_filtering(lis2dw_bandwidth_filtering_mode_t bwfilter) {
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & ~(LIS2DW_CTRL6_VAL_BANDWIDTH_DIV20);
-    uint8_t bits = bwfilter << 6;
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6, val | bits);
+    _lis2dw_update_ctrl(_LIS2DW_CTRL6, LIS2DW_CTRL6_VAL_BANDWIDTH_DIV20, bwfilter << 6);
 }
 
 lis2dw_bandwidth_filtering_mode_t lis2dw_get_bandwidth_filtering(void) {
-    uint8_t retval = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL6) & (LIS2DW_CTRL6_VAL_BANDWIDTH_DIV20);
+    uint8_t retval = _lis2dw_ctrl[_LIS2DW_CTRL6] & (LIS2DW_CTRL6_VAL_BANDWIDTH_DIV20);
     retval >>= 6;
     return (lis2dw_bandwidth_filtering_mode_t)retval;
 }
 
 void lis2dw_set_mode(lis2dw_mode_t mode) {
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & ~(0b1100);
-    uint8_t bits = (mode << 2) & 0b1100;
-
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val | bits);
+    _lis2dw_update_ctrl(_LIS2DW_CTRL1, 0b1100, mode << 2);
 }
 
 lis2dw_mode_t lis2dw_get_mode(void) {
-    return (lis2dw_mode_t)(watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & 0b1100) >> 2;
+    return (lis2dw_mode_t)(_lis2dw_ctrl[_LIS2DW_CTRL1] & 0b1100) >> 2;
 }
 
 void lis2dw_set_low_power_mode(lis2dw_low_power_mode_t mode) {
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & ~(0b11);
-    uint8_t bits = mode & 0b11;
-
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val | bits);
+    _lis2dw_update_ctrl(_LIS2DW_CTRL1, 0b11, mode);
 }
 
 lis2dw_low_power_mode_t lis2dw_get_low_power_mode(void) {
-    return watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & 0b11;
+    return _lis2dw_ctrl[_LIS2DW_CTRL1] & 0b11;
 }
 
 void lis2dw_set_low_noise_mode(bool on) {
-    uint8_t val = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & ~(LIS2DW_CTRL6_VAL_LOW_NOISE);
-    uint8_t bits = on ? LIS2DW_CTRL6_VAL_LOW_NOISE : 0;
-
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1, val | bits);
+    _lis2dw_update_ctrl(_LIS2DW_CTRL6, LIS2DW_CTRL6_VAL_LOW_NOISE, on ? LIS2DW_CTRL6_VAL_LOW_NOISE : 0);
 }
 
 bool lis2dw_get_low_noise_mode(void) {
-    return (watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL1) & LIS2DW_CTRL6_VAL_LOW_NOISE) != 0;
+    return (_lis2dw_ctrl[_LIS2DW_CTRL6] & LIS2DW_CTRL6_VAL_LOW_NOISE) != 0;
 }
 
 inline void lis2dw_disable_fifo(void) {
@@ -193,12 +213,16 @@ inline void lis2dw_enable_fifo(void) {
 bool lis2dw_read_fifo(lis2dw_fifo_t *fifo_data) {
     uint8_t temp = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_SAMPLE);
     bool overrun = !!(temp & LIS2DW_FIFO_SAMPLE_OVERRUN);
+    uint8_t reg = LIS2DW_REG_OUT_X_L;
 
     fifo_data->count = temp & LIS2DW_FIFO_SAMPLE_COUNT;
+    if (fifo_data->count > 32) fifo_data->count = 32;
+    if (fifo_data->count == 0) return overrun;
 
-    for(int i = 0; i < fifo_data->count; i++) {
-        fifo_data->readings[i] = lis2dw_get_raw_reading();
-    }
+    // with the FIFO on, the address autoincrement wraps from OUT_Z_H back around to OUT_X_L and pops the next
+    // sample, so the whole FIFO comes out in one read. the bytes are little endian, same as lis2dw_reading_t.
+    watch_i2c_send(LIS2DW_ADDRESS, &reg, 1);
+    watch_i2c_receive(LIS2DW_ADDRESS, (uint8_t *)fifo_data->readings, fifo_data->count * sizeof(lis2dw_reading_t));
 
     return overrun;
 }
@@ -208,25 +232,33 @@ void lis2dw_clear_fifo(void) {
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_CTRL, LIS2DW_FIFO_CTRL_MODE_COLLECT_AND_STOP | LIS2DW_FIFO_CTRL_FTH);
 }
 
+void lis2dw_enable_fifo_threshold_int1(uint8_t threshold) {
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_CTRL, LIS2DW_FIFO_CTRL_MODE_COLLECT_CONTINUOUS | (threshold & LIS2DW_FIFO_CTRL_FTH));
+    _lis2dw_update_ctrl(_LIS2DW_CTRL4_INT1, LIS2DW_CTRL4_INT1_FTH, LIS2DW_CTRL4_INT1_FTH);
+}
+
+void lis2dw_disable_fifo_threshold_int1(void) {
+    _lis2dw_update_ctrl(_LIS2DW_CTRL4_INT1, LIS2DW_CTRL4_INT1_FTH, 0);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_CTRL, LIS2DW_FIFO_CTRL_MODE_OFF);
+}
+
 void lis2dw_configure_wakeup_int1(uint8_t threshold, bool latch, bool active_state) {
     uint8_t configuration;
 
     // enable wakeup interrupt on INT1 pin
-    configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1);
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1, configuration | LIS2DW_CTRL4_INT1_WU);
+    _lis2dw_update_ctrl(_LIS2DW_CTRL4_INT1, LIS2DW_CTRL4_INT1_WU, LIS2DW_CTRL4_INT1_WU);
 
     // set threshold
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_THS, threshold | LIS2DW_WAKE_UP_THS_VAL_SLEEP_ON);
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_INT1_DUR, 0b01111111);
 
-    configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL3) & ~(LIS2DW_CTRL3_VAL_LIR);
+    configuration = _lis2dw_ctrl[_LIS2DW_CTRL3] & ~(LIS2DW_CTRL3_VAL_LIR);
     if (!active_state) configuration |= LIS2DW_CTRL3_VAL_H_L_ACTIVE;
     if (latch) configuration |= LIS2DW_CTRL3_VAL_LIR;
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL3, configuration);
+    _lis2dw_write_ctrl(_LIS2DW_CTRL3, configuration);
 
     // enable interrupts
-    configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7);
-    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7, configuration | LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
+    _lis2dw_update_ctrl(_LIS2DW_CTRL7, LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE, LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
 }
 
 lis2dw_wakeup_source lis2dw_get_wakeup_source() {
@@ -99,6 +99,17 @@ typedef enum {
   LIS2DW_RANGE_2_G = 0b00   // +/- 2g (default value)
 } lis2dw_range_t;
 
+/// @brief The sensor's main settings, for lis2dw_configure. Interrupt settings are kept as they were.
+typedef struct {
+    lis2dw_data_rate_t data_rate;
+    lis2dw_mode_t mode;
+    lis2dw_low_power_mode_t low_power_mode;
+    lis2dw_bandwidth_filtering_mode_t bandwidth_filtering;
+    lis2dw_range_t range;
+    lis2dw_filter_t filter;
+    bool low_noise;
+} lis2dw_configuration_t;
+
 typedef enum {
   LIS2DW_INTERRUPT_SRC_SLEEP_CHANGE = 0b00100000,
   LIS2DW_INTERRUPT_SRC_6D           = 0b00010000,
@@ -287,8 +298,20 @@ typedef enum {
 #define LIS2DW_CTRL7_VAL_HP_REF_MODE        0b00000010
 #define LIS2DW_CTRL7_VAL_LPASS_ON6D         0b00000001
 
+/** @brief Resets the sensor and enables block data update and register address autoincrement.
+  * @return true if a LIS2DW was found, false otherwise.
+  * @note The driver keeps a copy of the control registers in RAM, so the getters below don't touch the bus
+  *       and the setters only write. It's only accurate if all configuration goes through this driver,
+  *       starting with this call.
+  */
 bool lis2dw_begin(void);
 
+/** @brief Applies all of the sensor's main settings in one burst write of CTRL1 through CTRL6, instead of
+  *        a read-modify-write for each one.
+  * @param configuration The settings to apply.
+  */
+void lis2dw_configure(const lis2dw_configuration_t *configuration);
+
 uint8_t lis2dw_get_device_id(void);
 
 bool lis2dw_have_new_data(void);
@@ -331,10 +354,24 @@ void lis2dw_disable_fifo(void);
 
 void lis2dw_enable_fifo(void);
 
+/** @brief Reads every sample in the FIFO, oldest first, in one burst.
+  * @param fifo_data The struct to fill in with the samples and their count.
+  * @return true if the FIFO had overrun, i.e. samples were lost before this read.
+  */
 bool lis2dw_read_fifo(lis2dw_fifo_t *fifo_data);
 
 void lis2dw_clear_fifo(void);
 
+/** @brief Puts the FIFO in continuous mode and raises INT1 whenever it holds at least threshold samples.
+  * @param threshold The number of samples that raises INT1, from 1 to 31. The pin goes back low once a
+  *                  lis2dw_read_fifo brings it under that, so read it from the rising edge of INT1 (pin A4)
+  *                  to get each batch as soon as it's ready, with timing set by the sensor's clock.
+  */
+void lis2dw_enable_fifo_threshold_int1(uint8_t threshold);
+
+/// @brief Stops raising INT1 for the FIFO threshold and turns the FIFO off.
+void lis2dw_disable_fifo_threshold_int1(void);
+
 void lis2dw_configure_wakeup_int1(uint8_t threshold, bool latch, bool active_state);
 
 lis2dw_interrupt_source lis2dw_get_interrupt_source(void);
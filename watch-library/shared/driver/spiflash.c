@@ -28,7 +28,13 @@
 
 #include "spiflash.h"
 
-#define SPI_FLASH_FAST_READ false
+// fast read costs one dummy byte per read, and keeps working if the bus is ever clocked past 33 MHz.
+#define SPI_FLASH_FAST_READ true
+
+// while the chip is busy, poll its status with a growing interval, in 1/32768 second ticks: a page program is done
+// in about a millisecond, but a sector erase can take tens of them.
+#define SPI_FLASH_BACKOFF_MIN 16
+#define SPI_FLASH_BACKOFF_MAX 256
 
 static void flash_enable(void) {
     watch_set_pin_level(A3, false);
@@ -114,7 +120,71 @@ bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length)
 }
 
 void spi_flash_init(void) {
-	gpio_set_pin_level(A3, true);
-	gpio_set_pin_direction(A3, GPIO_DIRECTION_OUT);
+    watch_set_pin_level(A3, true);
+    watch_enable_digital_output(A3);
     watch_enable_spi();
 }
+
+uint32_t spi_flash_get_capacity(void) {
+    uint8_t id[3] = {0};
+    flash_enable();
+    if (!spi_flash_read_command(CMD_READ_JEDEC_ID, id, 3)) return 0;
+    // the third byte is log2 of the size in bytes on just about every NOR flash; 0x00 or 0xFF means nobody's home.
+    if (id[0] == 0x00 || id[0] == 0xFF || id[2] < 16 || id[2] > 27) return 0;
+    // every command here takes a 3-byte address, which only reaches the first 16 MB of a bigger chip; past that,
+    // addresses would wrap around onto the start of the chip. so only report what we can actually address.
+    if (id[2] > SPI_FLASH_ADDRESS_BITS) return 1ul << SPI_FLASH_ADDRESS_BITS;
+    return 1ul << id[2];
+}
+
+bool spi_flash_wait_until_ready(void) {
+    uint8_t status;
+    int8_t client = WATCH_TIMEBASE_INVALID_CLIENT;
+    uint32_t backoff = SPI_FLASH_BACKOFF_MIN;
+    bool ok;
+
+    while (true) {
+        flash_enable();
+        ok = spi_flash_read_command(CMD_READ_STATUS, &status, 1);
+        if (!ok || !(status & 0x01)) break;  // write in progress
+
+        if (client == WATCH_TIMEBASE_INVALID_CLIENT) client = watch_timebase_register_client();
+        // if the timebase has no room for us, just keep polling.
+        if (client == WATCH_TIMEBASE_INVALID_CLIENT) continue;
+        watch_timebase_sleep_until(client, watch_timebase_now() + backoff);
+        if (backoff < SPI_FLASH_BACKOFF_MAX) backoff *= 2;
+    }
+
+    if (client != WATCH_TIMEBASE_INVALID_CLIENT) watch_timebase_unregister_client(client);
+
+    return ok;
+}
+
+bool spi_flash_erase_sector(uint32_t address) {
+    if (!spi_flash_wait_until_ready()) return false;
+    flash_enable();
+    if (!spi_flash_command(CMD_ENABLE_WRITE)) return false;
+    flash_enable();
+    if (!spi_flash_sector_command(CMD_SECTOR_ERASE, address)) return false;
+
+    return spi_flash_wait_until_ready();
+}
+
+bool spi_flash_program(uint32_t address, const uint8_t *data, uint32_t length) {
+    while (length > 0) {
+        // a page program wraps around within its page, so never let one cross a page boundary.
+        uint32_t chunk = SPI_FLASH_PAGE_SIZE - (address % SPI_FLASH_PAGE_SIZE);
+        if (chunk > length) chunk = length;
+
+        if (!spi_flash_wait_until_ready()) return false;
+        flash_enable();
+        if (!spi_flash_command(CMD_ENABLE_WRITE)) return false;
+        if (!spi_flash_write_data(address, (uint8_t *)data, chunk)) return false;
+
+        address += chunk;
+        data += chunk;
+        length -= chunk;
+    }
+
+    return spi_flash_wait_until_ready();
+}
@@ -56,3 +56,19 @@ bool spi_flash_sector_command(uint8_t command, uint32_t address);
 bool spi_flash_write_data(uint32_t address, uint8_t *data, uint32_t data_length);
 bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length);
 void spi_flash_init(void);
+
+// Higher level helpers, which take care of chip select, write enable and waiting for the chip.
+#define SPI_FLASH_PAGE_SIZE 256
+#define SPI_FLASH_SECTOR_SIZE 4096
+/// Commands use 3-byte addresses, so only the first 16 MB of a chip can be reached.
+#define SPI_FLASH_ADDRESS_BITS 24
+
+/** @brief Reads the JEDEC ID and returns the size of the chip in bytes, or 0 if no flash chip answered.
+  *        Chips larger than 16 MB report 16 MB, since that's as far as 3-byte addresses reach. */
+uint32_t spi_flash_get_capacity(void);
+/** @brief Waits until the chip has finished any write or erase in progress, sleeping between polls. */
+bool spi_flash_wait_until_ready(void);
+/** @brief Erases the 4 KB sector containing the address, and waits for the erase to finish. */
+bool spi_flash_erase_sector(uint32_t address);
+/** @brief Programs any number of bytes, splitting the write at page boundaries, and waits for it to finish. */
+bool spi_flash_program(uint32_t address, const uint8_t *data, uint32_t length);
@@ -24,7 +24,6 @@
 
 #include "thermistor_driver.h"
 #include "watch.h"
-#include "watch_utility.h"
 
 void thermistor_driver_enable(void) {
     // Enable the ADC peripheral, which we'll use to read the thermistor value.
@@ -47,14 +46,16 @@ void thermistor_driver_disable(void) {
 }
 #if __EMSCRIPTEN__
 #include <emscripten.h>
-float thermistor_driver_get_temperature(void)
+int16_t thermistor_driver_get_temperature(void)
 {
-    return EM_ASM_DOUBLE({
-        return temp_c || 25.0;
+    return EM_ASM_INT({
+        return Math.round((temp_c || 25.0) * 100);
     });
 }
 #else
-float thermistor_driver_get_temperature(void) {
+#include "thermistor_table.h"
+
+int16_t thermistor_driver_get_temperature(void) {
     // set the enable pin to the level that powers the thermistor circuit.
     watch_set_pin_level(THERMISTOR_ENABLE_PIN, THERMISTOR_ENABLE_VALUE);
     // get the sense pin level
@@ -62,6 +63,12 @@ float thermistor_driver_get_temperature(void) {
     // and then set the enable pin to the opposite value to power down the thermistor circuit.
     watch_set_pin_level(THERMISTOR_ENABLE_PIN, !THERMISTOR_ENABLE_VALUE);
 
-    return watch_utility_thermistor_temperature(value, THERMISTOR_HIGH_SIDE, THERMISTOR_B_COEFFICIENT, THERMISTOR_NOMINAL_TEMPERATURE, THERMISTOR_NOMINAL_RESISTANCE, THERMISTOR_SERIES_RESISTANCE);
+    // look the reading up in the table generated from the parameters in thermistor_driver.h, and interpolate between
+    // the two nearest entries. this matches watch_utility_thermistor_temperature to a few hundredths of a degree,
+    // without the floating point log and divisions.
+    uint16_t index = value >> THERMISTOR_TABLE_SHIFT;
+    int32_t fraction = value & ((1 << THERMISTOR_TABLE_SHIFT) - 1);
+    int32_t low = thermistor_table[index];
+    return (int16_t)(low + (((thermistor_table[index + 1] - low) * fraction) >> THERMISTOR_TABLE_SHIFT));
 }
 #endif
@@ -25,6 +25,8 @@
 #ifndef THERMISTOR_DRIVER_H_
 #define THERMISTOR_DRIVER_H_
 
+#include <stdint.h>
+
 // TODO: Do these belong in movement_config.h? In settings we can set on the watch? In an EEPROM configuration area?
 // Think on this. [joey 11/22]
 #define THERMISTOR_SENSE_PIN (A2)
@@ -36,8 +38,11 @@
 #define THERMISTOR_NOMINAL_RESISTANCE (10000.0)
 #define THERMISTOR_SERIES_RESISTANCE (10000.0)
 
+// If you change any of these, run utils/thermistor_table/generate_thermistor_table.py to regenerate thermistor_table.h.
+
 void thermistor_driver_enable(void);
 void thermistor_driver_disable(void);
-float thermistor_driver_get_temperature(void);
+/// Returns the temperature in hundredths of a degree Celsius (i.e. 2150 for 21.5 °C).
+int16_t thermistor_driver_get_temperature(void);
 
 #endif // THERMISTOR_DRIVER_H_
@@ -0,0 +1,49 @@
+// Generated by utils/thermistor_table/generate_thermistor_table.py; don't edit.
+// B = 3380, R0 = 10000 ohms at 25 C, series resistor 10000 ohms, high side.
+// Worst interpolation error from -40 to 125 C: 0.0351 C.
+
+#ifndef THERMISTOR_TABLE_H_
+#define THERMISTOR_TABLE_H_
+
+#include <stdint.h>
+
+#define THERMISTOR_TABLE_SHIFT 8
+
+// temperature in hundredths of a degree Celsius, for ADC readings of 0, 256, 512 ... 65536.
+static const int16_t thermistor_table[257] = {
+    -12243,  -7288,  -6425,  -5882,  -5479,  -5153,  -4879,  -4641,
+     -4430,  -4240,  -4066,  -3906,  -3757,  -3618,  -3488,  -3364,
+     -3247,  -3135,  -3029,  -2927,  -2829,  -2734,  -2643,  -2555,
+     -2470,  -2387,  -2307,  -2228,  -2152,  -2078,  -2006,  -1935,
+     -1866,  -1798,  -1732,  -1667,  -1603,  -1540,  -1479,  -1418,
+     -1359,  -1300,  -1242,  -1185,  -1129,  -1074,  -1019,   -965,
+      -912,   -860,   -808,   -756,   -705,   -655,   -605,   -556,
+      -507,   -459,   -411,   -363,   -316,   -269,   -223,   -177,
+      -131,    -86,    -41,      4,     49,     93,    137,    181,
+       224,    267,    310,    353,    396,    438,    480,    523,
+       564,    606,    648,    689,    731,    772,    813,    854,
+       895,    935,    976,   1017,   1057,   1097,   1138,   1178,
+      1218,   1258,   1298,   1339,   1379,   1419,   1458,   1498,
+      1538,   1578,   1618,   1658,   1698,   1738,   1778,   1818,
+      1858,   1898,   1938,   1978,   2018,   2058,   2098,   2139,
+      2179,   2220,   2260,   2301,   2341,   2382,   2423,   2464,
+      2505,   2546,   2588,   2629,   2671,   2712,   2754,   2796,
+      2838,   2881,   2923,   2966,   3009,   3052,   3095,   3138,
+      3182,   3226,   3270,   3314,   3359,   3404,   3449,   3494,
+      3539,   3585,   3631,   3678,   3724,   3771,   3819,   3866,
+      3914,   3963,   4011,   4061,   4110,   4160,   4210,   4261,
+      4312,   4363,   4415,   4468,   4521,   4574,   4628,   4683,
+      4738,   4794,   4850,   4907,   4964,   5023,   5081,   5141,
+      5201,   5262,   5324,   5386,   5450,   5514,   5579,   5645,
+      5712,   5780,   5849,   5919,   5990,   6062,   6136,   6210,
+      6286,   6364,   6442,   6522,   6604,   6687,   6772,   6859,
+      6947,   7038,   7130,   7225,   7322,   7421,   7522,   7626,
+      7733,   7843,   7956,   8072,   8191,   8314,   8441,   8573,
+      8708,   8849,   8994,   9146,   9303,   9467,   9637,   9816,
+     10002,  10198,  10405,  10622,  10852,  11095,  11355,  11632,
+     11929,  12249,  12597,  12976,  13392,  13853,  14370,  14955,
+     15628,  16418,  17368,  18551,  20098,  22283,  25839,  32767,
+     32767,
+};
+
+#endif // THERMISTOR_TABLE_H_
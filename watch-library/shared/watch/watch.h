@@ -56,6 +56,12 @@
                          the I2C bus, putting values directly on the bus and reading data from registers on I2C devices.
             - @ref spi - This section covers functions related to the SAM L22's built-in SPI driver.
             - @ref uart - This section covers functions related to the UART peripheral.
+            - @ref timebase - This section covers functions related to the shared high-resolution timebase, which
+                              stopwatches and other faces can use for sub-second timing.
+            - @ref performance - This section covers functions related to temporarily raising the CPU clock speed
+                                 for compute-heavy work.
+            - @ref random - This section covers functions related to generating random numbers from a generator
+                            that is seeded from the SAM L22's true random number generator.
             - @ref deepsleep - This section covers functions related to preparing for and entering BACKUP mode, the
                                deepest sleep mode available on the SAM L22.
  */
@@ -72,6 +78,9 @@
 #include "watch_spi.h"
 #include "watch_uart.h"
 #include "watch_storage.h"
+#include "watch_timebase.h"
+#include "watch_performance.h"
+#include "watch_random.h"
 #include "watch_deepsleep.h"
 
 #include "watch_private.h"
@@ -141,6 +141,45 @@ void watch_set_analog_reference_voltage(watch_adc_reference_voltage reference);
   */
 uint16_t watch_get_vcc_voltage(void);
 
+/** @brief A function to call with a batch of samples from background sampling.
+  * @param samples A pointer to the samples, oldest first. They stay valid until the next batch is delivered.
+  * @param count The number of samples in the batch; half the length of the buffer passed to
+  *              watch_adc_start_background_sampling.
+  */
+typedef void (*watch_adc_batch_callback_t)(const uint16_t *samples, uint16_t count);
+
+/** @brief Starts sampling an analog pin in the background, at a fixed rate, without waking the CPU for
+  *        each sample.
+  * @param pin One of pins A0-A4. You must already have called watch_enable_adc and
+  *            watch_enable_analog_input for it, and set any reference voltage, sample count or sampling
+  *            length you want.
+  * @param frequency How often to take a sample, in Hz. Must be a power of 2 between 1 and 128 (though
+  *                  with the default 16 samples accumulated per reading, the ADC can't keep up with
+  *                  much more than 64).
+  * @param buffer A buffer for the samples, which must stay valid until you stop sampling.
+  * @param length The length of the buffer, in samples. Must be even, and at least 2.
+  * @param callback A function to call each time half of the buffer has filled up.
+  * @return true if sampling started; false if the arguments are invalid, background sampling is already
+  *         running, or it isn't supported (i.e. in the simulator).
+  * @details An RTC periodic event starts each conversion through the event system, and the DMA controller
+  *          moves each result into the buffer, so the watch can stay in standby the whole time; only the
+  *          ADC and the DMA controller wake up for a sample. The buffer is used as a ring of two halves:
+  *          when one half fills up, the callback gets it while the other half fills.
+  * @warning The callback is called from an interrupt. Copy the samples or set a flag, and do any real
+  *          work from your main loop. While background sampling is running, don't call the other
+  *          analog functions; stop sampling first.
+  */
+bool watch_adc_start_background_sampling(const uint8_t pin, uint8_t frequency, uint16_t *buffer, uint16_t length, watch_adc_batch_callback_t callback);
+
+/** @brief Stops background sampling, and returns the ADC to its normal, one-reading-at-a-time operation.
+  *        Samples in a partly filled half of the buffer are discarded.
+  */
+void watch_adc_stop_background_sampling(void);
+
+/** @brief Returns true if background sampling is running.
+  */
+bool watch_adc_is_background_sampling(void);
+
 /** @brief Disables the analog circuitry on the selected pin.
   * @param pin One of pins A0-A4.
   */
@@ -150,6 +189,7 @@ void watch_disable_analog_input(const uint8_t pin);
   * @note You will need to call watch_enable_adc to re-enable the ADC peripheral. When you do, it will
   *       have the default settings of 16 samples and 1 measurement cycle; if you customized these
   *       parameters, you will need to set them up again.
+  * @note If background sampling is running, this stops it first.
   **/
 void watch_disable_adc(void);
 
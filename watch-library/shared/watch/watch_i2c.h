@@ -33,6 +33,31 @@
   *        registers on I2C devices.
   */
 /// @{
+
+struct watch_i2c_transaction;
+
+/// @brief Called from the I2C interrupt when a transaction finishes, successfully or not.
+typedef void (*watch_i2c_callback_t)(struct watch_i2c_transaction *transaction);
+
+/** @brief One I2C transaction: an optional write, then an optional read from the same device. When there
+  *        are both, they're joined by a repeated start, so you can write a register address and read it back
+  *        without letting go of the bus.
+  * @details Fill in the first six fields (context is yours to use) and leave the rest to the driver. The
+  *          struct and its buffers must stay put until the transaction is done.
+  */
+typedef struct watch_i2c_transaction {
+    int16_t addr;                   ///< The 7-bit address of the device.
+    const uint8_t *write_buf;       ///< Bytes to send first, or NULL.
+    uint16_t write_length;          ///< The number of bytes in write_buf.
+    uint8_t *read_buf;              ///< Storage for the bytes to read afterwards, or NULL.
+    uint16_t read_length;           ///< The number of bytes to read into read_buf.
+    watch_i2c_callback_t callback;  ///< Called from the interrupt when done, or NULL.
+    void *context;                  ///< Not used by the driver.
+    volatile bool busy;             ///< Set while the transaction is queued or in progress.
+    volatile bool failed;           ///< Set if the device didn't acknowledge or the bus had an error.
+    struct watch_i2c_transaction *next;
+} watch_i2c_transaction_t;
+
 /** @brief Enables the I2C peripheral. Call this before attempting to interface with I2C devices.
   */
 void watch_enable_i2c(void);
@@ -102,5 +127,23 @@ uint32_t watch_i2c_read24(int16_t addr, uint8_t reg);
           bit packing, you may need to shuffle some bits around.
   */
 uint32_t watch_i2c_read32(int16_t addr, uint8_t reg);
+
+/** @brief Queues a transaction and returns right away; the bus is driven from its interrupt, one byte at a
+  *        time, so the CPU can sleep in the meantime.
+  * @param transaction The transaction to run. Transactions run one at a time, in the order they were queued.
+  * @return true if the transaction was queued; false if I2C is disabled or the transaction is already queued.
+  * @note The blocking functions above wait for the queue to empty before they touch the bus.
+  */
+bool watch_i2c_submit(watch_i2c_transaction_t *transaction);
+
+/** @brief Sleeps until a queued transaction is done.
+  * @param transaction A transaction you passed to watch_i2c_submit.
+  * @return true if it succeeded, false if it failed.
+  */
+bool watch_i2c_wait(watch_i2c_transaction_t *transaction);
+
+/** @brief Returns true if any transaction is queued or in progress.
+  */
+bool watch_i2c_is_busy(void);
 /// @}
 #endif
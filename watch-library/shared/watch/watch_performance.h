@@ -0,0 +1,73 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_PERFORMANCE_H_INCLUDED
+#define _WATCH_PERFORMANCE_H_INCLUDED
+////< @file watch_performance.h
+
+#include "watch.h"
+
+/** @addtogroup performance Performance Levels
+  * @brief This section covers functions related to temporarily running the CPU at a higher clock speed.
+  * @details The watch normally runs from the internal 16 MHz oscillator divided down to 4 MHz (8 MHz while
+  *          USB is enabled), with the voltage regulator at PL2 and no flash wait states.
+  *          That is plenty for updating the display once a second, but compute-heavy work (an orrery, a
+  *          chess move, a burst of HMACs) can leave the UI stalled for a noticeable amount of time.
+  *
+  *          Raising the performance level adds a flash wait state and runs the main clock at 16 MHz. The
+  *          regulator stays at PL2 either way, since USB needs it. Every peripheral clocked from the main
+  *          clock is adjusted on each switch so that it keeps running at the same rate: the ADC prescaler,
+  *          the TCC that drives the buzzer and LED, the USB task timers, and the I2C, SPI and UART baud
+  *          rates.
+  *
+  *          Higher performance levels draw considerably more current, so switch back to the low level
+  *          as soon as the work is done.
+  * @note The delay_ms and delay_us functions are calibrated for the low performance level, so they run
+  *       short at a higher level.
+  */
+/// @{
+
+typedef enum {
+    WATCH_PERFORMANCE_LEVEL_LOW = 0,    ///< 4 MHz (8 MHz with USB), PL2, no flash wait states. The default.
+    WATCH_PERFORMANCE_LEVEL_HIGH,       ///< 16 MHz, PL2, one flash wait state.
+} watch_performance_level_t;
+
+/** @brief Switches the CPU to the given performance level, and adjusts peripheral clock dividers to match.
+  * @param level The desired performance level.
+  * @details When raising the level, the flash wait state is set before the clock speeds up; when lowering
+  *          it, the clock slows down first. Either way, this function returns once the new level is stable.
+  *          Setting the current level again does nothing.
+  */
+void watch_set_performance_level(watch_performance_level_t level);
+
+/** @brief Returns the current performance level.
+  */
+watch_performance_level_t watch_get_performance_level(void);
+
+/** @brief Returns the current frequency of the main clock (GCLK0), in Hz.
+  * @details Use this if you are configuring a peripheral clocked from GCLK0 and need to pick a prescaler.
+  */
+uint32_t watch_get_cpu_frequency(void);
+
+/// @}
+#endif
@@ -50,7 +50,38 @@ void _watch_enable_tc1(void);
 /// Disable CDC task timer. You should not call this from your app.
 void _watch_disable_tc1(void);
 
+/// Called when the performance level changes, to keep the ADC clock constant. You should not call this from your app.
+void _watch_adc_update_prescaler(void);
+
+/// Called when the performance level changes, to keep the TCC clock constant. You should not call this from your app.
+void _watch_tcc_update_prescaler(void);
+
+/// Called when the performance level changes, to keep the USB task rate constant. You should not call this from your app.
+void _watch_update_usb_task_timers(void);
+
+/// Called when the performance level changes, to keep the I2C bus speed constant. You should not call this from your app.
+void _watch_i2c_update_baud(void);
+
+/// Called when the performance level changes, to keep the SPI bus speed constant. You should not call this from your app.
+void _watch_spi_update_baud(void);
+
+/// Called when the performance level changes, to keep the UART baud rate constant. You should not call this from your app.
+void _watch_uart_update_baud(void);
+
 /// Called by main.c if plugged in to USB. You should not call this from your app.
 void _watch_enable_usb(void);
 
+/// Fills the buffer with true random bytes, waiting on the TRNG if necessary. Also called by arc4random.
+int getentropy(void *buf, size_t buflen);
+
+/// Starts collecting 256 bits of entropy from the TRNG in the background. You should not call this from your app.
+void _watch_request_entropy(void);
+
+/// Copies the entropy collected since _watch_request_entropy into buf, if it's ready. You should not call this from your app.
+bool _watch_take_entropy(uint32_t buf[8]);
+
+/// Idles the CPU until the next interrupt, leaving clocks and peripherals running. Call it with interrupts
+/// disabled, after checking the condition you're waiting on; a pending interrupt still wakes it. You should not call this from your app.
+void _watch_sleep_idle(void);
+
 #endif
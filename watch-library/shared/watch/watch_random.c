@@ -0,0 +1,137 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "watch_random.h"
+
+#define CHACHA20_DOUBLE_ROUNDS 10
+#define ROTL32(v, n) (((v) << (n)) | ((v) >> (32 - (n))))
+#define QUARTERROUND(x, a, b, c, d) \
+    x[a] += x[b]; x[d] ^= x[a]; x[d] = ROTL32(x[d], 16); \
+    x[c] += x[d]; x[b] ^= x[c]; x[b] = ROTL32(x[b], 12); \
+    x[a] += x[b]; x[d] ^= x[a]; x[d] = ROTL32(x[d], 8); \
+    x[c] += x[d]; x[b] ^= x[c]; x[b] = ROTL32(x[b], 7);
+
+static uint32_t _key[8];
+static uint32_t _counter;
+static uint32_t _output[8];
+static uint8_t _output_pos = sizeof(_output);
+static uint16_t _blocks_until_reseed;
+static bool _seeded = false;
+
+static void _chacha20_block(uint32_t out[16]) {
+    // "expand 32-byte k", the key, and a 32-bit block counter with an all-zero nonce. since the key changes with
+    // every block, the counter only matters as a safeguard; it never needs to wrap.
+    uint32_t x[16] = {
+        0x61707865, 0x3320646e, 0x79622d32, 0x6b206574,
+        _key[0], _key[1], _key[2], _key[3], _key[4], _key[5], _key[6], _key[7],
+        _counter, 0, 0, 0
+    };
+
+    for(uint8_t i = 0; i < CHACHA20_DOUBLE_ROUNDS; i++) {
+        QUARTERROUND(x, 0, 4, 8, 12)
+        QUARTERROUND(x, 1, 5, 9, 13)
+        QUARTERROUND(x, 2, 6, 10, 14)
+        QUARTERROUND(x, 3, 7, 11, 15)
+        QUARTERROUND(x, 0, 5, 10, 15)
+        QUARTERROUND(x, 1, 6, 11, 12)
+        QUARTERROUND(x, 2, 7, 8, 13)
+        QUARTERROUND(x, 3, 4, 9, 14)
+    }
+
+    out[0] = x[0] + 0x61707865;
+    out[1] = x[1] + 0x3320646e;
+    out[2] = x[2] + 0x79622d32;
+    out[3] = x[3] + 0x6b206574;
+    for(uint8_t i = 0; i < 8; i++) out[4 + i] = x[4 + i] + _key[i];
+    out[12] = x[12] + _counter;
+    out[13] = x[13];
+    out[14] = x[14];
+    out[15] = x[15];
+    _counter++;
+}
+
+static void _refill(void) {
+    uint32_t block[16];
+
+    if (!_seeded) {
+        // the only time we wait on the TRNG: 256 bits of hardware entropy for the initial key.
+        getentropy(_key, sizeof(_key));
+        _blocks_until_reseed = WATCH_RANDOM_RESEED_INTERVAL;
+        _seeded = true;
+    } else if (_blocks_until_reseed == 0) {
+        // we asked for fresh entropy a while ago; mix it in if the TRNG is done. if not, carry on with the
+        // current key and check again next time.
+        if (_watch_take_entropy(block)) {
+            for(uint8_t i = 0; i < 8; i++) _key[i] ^= block[i];
+            _blocks_until_reseed = WATCH_RANDOM_RESEED_INTERVAL;
+        }
+    } else if (--_blocks_until_reseed == 0) {
+        _watch_request_entropy();
+    }
+
+    // fast key erasure: half of the block replaces the key, the other half is our output.
+    _chacha20_block(block);
+    memcpy(_key, block, sizeof(_key));
+    memcpy(_output, block + 8, sizeof(_output));
+    memset(block, 0, sizeof(block));
+    _output_pos = 0;
+}
+
+void watch_random_buf(void *buf, size_t len) {
+    uint8_t *dest = (uint8_t *)buf;
+
+    while (len) {
+        if (_output_pos >= sizeof(_output)) _refill();
+        size_t n = sizeof(_output) - _output_pos;
+        if (n > len) n = len;
+        memcpy(dest, (uint8_t *)_output + _output_pos, n);
+        // don't leave output we've handed out lying around in memory.
+        memset((uint8_t *)_output + _output_pos, 0, n);
+        _output_pos += n;
+        dest += n;
+        len -= n;
+    }
+}
+
+uint32_t watch_random(void) {
+    uint32_t retval;
+
+    watch_random_buf(&retval, sizeof(retval));
+
+    return retval;
+}
+
+uint32_t watch_random_uniform(uint32_t upper_bound) {
+    if (upper_bound < 2) return 0;
+
+    // reject values below 2**32 % upper_bound, so that the remaining range is an exact multiple of upper_bound.
+    uint32_t min = -upper_bound % upper_bound;
+    uint32_t r;
+    do {
+        r = watch_random();
+    } while (r < min);
+
+    return r % upper_bound;
+}
@@ -0,0 +1,69 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_RANDOM_H_INCLUDED
+#define _WATCH_RANDOM_H_INCLUDED
+////< @file watch_random.h
+
+#include "watch.h"
+
+/** @addtogroup random Random Numbers
+  * @brief This section covers functions related to generating random numbers.
+  * @details The SAM L22 has a true random number generator (TRNG), but it is slow to start up, burns
+  *          power while it runs, and has to be shut down carefully (see silicon erratum 1.16.1). Faces
+  *          that just want a dice roll or a shuffled deck don't need a fresh word of hardware entropy
+  *          for each number, so the watch library keeps a ChaCha20-based cryptographically secure
+  *          generator that is seeded once from the TRNG, the first time you ask for a random number.
+  *
+  *          After that, each 64-byte ChaCha20 block yields 32 bytes of output; the other 32 bytes
+  *          become the next key, so earlier output can't be recovered from the generator's state.
+  *          Every WATCH_RANDOM_RESEED_INTERVAL blocks, the generator asks the TRNG for more entropy in
+  *          the background: the TRNG interrupt collects it and shuts the TRNG back down, and the next
+  *          block mixes it into the key. Nothing ever busy-waits on the TRNG after the initial seed.
+  *
+  *          The functions in this section are not reentrant; don't call them from interrupt context.
+  * @note In the simulator, the generator is seeded from the browser's crypto.getRandomValues.
+  */
+/// @{
+
+/// The number of ChaCha20 blocks (32 bytes of output each) between requests for fresh hardware entropy.
+#define WATCH_RANDOM_RESEED_INTERVAL (256)
+
+/** @brief Returns 32 random bits.
+  */
+uint32_t watch_random(void);
+
+/** @brief Returns a uniformly distributed random number from 0 up to, but not including, upper_bound.
+  * @param upper_bound The number of possible values. Unlike `rand() % upper_bound`, there is no modulo bias.
+  * @return A random number less than upper_bound, or 0 if upper_bound is less than 2.
+  */
+uint32_t watch_random_uniform(uint32_t upper_bound);
+
+/** @brief Fills a buffer with random bytes.
+  * @param buf The buffer to fill.
+  * @param len The number of bytes to write.
+  */
+void watch_random_buf(void *buf, size_t len);
+
+/// @}
+#endif
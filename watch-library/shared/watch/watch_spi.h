@@ -31,6 +31,8 @@
 /** @addtogroup spi SPI Controller Driver
   * @brief This section covers functions related to the SAM L22's built-in SPI driver, including
   *        configuring the SPI bus and writing to / reading from devices.
+  * @details Transfers of 16 bytes or more are handed to the DMA controller, and the CPU idles until they finish.
+  *          Shorter ones use a byte loop. Either way, these functions return once the transfer is complete.
   */
 /// @{
 /** @brief Enables the SPI peripheral. Call this before attempting to interface with SPI devices.
@@ -52,6 +52,11 @@
   *          in this area. The region is laid out as 32 rows consisting of 4 pages of 64 bytes.
   *          32*4*64 = 8192 bytes. The area can be written one page at a time, but it can only be
   *          erased one row at a time. You can read at arbitrary word-aligned offsets within a row.
+  *          Writes and erases take a few milliseconds. watch_storage_write and watch_storage_erase start
+  *          the operation and return right away; the next call into this module waits for it to finish,
+  *          sleeping until the flash controller's READY interrupt rather than spinning. If you don't want
+  *          to wait at all, the _async variants call you back from that interrupt when they're done, so
+  *          you can return to the main loop and let the watch go to sleep in the meantime.
   *
   *                 ┌──────────────┬──────────────┬──────────────┬──────────────┐
   *          Row 0  │   64 bytes   │   64 bytes   │   64 bytes   │   64 bytes   │
@@ -85,7 +90,30 @@ bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, u
   */
 bool watch_storage_erase(uint32_t row);
 
+/** @brief Starts writing bytes to a page in the storage area, and calls you back when the write is done.
+  * @param row The row containing the page you want to write.
+  * @param offset The offset from the beginning of the row. Must be a multiple of 64.
+  * @param buffer The buffer containing the bytes you wish to set. It is copied before this function returns.
+  * @param size The number of bytes you wish to write.
+  * @param callback A function to call when the write completes, or NULL. It runs in interrupt context.
+  * @return false if the address is out of range; true if the write was started.
+  * @note If an earlier operation is still in progress, this function waits for it to finish first.
+  */
+bool watch_storage_write_async(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size, ext_irq_cb_t callback);
+
+/** @brief Starts erasing a row in the storage area, and calls you back when the erase is done.
+  * @param row The row you want to erase.
+  * @param callback A function to call when the erase completes, or NULL. It runs in interrupt context.
+  * @return false if the row is out of range; true if the erase was started.
+  */
+bool watch_storage_erase_async(uint32_t row, ext_irq_cb_t callback);
+
+/** @brief Returns true if a write or erase is still in progress.
+  */
+bool watch_storage_is_busy(void);
+
 /** @brief Waits for any pending writes to complete.
+  * @return false if any write or erase since the last call to this function failed; true otherwise.
   */
 bool watch_storage_sync(void);
 /// @}
@@ -0,0 +1,120 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef _WATCH_TIMEBASE_H_INCLUDED
+#define _WATCH_TIMEBASE_H_INCLUDED
+////< @file watch_timebase.h
+
+#include "watch.h"
+
+/** @addtogroup timebase High-Resolution Timebase
+  * @brief This section covers functions related to the shared, free-running 32.768 kHz timebase.
+  * @details The RTC only knows about whole seconds (plus the 128 Hz periodic interrupts), which is
+  *          not enough for a stopwatch. Rather than have every face reprogram a TC peripheral for a
+  *          128 Hz interrupt, the watch library provides one free-running counter clocked directly
+  *          from the 32.768 kHz crystal. The hardware counter is 16 bits wide and overflows every two
+  *          seconds; the overflow interrupt extends it to 64 bits in software. That is the only
+  *          periodic interrupt it generates, so the CPU can sleep in STANDBY between display refreshes
+  *          and still read the current time with 1/32768 second resolution.
+  *
+  *          The timebase is shared between clients. Each client registers to get a client ID, and the
+  *          counter runs as long as at least one client is registered. Each client also gets its own
+  *          capture register (to stash a timestamp, i.e. for a lap time) and its own compare register
+  *          (for a one-shot callback at a given timestamp). The compare callbacks are dispatched from
+  *          interrupt context, so keep them short.
+  *
+  *          Note that timestamps are only meaningful while the timebase is running; if every client
+  *          unregisters, the counter is reset and starts from zero at the next registration.
+  * @note On hardware, the timebase uses the TC2 peripheral. While it is running, TC2 is not available
+  *       for PWM output on pins A2 and A3.
+  */
+/// @{
+
+/// The frequency of the timebase, in Hz.
+#define WATCH_TIMEBASE_FREQUENCY (32768)
+
+/// The number of clients that can register with the timebase at once.
+#define WATCH_TIMEBASE_NUM_CLIENTS (4)
+
+/// Returned by watch_timebase_register_client if no client slots are available.
+#define WATCH_TIMEBASE_INVALID_CLIENT (-1)
+
+/** @brief Registers a client with the timebase, starting the counter if it was not already running.
+  * @return A client ID from 0 to WATCH_TIMEBASE_NUM_CLIENTS - 1, or WATCH_TIMEBASE_INVALID_CLIENT if
+  *         all client slots are taken.
+  */
+int8_t watch_timebase_register_client(void);
+
+/** @brief Unregisters a client, cancelling its compare callback. If it was the last registered client,
+  *        the counter is stopped and its peripheral powered down.
+  * @param client The client ID returned from watch_timebase_register_client.
+  */
+void watch_timebase_unregister_client(int8_t client);
+
+/** @brief Returns true if the timebase is running, i.e. at least one client is registered.
+  */
+bool watch_timebase_is_running(void);
+
+/** @brief Returns the current value of the timebase.
+  * @return The number of 1/32768 second ticks since the timebase was started, or 0 if it isn't running.
+  * @details This is a constant time read of the hardware counter combined with the software overflow
+  *          count; it is safe to call from interrupt context.
+  */
+uint64_t watch_timebase_now(void);
+
+/** @brief Stores the current value of the timebase in the client's capture register.
+  * @param client The client ID returned from watch_timebase_register_client.
+  * @return The captured value.
+  */
+uint64_t watch_timebase_capture(int8_t client);
+
+/** @brief Returns the value last stored in the client's capture register.
+  * @param client The client ID returned from watch_timebase_register_client.
+  */
+uint64_t watch_timebase_get_capture(int8_t client);
+
+/** @brief Registers a one-shot callback that will be called when the timebase reaches a given value.
+  * @param client The client ID returned from watch_timebase_register_client. Each client has one compare
+  *               register; setting a new compare value replaces any pending one.
+  * @param timestamp The timebase value at which the callback should fire. If this value is in the past,
+  *                  the callback is called immediately.
+  * @param callback The function you wish to have called.
+  */
+void watch_timebase_set_compare(int8_t client, uint64_t timestamp, ext_irq_cb_t callback);
+
+/** @brief Cancels the client's pending compare callback, if any.
+  * @param client The client ID returned from watch_timebase_register_client.
+  */
+void watch_timebase_clear_compare(int8_t client);
+
+/** @brief Idles the CPU until the timebase reaches a given value, for short waits where polling would waste power.
+  * @param client The client ID returned from watch_timebase_register_client. This uses the client's compare
+  *               register, replacing any pending compare callback.
+  * @param timestamp The timebase value to wait for. If this value is in the past, returns immediately.
+  * @note The CPU idles rather than going into STANDBY, so peripherals that are in use keep running. Don't call
+  *       this from interrupt context.
+  */
+void watch_timebase_sleep_until(int8_t client, uint64_t timestamp);
+
+/// @}
+#endif
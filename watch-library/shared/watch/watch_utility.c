@@ -102,81 +102,47 @@ uint16_t watch_utility_days_since_new_year(uint16_t year, uint8_t month, uint8_t
     return (is_leap(year) && (month > 2) ? 1 : 0) + DAYS_SO_FAR[month - 1] + day;
 }
 
-// Function taken from `src/time/__year_to_secs.c` of musl libc
-// https://musl.libc.org
-static uint32_t __year_to_secs(uint32_t year, int *is_leap)
-{
-	if (year-2ULL <= 136) {
-		int y = year;
-		int leaps = (y-68)>>2;
-		if (!((y-68)&3)) {
-			leaps--;
-			if (is_leap) *is_leap = 1;
-		} else if (is_leap) *is_leap = 0;
-		return 31536000*(y-70) + 86400*leaps;
-	}
-
-	int cycles, centuries, leaps, rem;
-
-	if (!is_leap) is_leap = &(int){0};
-	cycles = (year-100) / 400;
-	rem = (year-100) % 400;
-	if (rem < 0) {
-		cycles--;
-		rem += 400;
-	}
-	if (!rem) {
-		*is_leap = 1;
-		centuries = 0;
-		leaps = 0;
-	} else {
-		if (rem >= 200) {
-			if (rem >= 300) centuries = 3, rem -= 300;
-			else centuries = 2, rem -= 200;
-		} else {
-			if (rem >= 100) centuries = 1, rem -= 100;
-			else centuries = 0;
-		}
-		if (!rem) {
-			*is_leap = 0;
-			leaps = 0;
-		} else {
-			leaps = rem / 4U;
-			rem %= 4U;
-			*is_leap = !rem;
-		}
-	}
-
-	leaps += 97*cycles + 24*centuries - *is_leap;
+// Calendar conversions. The Cortex-M0+ has no divide instruction, so every / and % is a call into libgcc that
+// takes dozens of cycles; these conversions run on every tick in some faces, so they avoid them entirely. Each
+// division by a constant is instead a multiplication by a scaled reciprocal and a shift, exact over the range of
+// inputs noted next to it (test/test_watch_utility.c checks them). Years are counted from March 1, which puts
+// the leap day at the very end of the year, so the months' starting days are the same every year; see
+// http://howardhinnant.github.io/date_algorithms.html for the idea. Everything is counted from 1600-03-01,
+// which is the start of a 400-year cycle of the Gregorian calendar and is before any date we care about.
+
+#define DAYS_FROM_1600_TO_1970 135080  // 1600-03-01 to 1970-01-01
+#define DAYS_PER_400Y (365*400 + 97)
+#define DAYS_PER_100Y (365*100 + 24)
+#define DAYS_PER_4Y   (365*4   + 1)
 
-	return (year-100) * 31536000LL + leaps * 86400LL + 946684800 + 86400;
+// the day of the year on which each month starts, for years starting in March.
+static const uint16_t _days_before_month[12] = {0, 31, 61, 92, 122, 153, 184, 214, 245, 275, 306, 337};
+
+static inline uint32_t _div_100(uint32_t x) { return (x * 1311) >> 17; }                    // x < 4096
+static inline uint32_t _div_36524(uint32_t x) { return ((x >> 2) * 29399) >> 28; }        // x < 146097
+static inline uint32_t _div_1461(uint32_t x) { return (x * 22967) >> 25; }                 // x < 36525
+static inline uint32_t _div_365(uint32_t x) { return (x * 1437) >> 19; }                   // x < 1461
+static inline uint32_t _div_153(uint32_t x) { return (x * 857) >> 17; }                    // x < 1832
+static inline uint32_t _div_3600(uint32_t x) { return ((x >> 4) * 4661) >> 20; }          // x < 86400
+static inline uint32_t _div_60(uint32_t x) { return (x * 2185) >> 17; }                    // x < 3600
+static inline uint32_t _div_86400(uint32_t x) {                                             // any x
+    // one 32x32->64 bit multiply, which is still far cheaper than a division.
+    return ((uint64_t)(x >> 7) * 50903317) >> 35;
 }
 
-// Function taken from `src/time/__month_to_secs.c` of musl libc
-// https://musl.libc.org
-static int __month_to_secs(int month, int is_leap)
-{
-	static const int secs_through_month[] = {
-		0, 31*86400, 59*86400, 90*86400,
-		120*86400, 151*86400, 181*86400, 212*86400,
-		243*86400, 273*86400, 304*86400, 334*86400 };
-	int t = secs_through_month[month];
-	if (is_leap && month >= 2) t+=86400;
-	return t;
+static inline uint8_t _month_from_march(uint8_t month) {
+    return month >= 3 ? month - 3 : month + 9;
 }
 
-// Function adapted from `src/time/__tm_to_secs.c` of musl libc
-// https://musl.libc.org
 uint32_t watch_utility_convert_to_unix_time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, uint32_t utc_offset) {
-    int is_leap;
-
-    // POSIX tm struct starts year at 1900 and month at 0
-    // https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/time.h.html 
-    uint32_t timestamp = __year_to_secs(year - 1900, &is_leap);
-    timestamp += __month_to_secs(month - 1, is_leap);
-
-    // Regular conversion from musl libc
-    timestamp += (day - 1) * 86400;
+    // January and February belong to the year that started the March before.
+    uint32_t years = year - 1600 - (month <= 2);
+    uint32_t centuries = _div_100(years);
+    uint32_t days = years * 365 + (years >> 2) - centuries + (centuries >> 2);
+    days += _days_before_month[_month_from_march(month)] + day - 1;
+    days -= DAYS_FROM_1600_TO_1970;
+
+    uint32_t timestamp = days * 86400;
     timestamp += hour * 3600;
     timestamp += minute * 60;
     timestamp += second;
@@ -189,80 +155,100 @@ uint32_t watch_utility_date_time_to_unix_time(watch_date_time date_time, uint32_
     return watch_utility_convert_to_unix_time(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second, utc_offset);
 }
 
-#define LEAPOCH (946684800LL + 86400*(31+29))
-
-#define DAYS_PER_400Y (365*400 + 97)
-#define DAYS_PER_100Y (365*100 + 24)
-#define DAYS_PER_4Y   (365*4   + 1)
-
-watch_date_time watch_utility_date_time_from_unix_time(uint32_t timestamp, uint32_t utc_offset) {
+static watch_date_time _watch_utility_date_time_from_days(uint32_t days, uint32_t seconds) {
     watch_date_time retval;
     retval.reg = 0;
-    int32_t days, secs;
-    int32_t remdays, remsecs, remyears;
-    int32_t qc_cycles, c_cycles, q_cycles;
-    int32_t years, months;
-    int32_t wday, yday, leap;
-    static const int8_t days_in_month[] = {31,30,31,30,31,31,30,31,30,31,31,29};
-    timestamp += utc_offset;
 
-    secs = timestamp - LEAPOCH;
-    days = secs / 86400;
-    remsecs = secs % 86400;
-    if (remsecs < 0) {
-        remsecs += 86400;
-        days--;
+    // a uint32_t timestamp covers 1970 to 2106, which spans no more than two 400-year cycles.
+    uint32_t remdays = days + DAYS_FROM_1600_TO_1970;
+    uint32_t year = 1600;
+    if (remdays >= DAYS_PER_400Y) {
+        remdays -= DAYS_PER_400Y;
+        year += 400;
     }
 
-    wday = (3+days)%7;
-    if (wday < 0) wday += 7;
+    // the last century, four-year period and year of each cycle are a day longer than the others, so the
+    // quotients can come out one too high on the last day of the cycle.
+    uint32_t centuries = _div_36524(remdays);
+    if (centuries == 4) centuries--;
+    remdays -= centuries * DAYS_PER_100Y;
 
-    qc_cycles = (int)(days / DAYS_PER_400Y);
-    remdays = days % DAYS_PER_400Y;
-    if (remdays < 0) {
-        remdays += DAYS_PER_400Y;
-        qc_cycles--;
-    }
+    uint32_t quads = _div_1461(remdays);
+    remdays -= quads * DAYS_PER_4Y;
 
-    c_cycles = remdays / DAYS_PER_100Y;
-    if (c_cycles == 4) c_cycles--;
-    remdays -= c_cycles * DAYS_PER_100Y;
+    uint32_t years = _div_365(remdays);
+    if (years == 4) years--;
+    remdays -= years * 365;
 
-    q_cycles = remdays / DAYS_PER_4Y;
-    if (q_cycles == 25) q_cycles--;
-    remdays -= q_cycles * DAYS_PER_4Y;
+    year += centuries * 100 + quads * 4 + years;
 
-    remyears = remdays / 365;
-    if (remyears == 4) remyears--;
-    remdays -= remyears * 365;
+    // remdays is now the day of the year starting in March; this finds its month with no table search.
+    uint32_t month = _div_153(5 * remdays + 2);
+    uint32_t day = remdays - _days_before_month[month] + 1;
+    if (month < 10) {
+        month += 3;
+    } else {
+        month -= 9;
+        year++;
+    }
 
-    leap = !remyears && (q_cycles || !c_cycles);
-    yday = remdays + 31 + 28 + leap;
-    if (yday >= 365+leap) yday -= 365+leap;
+    if (year < 2020 || year > 2083) return retval;
+    retval.unit.year = year - WATCH_RTC_REFERENCE_YEAR;
+    retval.unit.month = month;
+    retval.unit.day = day;
 
-    years = remyears + 4*q_cycles + 100*c_cycles + 400*qc_cycles;
+    uint32_t hour = _div_3600(seconds);
+    seconds -= hour * 3600;
+    uint32_t minute = _div_60(seconds);
+    retval.unit.hour = hour;
+    retval.unit.minute = minute;
+    retval.unit.second = seconds - minute * 60;
 
-    for (months=0; days_in_month[months] <= remdays; months++)
-        remdays -= days_in_month[months];
+    return retval;
+}
 
-    years += 2000;
+watch_date_time watch_utility_date_time_from_unix_time(uint32_t timestamp, uint32_t utc_offset) {
+    timestamp += utc_offset;
+    uint32_t days = _div_86400(timestamp);
 
-    months += 2;
-    if (months >= 12) {
-        months -=12;
-        years++;
+    return _watch_utility_date_time_from_days(days, timestamp - days * 86400);
+}
+
+watch_date_time watch_utility_date_time_advance(watch_date_time date_time, uint32_t seconds) {
+    // a big jump would take a lot of carrying; it's simpler to go through a timestamp.
+    if (seconds >= 86400) {
+        return watch_utility_date_time_from_unix_time(watch_utility_date_time_to_unix_time(date_time, 0) + seconds, 0);
     }
 
-    if (years < 2020 || years > 2083) return retval;
-    retval.unit.year = years - WATCH_RTC_REFERENCE_YEAR;
-    retval.unit.month = months + 1;
-    retval.unit.day = remdays + 1;
+    seconds += date_time.unit.hour * 3600 + date_time.unit.minute * 60 + date_time.unit.second;
+    if (seconds >= 86400) {
+        seconds -= 86400;
+        if (date_time.unit.day < days_in_month(date_time.unit.month, date_time.unit.year + WATCH_RTC_REFERENCE_YEAR)) {
+            date_time.unit.day++;
+        } else {
+            date_time.unit.day = 1;
+            if (date_time.unit.month < 12) {
+                date_time.unit.month++;
+            } else {
+                date_time.unit.month = 1;
+                // like watch_utility_date_time_from_unix_time, give up past the end of 2083.
+                if (date_time.unit.year == 63) {
+                    date_time.reg = 0;
+                    return date_time;
+                }
+                date_time.unit.year++;
+            }
+        }
+    }
 
-    retval.unit.hour = remsecs / 3600;
-    retval.unit.minute = remsecs / 60 % 60;
-    retval.unit.second = remsecs % 60;
+    uint32_t hour = _div_3600(seconds);
+    seconds -= hour * 3600;
+    uint32_t minute = _div_60(seconds);
+    date_time.unit.hour = hour;
+    date_time.unit.minute = minute;
+    date_time.unit.second = seconds - minute * 60;
 
-    return retval;
+    return date_time;
 }
 
 watch_date_time watch_utility_date_time_convert_zone(watch_date_time date_time, uint32_t origin_utc_offset, uint32_t destination_utc_offset) {
@@ -88,8 +88,7 @@ uint8_t is_leap(uint16_t year);
   * @param second The second of the date you wish to convert.
   * @param utc_offset The number of seconds that date_time is offset from UTC, or 0 if the time is UTC.
   * @return A UNIX timestamp for the given date/time and UTC offset.
-  * @note Implemented by Wesley Ellis (tahnok) and based on BSD-licensed code by Josh Haberman:
-  *       https://blog.reverberate.org/2020/05/12/optimizing-date-algorithms.html
+  * @note Uses no division, which the SAM L22 can only do in software; valid for dates from 1970 through 2105.
   */
 uint32_t watch_utility_convert_to_unix_time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, uint32_t utc_offset);
 
@@ -111,11 +110,21 @@ watch_duration_t watch_utility_seconds_to_duration(uint32_t seconds);
   * @param utc_offset The number of seconds that you wish date_time to be offset from UTC.
   * @return A watch_date_time for the given UNIX timestamp and UTC offset, or if outside the range that
   *         watch_date_time can represent, a watch_date_time with all fields set to 0.
-  * @note Adapted from MIT-licensed code from musl, Copyright © 2005-2014 Rich Felker, et al.:
-  *       https://github.com/esmil/musl/blob/1cc81f5cb0df2b66a795ff0c26d7bbc4d16e13c6/src/time/__secs_to_tm.c
+  * @note Uses no division, which the SAM L22 can only do in software. Based on the days-from-civil algorithms
+  *       by Howard Hinnant: http://howardhinnant.github.io/date_algorithms.html
   */
 watch_date_time watch_utility_date_time_from_unix_time(uint32_t timestamp, uint32_t utc_offset);
 
+/** @brief Advances a watch_date_time by a number of seconds.
+  * @param date_time The watch_date_time that you wish to advance.
+  * @param seconds The number of seconds to add.
+  * @return The advanced watch_date_time, or if past the range that watch_date_time can represent, a
+  *         watch_date_time with all fields set to 0.
+  * @details For steps under a day, i.e. keeping a second clock ticking, this just carries from one field to the
+  *          next, which is much cheaper than converting to a UNIX timestamp and back.
+  */
+watch_date_time watch_utility_date_time_advance(watch_date_time date_time, uint32_t seconds);
+
 /** @brief Converts a watch_date_time for 12-hour display.
   * @param date_time A pointer to the watch_date_time that you wish to convert for display. Note that this
   *                  function will OVERWRITE the original date/time, rendering it invalid for date/time
@@ -135,8 +144,6 @@ bool watch_utility_convert_to_12_hour(watch_date_time *date_time);
   * @param destination_utc_offset The number of seconds from UTC in the destination time zone
   * @return A watch_date_time for the given UNIX timestamp and UTC offset, or if outside the range that
   *         watch_date_time can represent, a watch_date_time with all fields set to 0.
-  * @note Adapted from MIT-licensed code from musl, Copyright © 2005-2014 Rich Felker, et al.:
-  *       https://github.com/esmil/musl/blob/1cc81f5cb0df2b66a795ff0c26d7bbc4d16e13c6/src/time/__secs_to_tm.c
   */
 watch_date_time watch_utility_date_time_convert_zone(watch_date_time date_time, uint32_t origin_utc_offset, uint32_t destination_utc_offset);
 
@@ -43,6 +43,16 @@ uint16_t watch_get_vcc_voltage(void) {
     return 3000;
 }
 
+bool watch_adc_start_background_sampling(const uint8_t pin, uint8_t frequency, uint16_t *buffer, uint16_t length, watch_adc_batch_callback_t callback) {
+    return false;
+}
+
+void watch_adc_stop_background_sampling(void) {}
+
+bool watch_adc_is_background_sampling(void) {
+    return false;
+}
+
 inline void watch_disable_analog_input(const uint8_t pin) {}
 
 inline void watch_disable_adc(void) {}
@@ -25,20 +25,36 @@
 #include "watch_private.h"
 #include "watch_utility.h"
 #include <sys/time.h>
+#include <emscripten.h>
 
 void _watch_init(void) {
     // External wake depends on RTC; calendar is a required module.
     _watch_rtc_init();
 }
 
-// this function is called by arc4random to get entropy for random number generation.
-// let's use the SAM L22's true random number generator to seed the PRNG!
-int getentropy(void *buf, size_t buflen);
+// in the browser, the closest thing to the SAM L22's true random number generator is the Web Crypto API.
 int getentropy(void *buf, size_t buflen) {
-    // TODO: (a2) hook to RNG
+    EM_ASM({
+        crypto.getRandomValues(HEAPU8.subarray($0, $0 + $1));
+    }, buf, buflen);
     return 0;
 }
 
+static bool _entropy_requested = false;
+
+void _watch_request_entropy(void) {
+    _entropy_requested = true;
+}
+
+bool _watch_take_entropy(uint32_t buf[8]) {
+    if (!_entropy_requested) return false;
+
+    getentropy(buf, 8 * sizeof(uint32_t));
+    _entropy_requested = false;
+
+    return true;
+}
+
 int _gettimeofday(struct timeval *tv, void *tzvp);
 int _gettimeofday(struct timeval *tv, void *tzvp) {
     (void)tzvp;
@@ -26,6 +26,25 @@ bool watch_storage_erase(uint32_t row) {
     return true;
 }
 
+bool watch_storage_write_async(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size, ext_irq_cb_t callback) {
+    // the simulator's storage is just RAM, so everything finishes right away.
+    if (!watch_storage_write(row, offset, buffer, size)) return false;
+    if (callback) callback();
+
+    return true;
+}
+
+bool watch_storage_erase_async(uint32_t row, ext_irq_cb_t callback) {
+    if (!watch_storage_erase(row)) return false;
+    if (callback) callback();
+
+    return true;
+}
+
+bool watch_storage_is_busy(void) {
+    return false;
+}
+
 bool watch_storage_sync(void) {
     // nothing to do here!
     return true;
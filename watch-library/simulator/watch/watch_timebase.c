@@ -0,0 +1,136 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_timebase.h"
+#include "watch_main_loop.h"
+
+#include <emscripten.h>
+
+typedef struct {
+    bool registered;
+    uint64_t capture;
+    long timeout_id;
+    ext_irq_cb_t callback;
+} watch_timebase_client_t;
+
+static watch_timebase_client_t _clients[WATCH_TIMEBASE_NUM_CLIENTS];
+static uint8_t _num_clients = 0;
+static double _start_time = 0;
+
+static inline bool _is_valid_client(int8_t client) {
+    return client >= 0 && client < WATCH_TIMEBASE_NUM_CLIENTS && _clients[client].registered;
+}
+
+static void _cancel_timeout(int8_t client) {
+    if (_clients[client].timeout_id != -1) {
+        emscripten_clear_timeout(_clients[client].timeout_id);
+        _clients[client].timeout_id = -1;
+    }
+    _clients[client].callback = NULL;
+}
+
+static void watch_invoke_timebase_callback(void *userData) {
+    int8_t client = (int8_t)(intptr_t)userData;
+    ext_irq_cb_t callback = _clients[client].callback;
+
+    _clients[client].timeout_id = -1;
+    _clients[client].callback = NULL;
+    if (callback) callback();
+    resume_main_loop();
+}
+
+int8_t watch_timebase_register_client(void) {
+    for(int8_t i = 0; i < WATCH_TIMEBASE_NUM_CLIENTS; i++) {
+        if (!_clients[i].registered) {
+            if (_num_clients++ == 0) _start_time = emscripten_get_now();
+            _clients[i].registered = true;
+            _clients[i].capture = 0;
+            _clients[i].timeout_id = -1;
+            _clients[i].callback = NULL;
+            return i;
+        }
+    }
+
+    return WATCH_TIMEBASE_INVALID_CLIENT;
+}
+
+void watch_timebase_unregister_client(int8_t client) {
+    if (!_is_valid_client(client)) return;
+
+    _cancel_timeout(client);
+    _clients[client].registered = false;
+    _num_clients--;
+}
+
+bool watch_timebase_is_running(void) {
+    return _num_clients > 0;
+}
+
+uint64_t watch_timebase_now(void) {
+    if (!_num_clients) return 0;
+
+    return (uint64_t)((emscripten_get_now() - _start_time) * WATCH_TIMEBASE_FREQUENCY / 1000.0);
+}
+
+uint64_t watch_timebase_capture(int8_t client) {
+    if (!_is_valid_client(client)) return 0;
+
+    uint64_t now = watch_timebase_now();
+    _clients[client].capture = now;
+
+    return now;
+}
+
+uint64_t watch_timebase_get_capture(int8_t client) {
+    if (!_is_valid_client(client)) return 0;
+
+    return _clients[client].capture;
+}
+
+void watch_timebase_set_compare(int8_t client, uint64_t timestamp, ext_irq_cb_t callback) {
+    if (!_is_valid_client(client)) return;
+
+    _cancel_timeout(client);
+
+    uint64_t now = watch_timebase_now();
+    double timeout = timestamp > now ? (timestamp - now) * 1000.0 / WATCH_TIMEBASE_FREQUENCY : 0;
+
+    _clients[client].callback = callback;
+    _clients[client].timeout_id = emscripten_set_timeout(watch_invoke_timebase_callback, timeout, (void *)(intptr_t)client);
+}
+
+void watch_timebase_clear_compare(int8_t client) {
+    if (!_is_valid_client(client)) return;
+
+    _cancel_timeout(client);
+}
+
+void watch_timebase_sleep_until(int8_t client, uint64_t timestamp) {
+    if (!_is_valid_client(client)) return;
+
+    _cancel_timeout(client);
+
+    uint64_t now = watch_timebase_now();
+    if (timestamp > now) main_loop_sleep((timestamp - now) * 1000 / WATCH_TIMEBASE_FREQUENCY);
+}